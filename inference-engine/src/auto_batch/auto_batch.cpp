@@ -0,0 +1,675 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <iterator>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <ie_icore.hpp>
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    const std::vector<std::string> supported_configKeys = {
+        AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+        AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT
+    };
+
+    // the requests which do not collect the batch are delayed by the timeout, so it is short by default
+    constexpr int defaultTimeout = 10;
+
+    int ParseTimeout(const std::string& value) {
+        int timeout = -1;
+        try {
+            timeout = std::stoi(value);
+        } catch (const std::exception&) {
+        }
+        if (timeout < 0) {
+            IE_THROW() << "Wrong value " << value << " for the " << AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT
+                       << " key, the timeout in milliseconds >= 0 is expected";
+        }
+        return timeout;
+    }
+
+    // the batch is the outer dimension of the blob, so the slot of the request is a contiguous part of the memory
+    bool IsBatchedBlobDesc(const TensorDesc& desc, size_t batch) {
+        const auto& dims = desc.getDims();
+        const auto& order = desc.getBlockingDesc().getOrder();
+        return !dims.empty() && dims[0] == batch && !order.empty() && order[0] == 0;
+    }
+
+    Blob::Ptr CreateSlotBlob(const Blob::Ptr& batchedBlob, size_t batchId, size_t batchSize) {
+        const auto& batchedDesc = batchedBlob->getTensorDesc();
+        auto dims = batchedDesc.getDims();
+        dims[0] = 1;
+        const TensorDesc desc(batchedDesc.getPrecision(), dims, batchedDesc.getLayout());
+        auto ptr = batchedBlob->buffer().as<uint8_t*>() + batchedBlob->byteSize() / batchSize * batchId;
+        return make_blob_with_precision(desc, ptr);
+    }
+
+    void CopyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+        if (src->getTensorDesc() == dst->getTensorDesc()) {
+            std::memcpy(dst->buffer().as<uint8_t*>(), src->cbuffer().as<const uint8_t*>(), dst->byteSize());
+        } else {
+            blob_copy(src, dst);
+        }
+    }
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                             const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                                             const SoIInferRequestInternal& inferRequestWithoutBatch)
+        : IInferRequestInternal(inputs, outputs),
+          _inferRequestWithoutBatch(inferRequestWithoutBatch) {
+    ShareBlobsWithRequestWithoutBatch();
+}
+
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&   networkInputs,
+                                             const OutputsDataMap&  networkOutputs,
+                                             const SoIInferRequestInternal& inferRequestWithoutBatch)
+        : IInferRequestInternal(networkInputs, networkOutputs),
+          _inferRequestWithoutBatch(inferRequestWithoutBatch) {
+    ShareBlobsWithRequestWithoutBatch();
+}
+
+void AutoBatchInferRequest::ShareBlobsWithRequestWithoutBatch() {
+    // the request is not bound to a slot of the batch, so it owns the blobs, the ones of the request without the batch
+    for (const auto &it : _networkInputs) {
+        _inputs[it.first] = _inferRequestWithoutBatch->GetBlob(it.first);
+    }
+    for (const auto &it : _networkOutputs) {
+        _outputs[it.first] = _inferRequestWithoutBatch->GetBlob(it.first);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToSlot(const BlobMap& slotInputs) {
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlob(GetBlob(name), slotInputs.at(name));
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromSlot(const BlobMap& slotOutputs) {
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        CopyBlob(slotOutputs.at(name), GetBlob(name));
+    }
+}
+
+void AutoBatchInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInternal& req) {
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        auto blob = GetBlob(name);
+        if (req->GetBlob(name) != blob)
+            req->SetBlob(name, blob);
+    }
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        auto blob = GetBlob(name);
+        if (req->GetBlob(name) != blob)
+            req->SetBlob(name, blob);
+    }
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const bool                                  needPerfCounters,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequest{inferRequest},
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _needPerfCounters{needPerfCounters} {
+    // this executor queues the request for a batch while the task (checking the result) is run when the batch is done
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_autoBatchExecutableNetwork->ScheduleToWorkerInferRequest({_this, std::move(task)});
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              if (nullptr != _inferRequest->_exceptionPtr) {
+                  std::rethrow_exception(_inferRequest->_exceptionPtr);
+              }
+              // the batched request is not given to the next batch before this task is done
+              if (auto worker = _inferRequest->_batchWorker) {
+                  const auto copyStart = AutoBatchExecutableNetwork::Clock::now();
+                  _inferRequest->CopyOutputsFromSlot(worker->_slotOutputs[_inferRequest->_batchId]);
+                  _autoBatchExecutableNetwork->AddCopyTime(AutoBatchExecutableNetwork::Clock::now() - copyStart);
+                  if (_needPerfCounters)
+                      _perfMap = worker->_inferRequestBatched->GetPerformanceCounts();
+              } else if (_needPerfCounters) {
+                  _perfMap = _inferRequest->_inferRequestWithoutBatch->GetPerformanceCounts();
+              }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const SoExecutableNetworkInternal&  networkWithBatch,
+                                                       const SoExecutableNetworkInternal&  networkWithoutBatch,
+                                                       const DeviceInformation&            networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                                       const std::chrono::milliseconds     timeout,
+                                                       const bool                          needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _network{networkWithBatch},
+    _networkWithoutBatch{networkWithoutBatch},
+    _device{networkDevice},
+    _config{config},
+    _timeout{timeout},
+    _needPerfCounters{needPerfCounters} {
+    _dispatcher = std::thread([this] {
+        RunDispatcher();
+    });
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    _terminate = true;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+    }
+    _cond.notify_one();
+    _dispatcher.join();
+    // the callback of the batched request refers to the worker, so the request is released first
+    for (auto&& worker : _workerRequests) {
+        worker->_inferRequestBatched = {};
+    }
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::AddWorkerInferRequestIfNeeded() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _numRequestsCreated++;
+    const size_t batch = _device.batchForDevice;
+    if (_workerRequests.size() * batch >= _numRequestsCreated)
+        return;
+
+    _workerRequests.emplace_back(new WorkerInferRequest);
+    auto workerRequestPtr = _workerRequests.back().get();
+    workerRequestPtr->_inferRequestBatched = { _network._so, _network->CreateInferRequest() };
+    workerRequestPtr->_slotInputs.resize(batch);
+    workerRequestPtr->_slotOutputs.resize(batch);
+    for (size_t slot = 0; slot < batch; slot++) {
+        for (auto&& input : _network->GetInputsInfo()) {
+            workerRequestPtr->_slotInputs[slot][input.first] =
+                CreateSlotBlob(workerRequestPtr->_inferRequestBatched->GetBlob(input.first), slot, batch);
+        }
+        for (auto&& output : _network->GetOutputsInfo()) {
+            workerRequestPtr->_slotOutputs[slot][output.first] =
+                CreateSlotBlob(workerRequestPtr->_inferRequestBatched->GetBlob(output.first), slot, batch);
+        }
+    }
+    workerRequestPtr->_inferRequestBatched->SetCallback(
+        [this, workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
+            CompleteBatch(*workerRequestPtr, exceptionPtr);
+        });
+    _idleWorkers.push_back(workerRequestPtr);
+}
+
+void AutoBatchExecutableNetwork::ScheduleToWorkerInferRequest(QueuedTask task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        task.first->_inferRequest->_queuedTime = Clock::now();
+        _tasks.push_back(std::move(task));
+    }
+    _cond.notify_one();
+}
+
+void AutoBatchExecutableNetwork::RunDispatcher() {
+    const size_t batch = _device.batchForDevice;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_terminate) {
+        if (_tasks.empty()) {
+            _cond.wait(lock);
+            continue;
+        }
+        // any N queued requests form a batch as soon as a batched request is idle
+        if (_tasks.size() >= batch && !_idleWorkers.empty()) {
+            auto worker = _idleWorkers.back();
+            _idleWorkers.pop_back();
+            worker->_completionTasks.assign(std::make_move_iterator(_tasks.begin()),
+                                            std::make_move_iterator(_tasks.begin() + batch));
+            _tasks.erase(_tasks.begin(), _tasks.begin() + batch);
+            lock.unlock();
+            RunBatch(*worker);
+            lock.lock();
+            continue;
+        }
+        // the first queued request waits for the rest of the batch no longer than the timeout
+        const auto deadline = _tasks.front().first->_inferRequest->_queuedTime + _timeout;
+        if (Clock::now() < deadline) {
+            _cond.wait_until(lock, deadline);
+            continue;
+        }
+        // the busy batched requests are waited for, the network without the batch would compete with them for the device
+        if (_idleWorkers.empty()) {
+            _cond.wait(lock);
+            continue;
+        }
+        // the single request is cheaper without the batch, the rest form a partial batch, the unused slots are ignored
+        if (_tasks.size() == 1) {
+            std::vector<QueuedTask> tasks(std::make_move_iterator(_tasks.begin()), std::make_move_iterator(_tasks.end()));
+            _tasks.clear();
+            lock.unlock();
+            RunWithoutBatch(tasks);
+            lock.lock();
+            continue;
+        }
+        auto worker = _idleWorkers.back();
+        _idleWorkers.pop_back();
+        worker->_completionTasks.assign(std::make_move_iterator(_tasks.begin()), std::make_move_iterator(_tasks.end()));
+        _tasks.clear();
+        lock.unlock();
+        RunBatch(*worker);
+        lock.lock();
+    }
+}
+
+void AutoBatchExecutableNetwork::RunBatch(WorkerInferRequest& worker) {
+    // the callback of the batched request is not called before it is started, so the tasks are read without the lock
+    UpdateStatistics(1, worker._completionTasks);
+    _requestsBatched += worker._completionTasks.size();
+    try {
+        const auto copyStart = Clock::now();
+        for (size_t slot = 0; slot < worker._completionTasks.size(); slot++) {
+            auto inferRequest = worker._completionTasks[slot].first->_inferRequest.get();
+            inferRequest->_batchWorker = &worker;
+            inferRequest->_batchId = slot;
+            inferRequest->CopyInputsToSlot(worker._slotInputs[slot]);
+        }
+        AddCopyTime(Clock::now() - copyStart);
+        worker._inferRequestBatched->StartAsync();
+    } catch (...) {
+        CompleteBatch(worker, std::current_exception());
+    }
+}
+
+void AutoBatchExecutableNetwork::RunWithoutBatch(std::vector<QueuedTask>& tasks) {
+    UpdateStatistics(tasks.size(), tasks);
+    for (auto&& task : tasks) {
+        // the request without the batch is owned by the request, so the callback does not keep the latter
+        auto inferRequest = task.first->_inferRequest.get();
+        inferRequest->_batchWorker = nullptr;
+        auto& requestWithoutBatch = inferRequest->_inferRequestWithoutBatch;
+        try {
+            // the own blobs of the request are the ones of the request without the batch, the user ones are set
+            inferRequest->SetBlobsToAnotherRequest(requestWithoutBatch);
+            requestWithoutBatch->SetCallback([inferRequest, completion = task.second](std::exception_ptr exceptionPtr) {
+                inferRequest->_exceptionPtr = exceptionPtr;
+                completion();
+            });
+            requestWithoutBatch->StartAsync();
+        } catch (...) {
+            inferRequest->_exceptionPtr = std::current_exception();
+            task.second();
+        }
+    }
+}
+
+void AutoBatchExecutableNetwork::CompleteBatch(WorkerInferRequest& worker, std::exception_ptr exceptionPtr) {
+    std::vector<QueuedTask> completed;
+    std::swap(completed, worker._completionTasks);
+    // the outputs are copied from the slots by the tasks, the requests may be started again by their callbacks
+    for (auto&& task : completed) {
+        task.first->_inferRequest->_exceptionPtr = exceptionPtr;
+        task.second();
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idleWorkers.push_back(&worker);
+    }
+    _cond.notify_one();
+}
+
+void AutoBatchExecutableNetwork::UpdateStatistics(size_t batches, const std::vector<QueuedTask>& tasks) {
+    const auto now = Clock::now();
+    uint64_t delay = 0;
+    for (auto&& task : tasks) {
+        delay += std::chrono::duration_cast<std::chrono::microseconds>(now - task.first->_inferRequest->_queuedTime).count();
+    }
+    _batchesExecuted += batches;
+    _requestsExecuted += tasks.size();
+    _queueDelayUs += delay;
+}
+
+void AutoBatchExecutableNetwork::AddCopyTime(Clock::duration copyTime) {
+    _copyTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(copyTime).count();
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
+    return _network->GetContext();
+}
+
+InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(
+    const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+    const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
+    AddWorkerInferRequestIfNeeded();
+    SoIInferRequestInternal requestWithoutBatch = { _networkWithoutBatch._so, _networkWithoutBatch->CreateInferRequest() };
+    return std::make_shared<AutoBatchInferRequest>(inputs, outputs, requestWithoutBatch);
+}
+
+InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    AddWorkerInferRequestIfNeeded();
+    SoIInferRequestInternal requestWithoutBatch = { _networkWithoutBatch._so, _networkWithoutBatch->CreateInferRequest() };
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, requestWithoutBatch);
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    IInferRequestInternal::Ptr syncRequestImpl;
+    if (this->_plugin && this->_plugin->GetCore() && this->_plugin->GetCore()->isNewAPI())
+        syncRequestImpl = CreateInferRequestImpl(_parameters, _results);
+
+    if (!syncRequestImpl)
+        syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                        _needPerfCounters,
+                                                        std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                        _callbackExecutor);
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    IE_THROW(NotImplemented);
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    }
+    // the rest of the keys are the ones of the device
+    return _network->GetConfig(name);
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int requests = 1;
+        try {
+            requests = _network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception&) {
+        }
+        // every batched request is filled by the batch of the requests of the user
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, _device.batchForDevice * requests);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch->GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE)) {
+        const uint64_t batches = _batchesExecuted;
+        const float size = batches ? static_cast<float>(_requestsExecuted) / batches : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_AVERAGE_BATCH_SIZE, size);
+    } else if (name == METRIC_KEY(AUTO_BATCH_AVERAGE_QUEUE_DELAY)) {
+        const uint64_t requests = _requestsExecuted;
+        const float delay = requests ? static_cast<float>(_queueDelayUs) / requests / 1000.f : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_AVERAGE_QUEUE_DELAY, delay);
+    } else if (name == METRIC_KEY(AUTO_BATCH_AVERAGE_COPY_TIME)) {
+        const uint64_t requests = _requestsBatched;
+        const float time = requests ? static_cast<float>(_copyTimeUs) / requests / 1000.f : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_AVERAGE_COPY_TIME, time);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE),
+            METRIC_KEY(AUTO_BATCH_AVERAGE_QUEUE_DELAY),
+            METRIC_KEY(AUTO_BATCH_AVERAGE_COPY_TIME)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceWithBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceWithID = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = -1;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        try {
+            batch = std::stoi(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+        } catch (const std::exception&) {
+        }
+    }
+    if (batch <= 0) {
+        IE_THROW() << "Batch value for '" << deviceWithID << "' must be > 0, while " << deviceWithBatch
+                   << " is passed, the device is expected as e.g. CPU(4)";
+    }
+
+    DeviceIDParser deviceParser(deviceWithID);
+    std::string deviceName = deviceParser.getDeviceName();
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceName), batch };
+}
+
+void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::string>& config) {
+    auto timeout = config.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (timeout != config.end()) {
+        ParseTimeout(timeout->second);
+    }
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+        auto it = _config.find(name);
+        if (it != _config.end()) {
+            return { it->second };
+        } else if (name == AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT) {
+            return { std::to_string(defaultTimeout) };
+        } else {
+            IE_THROW() << "Value for KEY_AUTO_BATCH_DEVICE_CONFIG is not set";
+        }
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    CheckConfig(config);
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { GetName() };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork& network,
+                                                                             const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << GetName() << " device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    CheckConfig(fullConfig);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    const size_t batch = metaDevice.batchForDevice;
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    const int timeoutMs = timeout == fullConfig.end() ? defaultTimeout : ParseTimeout(timeout->second);
+
+    // the network is batched by the outer dimension of the inputs
+    auto shapes = network.getInputShapes();
+    for (auto&& shape : shapes) {
+        if (shape.second.empty() || shape.second[0] != 1) {
+            IE_THROW() << GetName() << " device supports just the networks with the batch 1 in the outer dimension of the inputs, "
+                       << "while the input " << shape.first << " is not";
+        }
+        shape.second[0] = batch;
+    }
+    auto clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    clonedNetwork.reshape(shapes);
+
+    auto networkWithoutBatch = GetCore()->LoadNetwork(network, metaDevice.deviceName, metaDevice.config);
+    auto networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, metaDevice.deviceName, metaDevice.config);
+
+    // the slots of the requests are the contiguous parts of the batched blobs
+    for (auto&& input : networkWithBatch->GetInputsInfo()) {
+        if (!IsBatchedBlobDesc(input.second->getTensorDesc(), batch)) {
+            IE_THROW() << GetName() << " device cannot batch the input " << input.first << " of the network";
+        }
+    }
+    for (auto&& output : networkWithBatch->GetOutputsInfo()) {
+        const auto originalOutput = networkWithoutBatch->GetOutputsInfo().find(output.first);
+        if (!IsBatchedBlobDesc(output.second->getTensorDesc(), batch) ||
+            originalOutput == networkWithoutBatch->GetOutputsInfo().end() ||
+            !IsBatchedBlobDesc(originalOutput->second->getTensorDesc(), 1)) {
+            IE_THROW() << GetName() << " device cannot batch the output " << output.first
+                       << " of the network, the batch is expected in the outer dimension";
+        }
+    }
+
+    // the perf counters are enabled if the device enables them for the network
+    bool enablePerfCounters = false;
+    try {
+        enablePerfCounters =
+            networkWithBatch->GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>() == PluginConfigParams::YES;
+    } catch (...) {
+    }
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig = {
+        { AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG, deviceConfig->second },
+        { AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, std::to_string(timeoutMs) }
+    };
+    return std::make_shared<AutoBatchExecutableNetwork>(networkWithBatch,
+                                                        networkWithoutBatch,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        std::chrono::milliseconds(timeoutMs),
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    QueryNetworkResult queryResult;
+
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferencEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << GetName() << " device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    auto deviceQr = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+
+    queryResult.rc = StatusCode::OK;
+    for (auto&& layerQr : deviceQr.supportedLayersMap) {
+        queryResult.supportedLayersMap[layerQr.first] = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
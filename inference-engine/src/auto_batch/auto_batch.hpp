@@ -0,0 +1,195 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include "ie_icore.hpp"
+
+namespace AutoBatchPlugin {
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchAsyncInferRequest;
+
+/**
+ * The executable network keeps the network compiled for the batch N and gathers the requests created by the user into
+ * batched inferences. The queued requests are not bound to a batched request: the dispatcher takes the first N of
+ * them for any idle batched request, the position of a request in the batch is its slot. As the slot of a request
+ * changes from one inference to another, the slots can't be the blobs of the request, so the inputs of the requests
+ * are copied to their slots and the outputs are copied back when the batch is done, the time of the copies is reported
+ * by the AUTO_BATCH_AVERAGE_COPY_TIME metric. The requests which do not collect the full batch in the timeout form
+ * a partial batch as soon as a batched request is idle, the single request is executed by the network compiled
+ * without the batch.
+ */
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    using Clock = std::chrono::steady_clock;
+    using QueuedTask = std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>;
+
+    struct WorkerInferRequest {
+        InferenceEngine::SoIInferRequestInternal   _inferRequestBatched;
+        // the views on the slots of the blobs of the batched request, indexed by the slot
+        std::vector<InferenceEngine::BlobMap>      _slotInputs;
+        std::vector<InferenceEngine::BlobMap>      _slotOutputs;
+        // the requests executed by the current batch, the index of a request is its slot
+        std::vector<QueuedTask>                    _completionTasks;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&  networkWithBatch,
+                                        const InferenceEngine::SoExecutableNetworkInternal&  networkWithoutBatch,
+                                        const DeviceInformation&                             networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                        const std::chrono::milliseconds                      timeout,
+                                        const bool                                           needPerfCounters = false);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                                                       const std::vector<std::shared_ptr<const ov::Node>>& outputs) override;
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+    ~AutoBatchExecutableNetwork();
+
+    // queues the final task of the request, the task is run when the batch of the request is executed
+    void ScheduleToWorkerInferRequest(QueuedTask task);
+    // accumulates the time of copying the blobs of a request to the slot or from it
+    void AddCopyTime(Clock::duration copyTime);
+
+protected:
+    // a batched request is added for every N requests created by the user
+    void AddWorkerInferRequestIfNeeded();
+    void RunDispatcher();
+    void RunBatch(WorkerInferRequest& worker);
+    void RunWithoutBatch(std::vector<QueuedTask>& tasks);
+    void CompleteBatch(WorkerInferRequest& worker, std::exception_ptr exceptionPtr);
+    void UpdateStatistics(size_t batches, const std::vector<QueuedTask>& tasks);
+
+    InferenceEngine::SoExecutableNetworkInternal                _network;
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithoutBatch;
+    const DeviceInformation                                     _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    const std::chrono::milliseconds                             _timeout;
+    const bool                                                  _needPerfCounters = false;
+
+    // the queued requests and the batched requests which are not executed, both are guarded by the mutex
+    std::mutex                                                  _mutex;
+    std::condition_variable                                     _cond;
+    std::deque<QueuedTask>                                      _tasks;
+    std::vector<WorkerInferRequest*>                            _idleWorkers;
+    std::vector<std::unique_ptr<WorkerInferRequest>>            _workerRequests;
+    size_t                                                      _numRequestsCreated = 0;
+    std::atomic_bool                                            _terminate = {false};
+    std::thread                                                 _dispatcher;
+
+    // the statistics of the formed batches reported by the metrics
+    std::atomic<uint64_t>                                       _batchesExecuted = {0};
+    std::atomic<uint64_t>                                       _requestsExecuted = {0};
+    std::atomic<uint64_t>                                       _queueDelayUs = {0};
+    std::atomic<uint64_t>                                       _requestsBatched = {0};
+    std::atomic<uint64_t>                                       _copyTimeUs = {0};
+};
+
+class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&   networkInputs,
+                                   const InferenceEngine::OutputsDataMap&  networkOutputs,
+                                   const InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch);
+    explicit AutoBatchInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                   const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                                   const InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // the inputs are copied to the slot of the batch assigned to the request and the outputs are copied back
+    void CopyInputsToSlot(const InferenceEngine::BlobMap& slotInputs);
+    void CopyOutputsFromSlot(const InferenceEngine::BlobMap& slotOutputs);
+    // sets the blobs of the request (the own ones or the ones of the user) to the request without the batch
+    void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+
+    InferenceEngine::SoIInferRequestInternal        _inferRequestWithoutBatch;
+    // the batched request which executed the request and the slot of the request in it, null if executed without the batch
+    AutoBatchExecutableNetwork::WorkerInferRequest* _batchWorker = nullptr;
+    size_t                                          _batchId = 0;
+    AutoBatchExecutableNetwork::Clock::time_point   _queuedTime;
+    std::exception_ptr                              _exceptionPtr = nullptr;
+
+private:
+    void ShareBlobsWithRequestWithoutBatch();
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const bool                                  needPerfCounters,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    ~AutoBatchAsyncInferRequest();
+
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+
+protected:
+    AutoBatchExecutableNetwork::Ptr                                     _autoBatchExecutableNetwork;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::IInferencePlugin {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() = default;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string& deviceWithBatch,
+                                      const std::map<std::string, std::string>& config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const DeviceName& deviceName) const;
+    static void CheckConfig(const std::map<std::string, std::string>& config);
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto-Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto-Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides a BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+
+/**
+ * @brief The device the network is compiled for with the batch in brackets, e.g. "CPU(8)".
+ * The network must have the batch 1 in the outer dimension of the inputs and the outputs.
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG);
+
+/**
+ * @brief The time in milliseconds the first queued request waits for the rest of the batch.
+ * Any queued requests form a batch, they are not bound to a batched request. When the time is out, the requests
+ * collected so far form a partial batch as soon as a batched request is idle, the single request is executed by
+ * the network compiled without the batch. The default is 10.
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+
+namespace Metrics {
+
+/**
+ * @def AUTO_BATCH_METRIC_KEY(name)
+ * @brief shortcut for defining Auto-Batching plugin metrics
+ */
+#define AUTO_BATCH_METRIC_KEY(name)              METRIC_KEY(AUTO_BATCH_##name)
+#define DECLARE_AUTO_BATCH_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(AUTO_BATCH_##name, __VA_ARGS__)
+
+/**
+ * @brief The executable network metric: the average number of the requests executed by a batched inference
+ */
+DECLARE_AUTO_BATCH_METRIC_KEY(AVERAGE_BATCH_SIZE, float);
+
+/**
+ * @brief The executable network metric: the average time in milliseconds a request waits for its batch to start
+ */
+DECLARE_AUTO_BATCH_METRIC_KEY(AVERAGE_QUEUE_DELAY, float);
+
+/**
+ * @brief The executable network metric: the average time in milliseconds spent on copying the inputs of a batched
+ * request to its slot of the batch and the outputs back
+ */
+DECLARE_AUTO_BATCH_METRIC_KEY(AVERAGE_COPY_TIME, float);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
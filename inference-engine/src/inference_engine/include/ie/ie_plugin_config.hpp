@@ -419,6 +419,7 @@ DECLARE_CONFIG_KEY(CACHE_DIR);
 
 #include "hetero/hetero_plugin_config.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 
 // remove in 2022.1 major release
 #include "cldnn/cldnn_config.hpp"
@@ -16,6 +16,8 @@
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
+#include "ngraph/op/util/multi_subgraph_base.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
 #include "openvino/pass/manager.hpp"
@@ -40,6 +42,19 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+static void collectConstants(const std::shared_ptr<const ngraph::Function>& function,
+                             std::vector<std::shared_ptr<ngraph::opset6::Constant>>& constants) {
+    for (const auto& op : function->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto subgraph = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < subgraph->get_internal_subgraphs_size(); i++) {
+                collectConstants(subgraph->get_function(static_cast<int>(i)), constants);
+            }
+        }
+    }
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -70,6 +85,14 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
 
     uint64_t seed = 0;
     // 1. Calculate hash on function
+    // The constant data fingerprints are cached on the constants, so they are calculated in parallel
+    // before the structure of the function is hashed
+    std::vector<std::shared_ptr<ngraph::opset6::Constant>> constants;
+    collectConstants(network.getFunction(), constants);
+    parallel_for(constants.size(), [&](size_t i) {
+        constants[i]->get_data_hash();
+    });
+
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ov::pass::Hash>(seed);
@@ -84,6 +84,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[ie::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[ie::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
     } else if (deviceName.find("AUTO") == 0) {
         deviceName_ = "AUTO";
         if (deviceName.find("AUTO:") == 0) {
@@ -671,6 +674,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                IE_THROW()
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         for (auto o : options) {
             parsed._config.insert(o);
@@ -1018,6 +1030,14 @@ public:
                     deviceNames = ie::DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
                 }
                 deviceNames.emplace_back("AUTO");
+            } else if (deviceName.find("BATCH") == 0) {
+                auto pos = deviceName.find_first_of(":");
+                if (pos != std::string::npos) {
+                    // the batch is given in brackets after the device
+                    auto batched = deviceName.substr(pos + 1);
+                    deviceNames.push_back(batched.substr(0, batched.find_first_of('(')));
+                }
+                deviceNames.emplace_back("BATCH");
             } else {
                 deviceNames.push_back(deviceName);
             }
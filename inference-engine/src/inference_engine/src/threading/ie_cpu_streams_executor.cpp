@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -25,6 +26,79 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue (Dmitry Vyukov's algorithm).
+ *        Each cell has a sequence number which tells producers and consumers whether the cell is ready for them,
+ *        so the only contention point is a CAS on the corresponding position.
+ */
+class TaskRingQueue {
+public:
+    explicit TaskRingQueue(std::size_t capacity) : _cells(new Cell[capacity]), _mask(capacity - 1) {
+        assert((capacity & _mask) == 0 && "capacity must be a power of two");
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto seq = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._task = std::move(task);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(Task& task) {
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto seq = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    task = std::move(cell._task);
+                    cell._task = nullptr;
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // the queue is empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        Task _task;
+    };
+    static constexpr std::size_t cacheLineSize = 64;
+
+    std::unique_ptr<Cell[]> _cells;
+    const std::size_t _mask;
+    // producers and consumers positions are placed to the different cache lines to avoid false sharing
+    char _pad0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos{0};
+    char _pad1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos{0};
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -215,9 +289,18 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._workStealing) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _streamQueues.emplace_back(new TaskRingQueue{streamQueueCapacity});
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (_config._workStealing) {
+                    WorkStealingLoop(streamId);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -239,6 +322,10 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        if (_config._workStealing) {
+            EnqueueWorkStealing(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -246,6 +333,77 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    // Tasks are distributed between the stream queues in the round-robin fashion,
+    // the shared queue is used only if all the stream queues are full
+    void EnqueueWorkStealing(Task task) {
+        _pendingTasks.fetch_add(1);
+        const auto queuesNum = _streamQueues.size();
+        const auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (std::size_t i = 0; i < queuesNum && !pushed; ++i) {
+            pushed = _streamQueues[(first + i) % queuesNum]->TryPush(task);
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+            _overflowTasks.fetch_add(1);
+        }
+        // a parked thread increments the counter before it checks the pending tasks under the mutex,
+        // so either it sees the task or it is already waiting when the notification is sent
+        if (_parkedThreads.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TryDequeue(const int streamId, Task& task) {
+        const auto queuesNum = _streamQueues.size();
+        // own queue first, then try to steal from the neighbours
+        for (std::size_t i = 0; i < queuesNum; ++i) {
+            if (_streamQueues[(streamId + i) % queuesNum]->TryPop(task)) {
+                _pendingTasks.fetch_sub(1);
+                return true;
+            }
+        }
+        if (_overflowTasks.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowTasks.fetch_sub(1);
+                _pendingTasks.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingLoop(const int streamId) {
+        for (;;) {
+            Task task;
+            bool found = TryDequeue(streamId, task);
+            // spin-then-park idling: poll the queues for a while before going to sleep
+            for (int spin = 0; !found && spin < _config._spinCount; ++spin) {
+                std::this_thread::yield();
+                found = TryDequeue(streamId, task);
+            }
+            if (found) {
+                Execute(task, *(_streams.local()));
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _parkedThreads.fetch_add(1);
+            _queueCondVar.wait(lock, [&] {
+                return _pendingTasks.load() > 0 || _isStopped;
+            });
+            _parkedThreads.fetch_sub(1);
+            // the queues are drained before the executor is stopped
+            if (_isStopped && _pendingTasks.load() == 0) {
+                break;
+            }
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -284,6 +442,13 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    // work stealing mode
+    static constexpr std::size_t streamQueueCapacity = 1024;
+    std::vector<std::unique_ptr<TaskRingQueue>> _streamQueues;
+    std::atomic<std::size_t> _nextQueue{0};
+    std::atomic<int> _pendingTasks{0};
+    std::atomic<int> _overflowTasks{0};
+    std::atomic<int> _parkedThreads{0};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "lru_cache.h"
+
+namespace MKLDNNPlugin {
+
+class CacheEntryBase {
+public:
+    enum class LookUpStatus : int8_t {
+        Hit,
+        Miss
+    };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t size = 0;
+    };
+
+public:
+    virtual ~CacheEntryBase() = default;
+    virtual Statistics getStatistics() const = 0;
+};
+
+/**
+ * @brief Class represents a templated record in multi cache
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
+ *         interface and must have constructor of type ImplType(size_t).
+ *
+ * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The entry is thread safe: the lookup and the insertion are serialized, while the builder is called without holding the lock,
+ *       so the expensive primitive creation does not block the other streams.
+ */
+
+template<typename KeyType,
+         typename ValType,
+         typename ImplType = LruCache<KeyType, ValType>>
+class CacheEntry : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+public:
+    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+
+    /**
+     * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
+     * the underlying storage.
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+     */
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _impl.getCapacity()) {
+            // fast track
+            _misses++;
+            return {builder(key), LookUpStatus::Miss};
+        }
+        {
+            std::lock_guard<std::mutex> lock(_guard);
+            auto retVal = _impl.get(key);
+            if (retVal) {
+                _hits++;
+                return {retVal, LookUpStatus::Hit};
+            }
+        }
+        _misses++;
+        auto retVal = builder(key);
+        if (retVal) {
+            std::lock_guard<std::mutex> lock(_guard);
+            _impl.put(key, retVal);
+        }
+        return {retVal, LookUpStatus::Miss};
+    }
+
+    Statistics getStatistics() const override {
+        Statistics stat;
+        stat.hits = _hits;
+        stat.misses = _misses;
+        std::lock_guard<std::mutex> lock(_guard);
+        stat.size = _impl.size();
+        return stat;
+    }
+
+private:
+    ImplType _impl;
+    mutable std::mutex _guard;
+    std::atomic<size_t> _hits{0};
+    std::atomic<size_t> _misses{0};
+};
+}  // namespace MKLDNNPlugin
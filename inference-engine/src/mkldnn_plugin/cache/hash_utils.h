@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Helpers to compose hash values of the runtime cache keys (see MultiCache).
+ * The hash doesn't have to be unique, the keys are always compared with operator== on lookup.
+ */
+
+template <typename T>
+inline size_t hash_combine(size_t seed, const T &v) {
+    return seed ^= std::hash<T>{}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+template <typename T>
+inline size_t hash_combine(size_t seed, const std::vector<T> &v) {
+    seed = hash_combine(seed, v.size());
+    for (const auto &elem : v)
+        seed = hash_combine(seed, elem);
+    return seed;
+}
+
+inline size_t get_md_hash(const mkldnn::memory::desc &desc) {
+    const auto &md = desc.data;
+    size_t seed = 0;
+    seed = hash_combine(seed, md.ndims);
+    seed = hash_combine(seed, static_cast<int>(md.data_type));
+    seed = hash_combine(seed, static_cast<int>(md.format_kind));
+    seed = hash_combine(seed, md.offset0);
+    for (int i = 0; i < md.ndims; i++) {
+        seed = hash_combine(seed, md.dims[i]);
+        seed = hash_combine(seed, md.padded_dims[i]);
+        seed = hash_combine(seed, md.padded_offsets[i]);
+    }
+    if (md.format_kind == dnnl_blocked) {
+        const auto &blk = md.format_desc.blocking;
+        for (int i = 0; i < md.ndims; i++)
+            seed = hash_combine(seed, blk.strides[i]);
+        seed = hash_combine(seed, blk.inner_nblks);
+        for (int i = 0; i < blk.inner_nblks; i++) {
+            seed = hash_combine(seed, blk.inner_blks[i]);
+            seed = hash_combine(seed, blk.inner_idxs[i]);
+        }
+    }
+    seed = hash_combine(seed, static_cast<uint64_t>(md.extra.flags));
+    return seed;
+}
+
+/**
+ * @brief Cheap hash of the primitive attributes: only the post ops structure is taken into account.
+ * The full comparison of the attributes (including the post ops data) must be done in the key operator==.
+ */
+inline size_t get_attr_hash(const mkldnn::primitive_attr &attr) {
+    const auto ops = attr.get_post_ops();
+    size_t seed = 0;
+    seed = hash_combine(seed, ops.len());
+    for (int i = 0; i < ops.len(); i++)
+        seed = hash_combine(seed, static_cast<int>(ops.kind(i)));
+    return seed;
+}
+
+}  // namespace MKLDNNPlugin
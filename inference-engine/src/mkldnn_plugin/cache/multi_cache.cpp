@@ -0,0 +1,19 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_cache.h"
+
+using namespace MKLDNNPlugin;
+
+CacheEntryBase::Statistics MultiCache::getStatistics() const {
+    CacheEntryBase::Statistics total;
+    std::lock_guard<std::mutex> lock(_guard);
+    for (const auto& entry : _storage) {
+        const auto stat = entry.second->getStatistics();
+        total.hits += stat.hits;
+        total.misses += stat.misses;
+        total.size += stat.size;
+    }
+    return total;
+}
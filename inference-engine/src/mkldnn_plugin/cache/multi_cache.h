@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+#include "cache_entry.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Class that represent a preemptive cache for different key/value pair types.
+ *
+ * @attention This implementation is thread safe, so one instance may be shared between all the graphs (streams)
+ * of the same executable network.
+ */
+
+class MultiCache {
+public:
+    template<typename KeyType, typename ValueType>
+    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
+    template<typename KeyType, typename ValueType>
+    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+
+public:
+    /**
+    * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @note zero capacity means empty cache so no records are stored and no entries are created
+    */
+    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+
+    /**
+    * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
+    *       using the key and the builder functor and adds the new record to the cache
+    * @param key is the search key
+    * @param builder is a callable object that creates the ValType object from the KeyType lval reference.
+    *        Also the builder type is used for the ValueType deduction
+    * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+    */
+
+    template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreate(const KeyType& key, BuilderType builder) {
+        auto entry = getEntry<KeyType, ValueType>();
+        return entry->getOrCreate(key, std::move(builder));
+    }
+
+    /**
+     * @brief Returns the hit/miss counters and the number of stored records accumulated over all the entries
+     */
+    CacheEntryBase::Statistics getStatistics() const;
+
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    template<typename KeyType, typename ValueType>
+    EntryPtr<KeyType, ValueType> getEntry();
+
+private:
+    size_t _capacity;
+    mutable std::mutex _guard;
+    std::unordered_map<std::type_index, EntryBasePtr> _storage;
+};
+
+template<typename KeyType, typename ValueType>
+MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
+    using EntryType = EntryTypeT<KeyType, ValueType>;
+    const std::type_index typeId(typeid(EntryType));
+    std::lock_guard<std::mutex> lock(_guard);
+    auto itr = _storage.find(typeId);
+    if (itr != _storage.end()) {
+        return std::static_pointer_cast<EntryType>(itr->second);
+    }
+    auto result = std::make_shared<EntryType>(_capacity);
+    _storage.insert({typeId, result});
+    return result;
+}
+
+using MultiCachePtr = std::shared_ptr<MultiCache>;
+using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
+
+}  // namespace MKLDNNPlugin
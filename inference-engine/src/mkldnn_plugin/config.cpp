@@ -115,6 +115,59 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            rtCacheCapacity = std::max(val_i, 0);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interOpParallelism = true;
+            else if (val == PluginConfigParams::NO) interOpParallelism = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_IDENTITY_KEYS) {
+            if (val == PluginConfigParams::YES) weightsCacheIdentityKeys = true;
+            else if (val == PluginConfigParams::NO) weightsCacheIdentityKeys = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_IDENTITY_KEYS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SNIPPETS) {
+            if (val == PluginConfigParams::YES) enableSnippets = true;
+            else if (val == PluginConfigParams::NO) enableSnippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SNIPPETS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT) {
+            if (val == PluginConfigParams::YES) globalLayoutAssignment = true;
+            else if (val == PluginConfigParams::NO) globalLayoutAssignment = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION) {
+            if (val == PluginConfigParams::YES) weightsDecompression = true;
+            else if (val == PluginConfigParams::NO) weightsDecompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY_THRESHOLD
+                           << ". Expected only float numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY_THRESHOLD
+                           << ". Expected only values in the range [0, 1]";
+            sparseWeightsDensityThreshold = val_f;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -155,8 +208,35 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, std::to_string(rtCacheCapacity) });
+        if (interOpParallelism)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::NO });
+        if (weightsCacheIdentityKeys)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_IDENTITY_KEYS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_IDENTITY_KEYS, PluginConfigParams::NO });
+        if (enableSnippets)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_SNIPPETS, PluginConfigParams::NO });
+        if (globalLayoutAssignment)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT, PluginConfigParams::NO });
+        if (weightsDecompression)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION, PluginConfigParams::NO });
+        _config.insert({ PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY_THRESHOLD, std::to_string(sparseWeightsDensityThreshold) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        if (streamExecutorConfig._workStealing)
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_STREAMS_WORK_STEALING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_CPU_STREAMS_WORK_STEALING, PluginConfigParams::NO });
+        _config.insert({ PluginConfigInternalParams::KEY_CPU_STREAMS_SPIN_COUNT, std::to_string(streamExecutorConfig._spinCount) });
         IE_SUPPRESS_DEPRECATED_START
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         IE_SUPPRESS_DEPRECATED_END
@@ -26,6 +26,13 @@ struct Config {
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    size_t rtCacheCapacity = 5000ul;
+    bool interOpParallelism = false;
+    bool weightsCacheIdentityKeys = false;
+    bool enableSnippets = false;
+    bool globalLayoutAssignment = false;
+    bool weightsDecompression = false;
+    float sparseWeightsDensityThreshold = 0.f;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
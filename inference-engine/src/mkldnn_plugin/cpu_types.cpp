@@ -182,6 +182,15 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
         { "Reference", Reference},
+        { "NV12toRGB", ColorConvert},
+        { "NV12toBGR", ColorConvert},
+        { "I420toRGB", ColorConvert},
+        { "I420toBGR", ColorConvert},
+        { "Subgraph", Subgraph},
+        { "MultiHeadAttention", MultiHeadAttention},
+        { "Einsum", Einsum},
+        { "RandomUniform", RandomUniform},
+        { "RandomUniformCPU", RandomUniform},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -363,6 +372,16 @@ std::string NameFromType(const Type type) {
             return "MulticlassNms";
         case Reference:
             return "Reference";
+        case ColorConvert:
+            return "ColorConvert";
+        case Subgraph:
+            return "Subgraph";
+        case MultiHeadAttention:
+            return "MultiHeadAttention";
+        case Einsum:
+            return "Einsum";
+        case RandomUniform:
+            return "RandomUniform";
         default:
             return "Unknown";
     }
@@ -464,6 +483,10 @@ std::string algToString(const Algorithm alg) {
     CASE(MathSoftPlus);
     CASE(MathSoftsign);
     CASE(MathTan);
+    CASE(ColorConvertNV12toRGB);
+    CASE(ColorConvertNV12toBGR);
+    CASE(ColorConvertI420toRGB);
+    CASE(ColorConvertI420toBGR);
 #undef CASE
     return "Undefined";
 }
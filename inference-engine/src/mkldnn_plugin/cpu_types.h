@@ -99,7 +99,12 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    ColorConvert,
+    Subgraph,
+    MultiHeadAttention,
+    Einsum,
+    RandomUniform
 };
 
 enum Algorithm {
@@ -218,7 +223,13 @@ enum Algorithm {
     MathSinh,
     MathSoftPlus,
     MathSoftsign,
-    MathTan
+    MathTan,
+
+    // ColorConvert algorithms
+    ColorConvertNV12toRGB,
+    ColorConvertNV12toBGR,
+    ColorConvertI420toRGB,
+    ColorConvertI420toBGR
 };
 
 extern const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_to_name_tbl;
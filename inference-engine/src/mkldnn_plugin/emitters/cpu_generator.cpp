@@ -0,0 +1,110 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ie_common.h>
+
+#include "snippets/snippets_isa.hpp"
+#include "snippets/op/kernel.hpp"
+#include "snippets/op/tile.hpp"
+
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_ext_emitters.hpp"
+#include "jit_snippets_emitters.hpp"
+
+using namespace mkldnn::impl::cpu::x64;
+
+namespace MKLDNNPlugin {
+
+#define CREATE_EMITTER(e_type) [this](const std::shared_ptr<ngraph::Node>& n) \
+    -> std::shared_ptr<ngraph::snippets::Emitter> { return std::make_shared<e_type>(h.get(), isa, n); }
+
+CPUTargetMachine::CPUTargetMachine(cpu_isa_t host_isa)
+    : TargetMachine(), h(new jit_snippet()), isa(host_isa) {
+    // data movement
+    jitters[ngraph::opset1::Parameter::get_type_info_static()] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::snippets::op::BlockedParameter::get_type_info_static()] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::opset1::Result::get_type_info_static()] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::snippets::op::Nop::get_type_info_static()] = CREATE_EMITTER(NopEmitter);
+
+    jitters[ngraph::snippets::op::Load::get_type_info_static()] = CREATE_EMITTER(LoadEmitter);
+    jitters[ngraph::snippets::op::VectorLoad::get_type_info_static()] = CREATE_EMITTER(LoadEmitter);
+    jitters[ngraph::snippets::op::ScalarLoad::get_type_info_static()] = CREATE_EMITTER(ScalarLoadEmitter);
+    jitters[ngraph::snippets::op::BroadcastLoad::get_type_info_static()] = CREATE_EMITTER(BroadcastLoadEmitter);
+
+    jitters[ngraph::snippets::op::Store::get_type_info_static()] = CREATE_EMITTER(StoreEmitter);
+    jitters[ngraph::snippets::op::VectorStore::get_type_info_static()] = CREATE_EMITTER(StoreEmitter);
+    jitters[ngraph::snippets::op::ScalarStore::get_type_info_static()] = CREATE_EMITTER(ScalarStoreEmitter);
+
+    jitters[ngraph::snippets::op::Scalar::get_type_info_static()] = CREATE_EMITTER(ScalarEmitter);
+    jitters[ngraph::snippets::op::BroadcastMove::get_type_info_static()] = CREATE_EMITTER(FakeBroadcastEmitter);
+
+    // binary
+    jitters[ngraph::opset1::Add::get_type_info_static()] = CREATE_EMITTER(jit_add_emitter);
+    jitters[ngraph::opset1::Divide::get_type_info_static()] = CREATE_EMITTER(jit_divide_emitter);
+    jitters[ngraph::opset1::Equal::get_type_info_static()] = CREATE_EMITTER(jit_equal_emitter);
+    jitters[ngraph::opset1::FloorMod::get_type_info_static()] = CREATE_EMITTER(jit_floor_mod_emitter);
+    jitters[ngraph::opset1::Greater::get_type_info_static()] = CREATE_EMITTER(jit_greater_emitter);
+    jitters[ngraph::opset1::GreaterEqual::get_type_info_static()] = CREATE_EMITTER(jit_greater_equal_emitter);
+    jitters[ngraph::opset1::Less::get_type_info_static()] = CREATE_EMITTER(jit_less_emitter);
+    jitters[ngraph::opset1::LessEqual::get_type_info_static()] = CREATE_EMITTER(jit_less_equal_emitter);
+    jitters[ngraph::opset1::LogicalAnd::get_type_info_static()] = CREATE_EMITTER(jit_logical_and_emitter);
+    jitters[ngraph::opset1::LogicalOr::get_type_info_static()] = CREATE_EMITTER(jit_logical_or_emitter);
+    jitters[ngraph::opset1::LogicalXor::get_type_info_static()] = CREATE_EMITTER(jit_logical_xor_emitter);
+    jitters[ngraph::opset1::Maximum::get_type_info_static()] = CREATE_EMITTER(jit_maximum_emitter);
+    jitters[ngraph::opset1::Minimum::get_type_info_static()] = CREATE_EMITTER(jit_minimum_emitter);
+    jitters[ngraph::opset1::Mod::get_type_info_static()] = CREATE_EMITTER(jit_mod_emitter);
+    jitters[ngraph::opset1::Multiply::get_type_info_static()] = CREATE_EMITTER(jit_multiply_emitter);
+    jitters[ngraph::opset1::NotEqual::get_type_info_static()] = CREATE_EMITTER(jit_not_equal_emitter);
+    jitters[ngraph::snippets::op::PowerStatic::get_type_info_static()] = CREATE_EMITTER(jit_power_static_emitter);
+    jitters[ngraph::opset1::Power::get_type_info_static()] = CREATE_EMITTER(jit_power_dynamic_emitter);
+    jitters[ngraph::opset1::PRelu::get_type_info_static()] = CREATE_EMITTER(jit_prelu_emitter);
+    jitters[ngraph::opset1::SquaredDifference::get_type_info_static()] = CREATE_EMITTER(jit_squared_difference_emitter);
+    jitters[ngraph::opset1::Subtract::get_type_info_static()] = CREATE_EMITTER(jit_subtract_emitter);
+    jitters[ngraph::op::v0::Xor::get_type_info_static()] = CREATE_EMITTER(jit_logical_xor_emitter);
+
+    // unary
+    jitters[ngraph::opset1::Abs::get_type_info_static()] = CREATE_EMITTER(jit_abs_emitter);
+    jitters[ngraph::opset1::Clamp::get_type_info_static()] = CREATE_EMITTER(jit_clamp_emitter);
+    jitters[ngraph::opset1::Elu::get_type_info_static()] = CREATE_EMITTER(jit_elu_emitter);
+    jitters[ngraph::opset1::Erf::get_type_info_static()] = CREATE_EMITTER(jit_erf_emitter);
+    jitters[ngraph::opset1::Exp::get_type_info_static()] = CREATE_EMITTER(jit_exp_emitter);
+    jitters[ngraph::opset1::LogicalNot::get_type_info_static()] = CREATE_EMITTER(jit_logical_not_emitter);
+    jitters[ngraph::opset1::Negative::get_type_info_static()] = CREATE_EMITTER(jit_negative_emitter);
+    jitters[ngraph::opset1::Relu::get_type_info_static()] = CREATE_EMITTER(jit_relu_emitter);
+    jitters[ngraph::opset1::Sigmoid::get_type_info_static()] = CREATE_EMITTER(jit_sigmoid_emitter);
+    jitters[ngraph::opset1::Sqrt::get_type_info_static()] = CREATE_EMITTER(jit_sqrt_emitter);
+    jitters[ngraph::opset1::Tanh::get_type_info_static()] = CREATE_EMITTER(jit_tanh_emitter);
+
+    // control
+    jitters[ngraph::snippets::op::Kernel::get_type_info_static()] = CREATE_EMITTER(KernelEmitter);
+    jitters[ngraph::snippets::op::Tile::get_type_info_static()] = CREATE_EMITTER(TileEmitter);
+}
+
+bool CPUTargetMachine::is_supported() const {
+    // the snippet emitters are implemented for the AVX2 and AVX-512 register files only
+    return (isa == avx2 || isa == avx512_common) && mayiuse(isa);
+}
+
+ngraph::snippets::code CPUTargetMachine::get_snippet() const {
+    if (h->create_kernel() != mkldnn::impl::status::success) {
+        IE_THROW() << "Failed to create jit_kernel in get_snippet()";
+    }
+    return h->jit_ker();
+}
+
+size_t CPUTargetMachine::get_lanes() const {
+    switch (isa) {
+        case avx2 : return cpu_isa_traits<avx2>::vlen / sizeof(float);
+        case avx512_common : return cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+        default : IE_THROW() << "unknown isa " << isa;
+    }
+}
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : Generator(std::make_shared<CPUTargetMachine>(isa)) {
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,51 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+
+#include "snippets/generator.hpp"
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Code holder of the snippet kernel, the code is emitted by the snippets generator through the target machine emitters
+ */
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    ~jit_snippet() override = default;
+
+    jit_snippet() : jit_generator() {}
+
+    void generate() override {}
+};
+
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    explicit CPUTargetMachine(mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+/**
+ * @brief Snippets code generator for the x64 CPU. Only AVX2 and AVX-512 targets are supported.
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+};
+
+} // namespace MKLDNNPlugin
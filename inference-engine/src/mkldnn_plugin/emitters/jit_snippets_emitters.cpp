@@ -0,0 +1,283 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/variant.hpp>
+
+#include "snippets/op/broadcastmove.hpp"
+#include "snippets/op/scalar.hpp"
+
+#include <algorithm>
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto kernel = ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n);
+    if (!kernel)
+        IE_THROW() << "KernelEmitter is created for the " << n->get_type_name() << " operation";
+    code = kernel->region;
+}
+
+void KernelEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                              const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    // the kernel owns the whole register file, so there is nothing to preserve
+    emit_impl(in, out, pool, gpr, nullptr);
+}
+
+void KernelEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t num_inputs = in[0];
+    const size_t num_outputs = in[1];
+    const size_t nptrs = num_inputs + num_outputs;
+    if (nptrs > SNIPPETS_MAX_ARGS)
+        IE_THROW() << "Snippet kernel supports up to " << SNIPPETS_MAX_ARGS << " arguments, got " << nptrs;
+
+    h->preamble();
+
+    for (size_t i = 0; i < nptrs; i++)
+        h->mov(Reg64(static_cast<int>(reg64_tmp_start + i)), h->ptr[abi_param1 + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(Reg64(static_cast<int>(reg64_tmp_start + nptrs)), h->ptr[abi_param1 + GET_OFF(work_amount)]);
+
+    for (auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, {}, {});
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto tile = ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n);
+    if (!tile)
+        IE_THROW() << "TileEmitter is created for the " << n->get_type_name() << " operation";
+    code = tile->region;
+
+    std::vector<bool> used(get_max_vecs_count(), false);
+    for (const auto& c : code) {
+        for (auto idx : c.second.first)
+            if (idx < used.size()) used[idx] = true;
+        for (auto idx : c.second.second)
+            if (idx < used.size()) used[idx] = true;
+    }
+    for (size_t idx = 0; idx < used.size(); idx++)
+        if (!used[idx]) vec_pool.push_back(idx);
+}
+
+void TileEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                            const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    emit_impl(in, out, pool, gpr, nullptr);
+}
+
+void TileEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t inc = in[0];
+    const size_t nptrs = in[1];
+    Reg64 amount = Reg64(static_cast<int>(reg64_tmp_start + nptrs));
+
+    Label for_body;
+    Label for_exit;
+
+    h->cmp(amount, inc);
+    h->jl(for_exit, T_NEAR);
+
+    h->L(for_body);
+    {
+        // general purpose registers are not passed: the emitters preserve the ones they need on their own
+        for (auto& c : code)
+            c.first->emit_code(c.second.first, c.second.second, vec_pool, {});
+
+        h->sub(amount, inc);
+        h->cmp(amount, inc);
+        h->jge(for_body, T_NEAR);
+    }
+    h->L(for_exit);
+}
+
+/// BROADCAST ///
+FakeBroadcastEmitter::FakeBroadcastEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    const auto& in_shape = n->get_input_shape(0);
+    const auto& out_shape = n->get_shape();
+    use_broadcast = in_shape.empty() || out_shape.empty() || in_shape.back() != out_shape.back();
+}
+
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Unsupported isa " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src0 = Vmm(in[0]);
+    Vmm vmm_dst  = Vmm(out[0]);
+
+    if (use_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in[0]));
+    } else {
+        h->uni_vmovups(vmm_dst, vmm_src0);
+    }
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        IE_THROW() << "ScalarEmitter is created for the " << n->get_type_name() << " operation";
+    value = float2int(scalar->cast_vector<float>()[0]);
+
+    prepare_table();
+}
+
+void ScalarEmitter::register_table_entries() {
+    push_arg_entry_of("scalar", value, true);
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Unsupported isa " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end() || !it->second)
+        IE_THROW() << "Effective address is not assigned to the " << n->get_friendly_name() << " memory access operation";
+    ea = static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+}
+
+static bool isInnermostBroadcasted(const std::shared_ptr<ngraph::Node>& n) {
+    const auto& shape = n->get_input_shape(0);
+    return shape.empty() || shape.back() == 1;
+}
+
+void StoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                             const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Unsupported isa " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(static_cast<int>(ea));
+    Vmm vmm_src0 = Vmm(in[0]);
+    h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+    h->add(out_reg, get_vec_length());
+}
+
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                   const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 out_reg(static_cast<int>(ea));
+    h->uni_vmovss(h->ptr[out_reg], Xmm(in[0]));
+    h->add(out_reg, sizeof(float));
+}
+
+LoadEmitter::LoadEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n), shouldPostIncrement(!isInnermostBroadcasted(n)) {
+}
+
+void LoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Unsupported isa " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out[0]);
+    if (shouldPostIncrement) {
+        h->uni_vmovups(vmm_dst, h->ptr[in_reg]);
+        h->add(in_reg, get_vec_length());
+    } else {
+        h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+    }
+}
+
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << "Unsupported isa " << host_isa_;
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out[0]);
+    // the pointer is not advanced: the broadcasted dimension is iterated by the outer loops
+    h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+}
+
+ScalarLoadEmitter::ScalarLoadEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n), shouldPostIncrement(!isInnermostBroadcasted(n)) {
+}
+
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                  const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 in_reg(static_cast<int>(ea));
+    h->uni_vmovss(Xmm(out[0]), h->ptr[in_reg]);
+    if (shouldPostIncrement)
+        h->add(in_reg, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
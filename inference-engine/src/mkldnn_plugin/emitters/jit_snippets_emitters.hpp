@@ -0,0 +1,227 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/rt_info.hpp>
+
+#include "jit_emitter.hpp"
+
+#include "snippets/op/kernel.hpp"
+#include "snippets/op/tile.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+#define SNIPPETS_MAX_ARGS 7
+
+/**
+ * @brief Arguments of the kernel generated for a snippet: the pointers to the inputs followed by the pointers to the outputs
+ * and the number of the innermost dimension elements to process. The generated code advances the pointers on its own.
+ */
+struct jit_snippets_call_args {
+    const void* ptrs[SNIPPETS_MAX_ARGS] = {};
+    size_t work_amount = 0;
+};
+
+/**
+ * The general purpose registers are distributed by the snippets register assignment pass:
+ * r8 + i holds the pointer of the i-th kernel argument, r8 + number of arguments holds the remaining work amount.
+ */
+constexpr size_t reg64_tmp_start = 8;
+
+///
+/// \brief    Kernel is the only entry point to the generated code. It loads the arguments from the call args structure
+/// and executes the nested tiles: the vector one first and the scalar one for the tail.
+///
+class KernelEmitter : public jit_emitter {
+public:
+    KernelEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                   const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override;
+    void emit_data() const override {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+///
+/// \brief    Tile is a loop over the work amount with the increment equal to the number of lanes processed by its body.
+/// The vector registers not used by the body are passed to the emitters as auxiliary ones, so they do not spill.
+///
+class TileEmitter : public jit_emitter {
+public:
+    TileEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                   const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override;
+    void emit_data() const override {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+    std::vector<size_t> vec_pool;
+};
+
+class NopEmitter : public jit_emitter {
+public:
+    NopEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_emitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                   const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {}
+    void emit_data() const override {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override {}
+};
+
+///
+/// \brief    Broadcasts the first element of the vector if the innermost dimension is broadcasted,
+/// otherwise the broadcasting is done by the outer loops and the value is just moved.
+///
+class FakeBroadcastEmitter : public jit_emitter {
+public:
+    FakeBroadcastEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    bool use_broadcast;
+};
+
+class ScalarEmitter : public jit_emitter {
+public:
+    ScalarEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    void register_table_entries() override;
+
+    int32_t value;
+};
+
+///
+/// \brief    Memory emitters access the argument which pointer is held by the register assigned to the operation
+/// (effective address) and advance the pointer after the access. The inputs which innermost dimension is 1 are
+/// broadcasted and are not advanced.
+///
+class MemoryEmitter : public jit_emitter {
+public:
+    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+protected:
+    size_t ea;
+};
+
+class StoreEmitter : public MemoryEmitter {
+public:
+    StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class ScalarStoreEmitter : public MemoryEmitter {
+public:
+    ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+};
+
+class LoadEmitter : public MemoryEmitter {
+public:
+    LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    bool shouldPostIncrement;
+};
+
+class BroadcastLoadEmitter : public MemoryEmitter {
+public:
+    BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class ScalarLoadEmitter : public MemoryEmitter {
+public:
+    ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    bool shouldPostIncrement;
+};
+
+} // namespace MKLDNNPlugin
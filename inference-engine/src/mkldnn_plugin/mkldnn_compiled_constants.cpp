@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_compiled_constants.h"
+
+#include <cstring>
+
+namespace MKLDNNPlugin {
+
+void MKLDNNCompiledConstants::add(const std::string& key, const mkldnn::memory::desc& desc, std::vector<char>&& data) {
+    std::lock_guard<std::mutex> lock(guard);
+    records[key] = Record{desc, std::move(data), nullptr};
+}
+
+MKLDNNMemoryPtr MKLDNNCompiledConstants::get(const std::string& key, const MemoryDesc& desc, const mkldnn::engine& eng) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = records.find(key);
+    if (found == records.end())
+        return nullptr;
+
+    auto& record = found->second;
+    if (!record.memory) {
+        auto memory = std::make_shared<MKLDNNMemory>(eng);
+        memory->Create(MKLDNNExtensionUtils::makeDescriptor(record.desc), nullptr, false);
+        if (memory->GetSize() != record.data.size())
+            return nullptr;
+        std::memcpy(memory->GetData(), record.data.data(), record.data.size());
+
+        record.memory = memory;
+        // the data is kept by the memory object from now on
+        std::vector<char>().swap(record.data);
+    }
+
+    if (!record.memory->getDesc().isCompatible(desc))
+        return nullptr;
+
+    return record.memory;
+}
+
+bool MKLDNNCompiledConstants::empty() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return records.empty();
+}
+
+}  // namespace MKLDNNPlugin
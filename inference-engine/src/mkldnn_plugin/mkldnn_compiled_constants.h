@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Storage of the constant subgraphs outputs (weights in the layout selected by the graph, constant folding results)
+ * restored from the exported blob. The graph reuses a stored memory object instead of executing the constant
+ * nodes, if the descriptor of the corresponding edge matches the stored one.
+ * Memory objects are created on the first request and shared between the graphs of all the streams.
+ *
+ * Is a thread safe
+ */
+class MKLDNNCompiledConstants {
+public:
+    typedef std::shared_ptr<MKLDNNCompiledConstants> Ptr;
+
+    void add(const std::string& key, const mkldnn::memory::desc& desc, std::vector<char>&& data);
+
+    /**
+     * @brief Returns memory stored with the key or nullptr if there is no such record or it has incompatible descriptor
+     */
+    MKLDNNMemoryPtr get(const std::string& key, const MemoryDesc& desc, const mkldnn::engine& eng);
+
+    bool empty() const;
+
+private:
+    struct Record {
+        mkldnn::memory::desc desc;
+        std::vector<char> data;
+        MKLDNNMemoryPtr memory;
+    };
+
+    mutable std::mutex guard;
+    std::unordered_map<std::string, Record> records;
+};
+
+}  // namespace MKLDNNPlugin
@@ -12,6 +12,7 @@
 #include "mkldnn_itt.h"
 #include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "ngraph_transformations/expand_snippets.hpp"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -24,6 +25,8 @@
 #include <utility>
 #include <cstring>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ie_ngraph_utils.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
@@ -57,12 +60,15 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const MKLDNNCompiledConstants::Ptr &compiledConstants) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _rtParamsCache(std::make_shared<MultiCache>(cfg.rtCacheCapacity)),
+    _compiledConstants(compiledConstants),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -156,6 +162,8 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setRuntimeCache(_rtParamsCache);
+                graphLock._graph.setCompiledConstants(_compiledConstants);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -288,5 +296,20 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
-    serializer <<_network;
+    const auto& ops = _network.getFunction()->get_ops();
+    const bool hasSnippets = std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& op) {
+        return ov::is_type<ngraph::snippets::op::Subgraph>(op);
+    });
+    if (hasSnippets) {
+        // the bodies of the subgraphs are not serialized, so the original operations are exported and tokenized
+        // again on the import
+        auto network = InferenceEngine::details::cloneNetwork(_network);
+        ngraph::pass::Manager manager;
+        manager.register_pass<ExpandSnippets>();
+        manager.run_passes(network.getFunction());
+        serializer << network;
+    } else {
+        serializer << _network;
+    }
+    serializer << GetGraph()._graph.getCompiledConstants();
 }
@@ -34,7 +34,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const MKLDNNCompiledConstants::Ptr &compiledConstants = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -66,6 +67,10 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // runtime parameters cache shared between the graphs of all the streams
+    MultiCachePtr                               _rtParamsCache;
+    // constant subgraphs outputs restored from the exported blob
+    MKLDNNCompiledConstants::Ptr                _compiledConstants;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -6,12 +6,14 @@
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/random_uniform.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
 #include <ngraph_ops/nms_ie_internal.hpp>
 #include <ngraph_ops/nms_static_shape_ie.hpp>
+#include <ngraph_ops/multi_head_attention.hpp>
 
 #include <mutex>
 
@@ -37,6 +39,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         NGRAPH_OP(FullyConnectedNode, MKLDNNPlugin)
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
+        NGRAPH_OP(RandomUniformNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
 #undef NGRAPH_OP
 
@@ -104,6 +107,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         NGRAPH_OP(NonMaxSuppressionIEInternal, ngraph::op::internal)
         NGRAPH_OP(NmsStaticShapeIE<ov::op::v8::MulticlassNms>, ngraph::op::internal)
         NGRAPH_OP(NmsStaticShapeIE<ov::op::v8::MatrixNms>, ngraph::op::internal)
+        NGRAPH_OP(MultiHeadAttention, ngraph::op::internal)
 #undef NGRAPH_OP
 
         return opset;
@@ -18,6 +18,8 @@ uint8_t MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type dataType)
         return 4;
     case mkldnn::memory::data_type::bf16:
         return 2;
+    case mkldnn::memory::data_type::f16:
+        return 2;
     case mkldnn::memory::data_type::s8:
         return 1;
     case mkldnn::memory::data_type::u8:
@@ -39,6 +41,8 @@ memory::data_type MKLDNNExtensionUtils::IEPrecisionToDataType(const InferenceEng
             return memory::data_type::s32;
         case InferenceEngine::Precision::BF16:
             return memory::data_type::bf16;
+        case InferenceEngine::Precision::FP16:
+            return memory::data_type::f16;
         case InferenceEngine::Precision::I8:
             return memory::data_type::s8;
         case InferenceEngine::Precision::U8:
@@ -62,6 +66,8 @@ InferenceEngine::Precision MKLDNNExtensionUtils::DataTypeToIEPrecision(memory::d
             return InferenceEngine::Precision::I32;
         case memory::data_type::bf16:
             return InferenceEngine::Precision::BF16;
+        case memory::data_type::f16:
+            return InferenceEngine::Precision::FP16;
         case memory::data_type::s8:
             return InferenceEngine::Precision::I8;
         case memory::data_type::u8:
@@ -25,8 +25,10 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_reference_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -70,6 +72,9 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
+    if (!rtParamsCache)
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+
     Replicate(net, extMgr);
     InitGraph();
 
@@ -110,6 +115,8 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgr
 
     for (const auto op : subgraph->get_ordered_ops()) {
         const MKLDNNNodePtr node {MKLDNNNode::factory().create(op, getEngine(), extMgr, weightsCache)};
+        node->setRuntimeCache(rtParamsCache);
+        node->setWeightsCacheIdentityKeys(config.weightsCacheIdentityKeys);
         if (isQuantized()) {
             node->setQuantizedGraphFlag(true);
         }
@@ -210,6 +217,8 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     // Replicate All Nodes in topological order
     for (const auto& op : orderedOps) {
         const MKLDNNNodePtr node(MKLDNNNode::factory().create(op, getEngine(), extMgr, weightsCache));
+        node->setRuntimeCache(rtParamsCache);
+        node->setWeightsCacheIdentityKeys(config.weightsCacheIdentityKeys);
         if (isQuantized()) {
             node->setQuantizedGraphFlag(true);
         }
@@ -325,6 +334,9 @@ void MKLDNNGraph::InitGraph() {
     InitDescriptors();
     RemoveDroppedEdges();
 
+    if (config.globalLayoutAssignment)
+        AssignLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -332,6 +344,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -378,6 +392,16 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+void MKLDNNGraph::AssignLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::AssignLayouts");
+    // the descriptors of the dynamic nodes are not defined until the shapes are known
+    if (std::any_of(graphNodes.begin(), graphNodes.end(), [](const MKLDNNNodePtr& node) { return node->isDynamicNode(); }))
+        return;
+
+    layoutAssignment = true;
+    layoutAssignmentStats = MKLDNNLayoutAssignment().run(graphNodes, graphEdges);
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -386,21 +410,100 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNGraph::InitExecutionLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitExecutionLevels");
+    // The state is read and written by different MemoryInput/MemoryOutput nodes which are not connected with edges,
+    // and the dynamic nodes reallocate the output memory during the execution, so only static graphs are supported.
+    interOpParallelism = config.interOpParallelism &&
+                         std::none_of(graphNodes.begin(), graphNodes.end(), [](const MKLDNNNodePtr& node) {
+                             return node->isDynamicNode() || one_of(node->getType(), MemoryInput, MemoryOutput);
+                         });
+    if (!interOpParallelism)
+        return;
+
+    // the nodes are sorted topologically, so the levels of all the parents are already known
+    for (auto& node : graphNodes) {
+        node->execLevel = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            node->execLevel = std::max(node->execLevel, parent->execLevel + (parent->isExecutable() ? 1 : 0));
+        }
+    }
+}
+
+static MKLDNNEdgePtr getMemoryOwnerEdge(MKLDNNEdgePtr edge) {
+    while (auto sharedEdge = edge->getSharedEdge(std::nothrow))
+        edge = sharedEdge;
+    return edge;
+}
+
 void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantAndExecutableNodes");
+    // the constant node has to be executed only if some of its outputs are used and weren't restored from the exported blob
+    std::unordered_set<MKLDNNNodePtr> requiredConstantNodes;
+    for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); ++it) {
+        const auto& node = *it;
+        if (!node->isConstant())
+            continue;
+        bool required = node->getChildEdges().empty() || restoredConstantEdges.empty();
+        for (size_t i = 0; i < node->getChildEdges().size() && !required; i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto child = edge->getChild();
+            if ((!child->isConstant() || requiredConstantNodes.count(child)) &&
+                !restoredConstantEdges.count(getMemoryOwnerEdge(edge)))
+                required = true;
+        }
+        if (required)
+            requiredConstantNodes.insert(node);
+    }
+
     for (const auto& graphNode : graphNodes) {
-        if (graphNode->isConstant())
-            constantGraphNodes.emplace_back(graphNode);
-        else if (CPU_DEBUG_CAPS_ALWAYS_TRUE(graphNode->isExecutable()))
+        if (graphNode->isConstant()) {
+            if (requiredConstantNodes.count(graphNode))
+                constantGraphNodes.emplace_back(graphNode);
+        } else if (CPU_DEBUG_CAPS_ALWAYS_TRUE(graphNode->isExecutable())) {
             /* @todo
              * Revise implementation.
              * With current way it is possible that with debug_caps enabled
              * we execute a node, which is not ready to be executed
              */
             executableGraphNodes.emplace_back(graphNode);
+        }
+    }
+
+    executableNodesByLevel.clear();
+    if (interOpParallelism) {
+        for (const auto& node : executableGraphNodes) {
+            if (static_cast<size_t>(node->execLevel) >= executableNodesByLevel.size())
+                executableNodesByLevel.resize(node->execLevel + 1);
+            executableNodesByLevel[node->execLevel].push_back(node);
+        }
+        executableNodesByLevel.erase(std::remove_if(executableNodesByLevel.begin(), executableNodesByLevel.end(),
+                                                    [](const std::vector<MKLDNNNodePtr>& nodes) { return nodes.empty(); }),
+                                     executableNodesByLevel.end());
     }
 }
 
+std::map<std::string, MKLDNNMemoryCPtr> MKLDNNGraph::getCompiledConstants() const {
+    std::map<std::string, MKLDNNMemoryCPtr> constants;
+    for (const auto& node : graphNodes) {
+        if (node->isConstant() && !node->getChildEdges().empty())
+            continue;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = getMemoryOwnerEdge(node->getParentEdgeAt(i));
+            auto parent = edge->getParent();
+            // Input constants are read from the function weights anyway
+            if (!parent->isConstant() || parent->getType() == Input)
+                continue;
+            const auto& memory = edge->getMemoryPtr();
+            if (!memory || !memory->getDesc().isDefined())
+                continue;
+            constants[edge->name()] = memory;
+        }
+    }
+    return constants;
+}
+
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream(eng);
@@ -484,6 +587,8 @@ void MKLDNNGraph::InitEdges() {
 
         // optimized flag indicate that just desc update w/o actual physical memory movement.
         InsertReorder(edge, layerName, edge->getInputDesc(), edge->getOutputDesc(), isOptimized);
+        if (!isOptimized)
+            insertedReorders++;
     };
 
     auto updateEdge = [&](int& i) {
@@ -592,9 +697,13 @@ void MKLDNNGraph::AllocateWithReuse() {
         for (auto &edge : cluster) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation
                 && edge->getParent()->isConstant()) {
+                MKLDNNMemoryPtr restored;
                 if (edge->getParent()->getType() == Input) {
                     auto constNode = std::static_pointer_cast<MKLDNNInputNode>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<MKLDNNMemory>(constNode->getMemoryPtr()));
+                } else if (compiledConstants && (restored = compiledConstants->get(edge->name(), edge->getDesc(), getEngine()))) {
+                    edge->reuse(restored);
+                    restoredConstantEdges.insert(edge);
                 } else {
                     edge->externalAllocate(weightsCache);
                 }
@@ -614,13 +723,19 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // The nodes of the same level are executed simultaneously in the inter-op parallel mode,
+    // so the lifetimes are measured in the execution levels rather than in the sequential execution order
+    auto getTimestamp = [this](const MKLDNNNodePtr& node) {
+        return interOpParallelism ? node->execLevel : node->execIndex;
+    };
+
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getTimestamp(edge->getParent());
+            int e_finish = getTimestamp(edge->getChild());
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -713,6 +828,8 @@ void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        // the nodes inserted by the graph optimizer don't have the cache set yet
+        node->setRuntimeCache(rtParamsCache);
         node->createPrimitive();
     }
 }
@@ -847,14 +964,43 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.debugCaps.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (interOpParallelism) {
+        auto inferPerf = config.collectPerfCounters ? std::unique_ptr<PerfHelper>(new PerfHelper(inferPerfCounter)) : nullptr;
+
+        for (const auto& nodes : executableNodesByLevel) {
+            if (request)
+                request->ThrowIfCanceled();
+
+            if (nodes.size() == 1) {
+                const auto& node = nodes.front();
+                VERBOSE(node, config.debugCaps.verbose);
+                PERF(node, config.collectPerfCounters);
+
+                ExecuteNode(node, stream);
+                continue;
+            }
+
+            // the nested intra-op parallel regions of the nodes share the threads of the stream
+            parallel_for(nodes.size(), [&](size_t i) {
+                const auto& node = nodes[i];
+                VERBOSE(node, config.debugCaps.verbose);
+                PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
+                // the stream object must not be shared between the threads
+                mkldnn::stream nodeStream(eng);
+                ExecuteNode(node, nodeStream);
+            });
+        }
+    } else {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        ExecuteNode(node, stream);
+            if (request)
+                request->ThrowIfCanceled();
+
+            ExecuteNode(node, stream);
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -957,6 +1103,9 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
+        // the nodes on the slow path of the ngraph reference implementation are flagged with the original operation type
+        if (node->getType() == Reference)
+            pdType += "_" + std::static_pointer_cast<MKLDNNReferenceNode>(node)->getFallbackInfo();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
@@ -974,6 +1123,48 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     for (int i = 0; i < graphNodes.size(); i++) {
         getPerfMapFor(perfMap, graphNodes[i]);
     }
+
+    // The runtime cache hits/misses are reported as a separate not executed record
+    // and only in case the cache was used by the dynamic nodes
+    if (rtParamsCache) {
+        const auto stat = rtParamsCache->getStatistics();
+        if (stat.hits + stat.misses > 0) {
+            InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["RuntimeCache"];
+            pc.execution_index = i++;
+            pc.cpu_uSec = pc.realTime_uSec = 0;
+            pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+            std::string statStr = "hits:" + std::to_string(stat.hits) + " misses:" + std::to_string(stat.misses) +
+                                  " records:" + std::to_string(stat.size);
+            statStr.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]) - 1, 0);
+            std::string("RuntimeCache").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]) - 1, 0);
+        }
+    }
+
+    // The whole graph execution time is reported to compare it with the sum of the nodes execution times
+    if (interOpParallelism) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["InterOpParallelism"];
+        pc.execution_index = i++;
+        pc.cpu_uSec = pc.realTime_uSec = (long long) inferPerfCounter.avg();
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        std::string statStr = "levels:" + std::to_string(executableNodesByLevel.size()) +
+                              " nodes:" + std::to_string(executableGraphNodes.size());
+        statStr.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]) - 1, 0);
+        std::string("InterOpParallelism").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]) - 1, 0);
+    }
+
+    // The reorders of the greedy selection avoided by the layout assignment and the reorders left in the graph
+    if (layoutAssignment) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["LayoutAssignment"];
+        pc.execution_index = i++;
+        pc.cpu_uSec = pc.realTime_uSec = 0;
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        const auto& stat = layoutAssignmentStats;
+        const auto avoided = static_cast<long long>(stat.reordersBefore) - static_cast<long long>(stat.reordersAfter);
+        std::string statStr = "avoided:" + std::to_string(avoided) + " changed:" + std::to_string(stat.changedNodes) +
+                              " reorders:" + std::to_string(insertedReorders);
+        statStr.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]) - 1, 0);
+        std::string("LayoutAssignment").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]) - 1, 0);
+    }
 }
 
 void MKLDNNGraph::setConfig(const Config &cfg) {
@@ -1230,6 +1421,7 @@ void MKLDNNGraph::EnforceBF16() {
         RNNCell,        // recurent nets
         RNNSeq,         // recurent nets
         MatMul,         // bert nets
+        MultiHeadAttention, // bert nets
         ROIPooling,     // object detection nets
         Interpolate,    // super resolution nets
     };
@@ -8,13 +8,17 @@
 #include "config.h"
 #include "mkldnn_memory.h"
 #include "normalize_preprocess.h"
+#include "perf_count.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_compiled_constants.h"
+#include "mkldnn_layout_assignment.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -41,6 +45,32 @@ public:
     void setConfig(const Config &cfg);
     const Config& getConfig() const;
 
+    /**
+     * @brief Sets the runtime parameters cache to be used by the graph nodes.
+     * Must be called before CreateGraph(). If the cache is not set, the graph creates its own one.
+     */
+    void setRuntimeCache(const MultiCachePtr& cache) {
+        rtParamsCache = cache;
+    }
+
+    MultiCachePtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
+    /**
+     * @brief Sets the constant subgraphs outputs restored from the exported blob.
+     * Must be called before CreateGraph(). The constant nodes whose outputs are restored are not executed.
+     */
+    void setCompiledConstants(const MKLDNNCompiledConstants::Ptr& constants) {
+        compiledConstants = constants;
+    }
+
+    /**
+     * @brief Returns the constant subgraphs outputs consumed by the non constant part of the graph, keyed by the edge name.
+     * The result is stored to the exported blob and restored with setCompiledConstants().
+     */
+    std::map<std::string, MKLDNNMemoryCPtr> getCompiledConstants() const;
+
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
@@ -178,6 +208,10 @@ public:
 
     void SortTopologically();
 
+    bool isInterOpParallel() const {
+        return interOpParallelism;
+    }
+
     bool isQuantized() const {
         return isQuantizedFlag;
     }
@@ -198,6 +232,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        restoredConstantEdges.clear();
     }
     Status status { NotReady };
     Config config;
@@ -210,6 +245,11 @@ protected:
 
     MKLDNNMemoryPtr memWorkspace;
 
+    MultiCachePtr rtParamsCache;
+
+    MKLDNNCompiledConstants::Ptr compiledConstants;
+    std::unordered_set<MKLDNNEdgePtr> restoredConstantEdges;
+
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
@@ -226,11 +266,13 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void AssignLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitExecutionLevels();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
@@ -250,6 +292,18 @@ private:
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
+    // inter-op parallelism: the executable nodes grouped by the execution level,
+    // the nodes of one group are executed simultaneously
+    bool interOpParallelism = false;
+    std::vector<std::vector<MKLDNNNodePtr>> executableNodesByLevel;
+    PerfCount inferPerfCounter;
+
+    // graph-wide layout assignment: the reorders estimated for the greedy and the final selection
+    // and the reorders actually inserted to the graph
+    bool layoutAssignment = false;
+    MKLDNNLayoutAssignment::Statistics layoutAssignmentStats;
+    size_t insertedReorders = 0;
+
     void EnforceBF16();
 };
 
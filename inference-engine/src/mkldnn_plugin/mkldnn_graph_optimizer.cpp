@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_deconv_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
@@ -19,6 +20,7 @@
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
 #include "nodes/mkldnn_rnn.h"
+#include "nodes/mkldnn_color_convert_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -57,7 +59,17 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations",
+                       "FuseFullyConnectedAndWeightsDecompression");
+    // must precede the fusings of the eltwise nodes which would take the decompression ones
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "SetFullyConnectedSparseWeights");
+    // the sparse kernel doesn't support the post operations, so it is selected before the fusings
+    SetFullyConnectedSparseWeights(graph);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -137,6 +149,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -443,6 +459,102 @@ void MKLDNNGraphOptimizer::FuseMultiplyAndAdd(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    if (!graph.getConfig().weightsDecompression)
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConstant = [](const MKLDNNNodePtr& node, Precision precision) {
+        return node->getType() == Input && node->isConstant() && node->getOriginalOutputPrecisionAtPort(0) == precision;
+    };
+
+    // the decompression chain Input (compressed) -> Convert -> [Multiply (scale)] -> [Add (shift)] made by the ngraph
+    // transformation, the scale and the shift are the per channel constants of N elements
+    auto getPerChannelValues = [&](const MKLDNNNodePtr& eltwise, Algorithm algorithm, size_t N) -> std::vector<float> {
+        if (eltwise->getType() != Eltwise || eltwise->getAlgorithm() != algorithm || eltwise->getParentEdges().size() != 2 ||
+            eltwise->getChildEdges().size() != 1 || !eltwise->getFusedWith().empty())
+            return {};
+        auto constant = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isSuitableConstant(constant, Precision::FP32) || constant->getOutputShapeAtPort(0).getElementsCount() != N)
+            return {};
+        auto memory = dynamic_cast<MKLDNNInputNode*>(constant.get())->getMemoryPtr();
+        if (!memory)
+            return {};
+        const auto data = static_cast<const float*>(memory->GetPtr());
+        return std::vector<float>(data, data + N);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto fc = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(graphNodes[i]);
+        if (!fc || fc->getType() != FullyConnected || fc->getOutputShapeAtPort(0).isDynamic())
+            continue;
+        const size_t N = fc->getOutputShapeAtPort(0).getStaticDims().back();
+
+        std::vector<MKLDNNNodePtr> decompressionNodes;
+        auto parent = fc->getParentEdgesAtPort(1)[0]->getParent();
+        std::vector<float> shifts = getPerChannelValues(parent, EltwiseAdd, N);
+        if (!shifts.empty()) {
+            decompressionNodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        std::vector<float> scales = getPerChannelValues(parent, EltwiseMultiply, N);
+        if (!scales.empty()) {
+            decompressionNodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        } else {
+            scales.resize(N, 1.f);
+        }
+
+        if (parent->getType() != Convert || parent->getChildEdges().size() != 1 || parent->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        auto weights = parent->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weights->getOriginalOutputPrecisionAtPort(0);
+        if (!isSuitableConstant(weights, weightsPrecision) || !fc->canDecompressWeights(weightsPrecision) ||
+            weights->getOutputShapeAtPort(0).getStaticDims() != fc->getInputShapeAtPort(1).getStaticDims())
+            continue;
+        decompressionNodes.push_back(parent);
+
+        fc->setWeightsDecompression(weightsPrecision, std::move(scales), std::move(shifts));
+        for (auto& node : decompressionNodes) {
+            if (node->getType() == Eltwise) {
+                auto constEdge = node->getParentEdgesAtPort(1)[0];
+                constEdge->drop();
+                graph.RemoveEdge(constEdge);
+            }
+            fc->addOriginalLayer(node->getOriginalLayers());
+            graph.DropNode(node);
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::SetFullyConnectedSparseWeights(MKLDNNGraph &graph) {
+    const float densityThreshold = graph.getConfig().sparseWeightsDensityThreshold;
+    if (densityThreshold <= 0.f)
+        return;
+
+    for (auto& node : graph.GetNodes()) {
+        auto fc = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fc || fc->getType() != FullyConnected || fc->isDynamicNode() || !fc->canUseSparseWeights())
+            continue;
+
+        auto weights = fc->getParentEdgesAtPort(1)[0]->getParent();
+        if (weights->getType() != Input || !weights->isConstant() || weights->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        auto memory = dynamic_cast<MKLDNNInputNode*>(weights.get())->getMemoryPtr();
+        if (!memory || memory->GetDataType() != mkldnn::memory::data_type::f32)
+            continue;
+
+        const auto data = static_cast<const float*>(memory->GetPtr());
+        const size_t size = weights->getOutputShapeAtPort(0).getElementsCount();
+        if (size == 0)
+            continue;
+        const size_t nonZeros = size - std::count(data, data + size, 0.f);
+        if (static_cast<float>(nonZeros) / size < densityThreshold)
+            fc->setSparseWeights(data);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1242,6 +1354,12 @@ void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
             continue;
         }
 
+        // LayerNorm gamma and beta are read from the constants before their edges are removed
+        auto mvnNode = std::dynamic_pointer_cast<MKLDNNMVNNode>(parentNode);
+        if (mvnNode && mvnNode->canFuseGammaBeta(childNode)) {
+            mvnNode->fuseGammaBeta(childNode);
+        }
+
         childNode->fuseInto(parentNode);
 
         if (childNode->getType() == FakeQuantize || childNode->getType() == Eltwise) {
@@ -1352,6 +1470,52 @@ void MKLDNNGraphOptimizer::FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph)
     }
 }
 
+void MKLDNNGraphOptimizer::FuseColorConvertAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        if (childNode->getType() == Eltwise) {
+            auto colorConvertNode = std::dynamic_pointer_cast<MKLDNNColorConvertNode>(parentNode);
+            if (!colorConvertNode)
+                IE_THROW() << "Cannot cast " << parentNode->getName() << " to MKLDNNColorConvertNode";
+            const auto scalesAndShifts = childNode->getScalesAndShifts(parentNode.get());
+            colorConvertNode->fuseScaleShift(scalesAndShifts.first, scalesAndShifts.second);
+        }
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == ColorConvert)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -19,6 +19,8 @@ public:
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
+    void FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph);
+    void SetFullyConnectedSparseWeights(MKLDNNGraph &graph);
     void FuseConvolutionAndBias(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
@@ -32,6 +34,7 @@ private:
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph);
     void FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph);
+    void FuseColorConvertAndSimpleOperation(MKLDNNGraph &graph);
 
     void DropDoubleReorders(MKLDNNGraph& graph);
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
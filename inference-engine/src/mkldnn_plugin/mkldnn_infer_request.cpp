@@ -24,6 +24,10 @@
 #include "utils/cpu_utils.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
+static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
+    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+}
+
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
                                                      MKLDNNExecNetwork::Ptr             execNetwork_)
@@ -57,9 +61,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::CreateInferRequest() {
         MKLDNNInferRequest::GetBlob(it.first);
     }
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    // The states are bound to the storage of MemoryInput/MemoryOutput nodes of the graph
+    // instead of being copied into it before and out of it after each inference.
+    auto& bindings = memoryStateBindings[graph];
     for (auto& node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
@@ -74,7 +78,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            auto state = std::make_shared<MKLDNNVariableState>(state_name, state_store);
+            memoryStates.emplace_back(state);
+            bindings.push_back({node, memoryNode, findMemoryOutput(*graph, memoryNode->getId()), state});
         }
     }
 }
@@ -136,44 +142,68 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
+MKLDNNPlugin::MKLDNNNodePtr MKLDNNPlugin::MKLDNNInferRequest::findMemoryOutput(const MKLDNNGraph& graph, const std::string& id) {
+    for (auto& node : graph.GetNodes()) {
+        if (node->getType() == MemoryOutput) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryOutputNode*>(node.get());
+            if (memoryNode && memoryNode->getId() == id)
+                return node;
         }
     }
+    return nullptr;
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+const MKLDNNPlugin::MKLDNNInferRequest::MemoryStateBindings& MKLDNNPlugin::MKLDNNInferRequest::getMemoryStateBindings() {
+    auto found = memoryStateBindings.find(graph);
+    if (found != memoryStateBindings.end())
+        return found->second;
+
+    // Each stream has its own copy of the graph, the states created for the first one are matched by the variable id
+    const auto& prototype = memoryStateBindings.begin()->second;
+    auto& bindings = memoryStateBindings[graph];
+    for (auto& node : graph->GetNodes()) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+        if (!memoryNode) {
+            IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+        }
+        auto binding = std::find_if(prototype.begin(), prototype.end(), [&](const MemoryStateBinding& b) {
+            return b.memoryInput->getId() == memoryNode->getId();
+        });
+        if (binding == prototype.end())
+            IE_THROW() << "Cannot find variable state for " << node->getName();
+        bindings.push_back({node, memoryNode, findMemoryOutput(*graph, memoryNode->getId()), binding->state});
+    }
+    return bindings;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::bindStates() {
+    for (const auto& binding : getMemoryStateBindings()) {
+        const auto& current = binding.state->getCurrent();
+        const auto& next = binding.state->getNext();
+        binding.memoryInput->bindState(current, next);
+
+        // the consumers read the current state directly if they can work with an external buffer
+        const auto& input = binding.input;
+        if (input->getChildEdgeAt(0)->getMemory().GetData() != current->GetData() && canChangeInputPtr(input)) {
+            for (size_t i = 0; i < input->getChildEdges().size(); i++)
+                changeEdgePtr(input->getChildEdgeAt(i), current->GetData());
         }
+
+        // the producer writes the next state directly unless its output is shared with a graph input
+        if (!binding.output || binding.output->getParentEdgeAt(0)->getMemory().GetData() == next->GetData())
+            continue;
+        auto producer = getInPlaceProducer(binding.output);
+        if (producer && !one_of(producer->getType(), Input, MemoryInput))
+            changeEdgePtr(binding.output->getParentEdgeAt(0), next->GetData());
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::commitStates() {
+    for (const auto& binding : getMemoryStateBindings()) {
+        if (binding.memoryInput->isNextStateStored())
+            binding.state->commit();
     }
 }
 
@@ -204,19 +234,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     changeDefaultPtr();
 
+    if (!memoryStates.empty())
+        bindStates();
+
     ThrowIfCanceled();
 
     PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
-    }
-
     graph->Infer(this, m_curBatch);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
+    if (!memoryStates.empty())
+        commitStates();
 
     ThrowIfCanceled();
 
@@ -493,8 +521,51 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
 }
 
-static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
-    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+bool MKLDNNPlugin::MKLDNNInferRequest::canChangeInputPtr(const MKLDNNNodePtr& input) {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        if (split)
+            return false;
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    input->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
+MKLDNNPlugin::MKLDNNNodePtr MKLDNNPlugin::MKLDNNInferRequest::getInPlaceProducer(const MKLDNNNodePtr& output) {
+    void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return nullptr;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return parent;
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
@@ -503,33 +574,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (input != graph->GetInputNodesMap().end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
+            if (canChangeInputPtr(input->second)) {
+                for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
+                    changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
                 }
             }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
-            }
             continue;
         }
 
@@ -543,26 +592,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (output) {
             if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (getInPlaceProducer(output))
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
             continue;
         }
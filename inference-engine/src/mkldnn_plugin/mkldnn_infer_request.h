@@ -8,12 +8,16 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNVariableState;
+class MKLDNNMemoryInputNode;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -54,18 +58,36 @@ public:
 private:
     void CreateInferRequest();
     void PushInputData();
-    void PushStates();
-    void PullStates();
+    void bindStates();
+    void commitStates();
     void redefineMemoryForInputNodes();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    static bool canChangeInputPtr(const MKLDNNNodePtr& input);
+    static MKLDNNNodePtr getInPlaceProducer(const MKLDNNNodePtr& output);
+
+    /**
+     * @brief Variable state bound to the MemoryInput node and its paired MemoryOutput node (may be absent)
+     */
+    struct MemoryStateBinding {
+        MKLDNNNodePtr input;
+        MKLDNNMemoryInputNode* memoryInput;
+        MKLDNNNodePtr output;
+        std::shared_ptr<MKLDNNVariableState> state;
+    };
+    using MemoryStateBindings = std::vector<MemoryStateBinding>;
+
+    const MemoryStateBindings& getMemoryStateBindings();
+    static MKLDNNNodePtr findMemoryOutput(const MKLDNNGraph& graph, const std::string& id);
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::unordered_map<const MKLDNNGraph*, MemoryStateBindings> memoryStateBindings;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
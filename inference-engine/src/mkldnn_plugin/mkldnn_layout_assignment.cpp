@@ -0,0 +1,327 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_assignment.h"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_set>
+#include <utility>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// The implementations of the same type are listed from the preferred one. The later ones are penalized by a small
+// fraction of the output size, so the reorders dominate the choice as in the greedy selection and the preferred
+// descriptor wins the tie.
+constexpr double kernelPenalty = 1.0 / 64;
+constexpr size_t maxSweeps = 10;
+
+bool isFullyDefined(const NodeConfig& config) {
+    auto isDefinedPort = [](const PortConfig& port) {
+        return port.inPlace < 0 && port.desc && port.desc->isDefined();
+    };
+    return std::all_of(config.inConfs.begin(), config.inConfs.end(), isDefinedPort) &&
+           std::all_of(config.outConfs.begin(), config.outConfs.end(), isDefinedPort);
+}
+
+double outputBytes(const NodeConfig& config) {
+    double bytes = 0;
+    for (const auto& port : config.outConfs)
+        bytes += port.desc->getCurrentMemSize();
+    return bytes;
+}
+
+// The ports are resolved the same way as the greedy selection does
+const MemoryDesc* edgeDesc(const std::vector<PortConfig>& ports, int port, bool clamp) {
+    if (port < 0 || port >= ports.size()) {
+        if (!clamp || ports.empty())
+            return nullptr;
+        port = 0;
+    }
+    const auto& desc = ports[port].desc;
+    return desc && desc->isDefined() ? desc.get() : nullptr;
+}
+
+// The reorder is executed on each inference, its cost is the size of the tensor read and written plus the unit of
+// the fixed overhead, so the reorders of the empty tensors are counted as well
+double reorderCost(const NodeConfig& parentConfig, const NodeConfig& childConfig, const MKLDNNEdgePtr& edge) {
+    const auto* parentDesc = edgeDesc(parentConfig.outConfs, edge->getInputNum(), true);
+    const auto* childDesc = edgeDesc(childConfig.inConfs, edge->getOutputNum(), false);
+    if (!parentDesc || !childDesc || childDesc->isCompatible(*parentDesc))
+        return 0;
+    return 2.0 * parentDesc->getCurrentMemSize() + 1;
+}
+
+size_t countReorders(const std::vector<MKLDNNEdgePtr>& graphEdges) {
+    size_t reorders = 0;
+    for (const auto& edge : graphEdges) {
+        const auto parent = edge->getParent();
+        const auto child = edge->getChild();
+        // the reorders on the constant edges are executed once on the network loading
+        if (parent->isConstant())
+            continue;
+        const auto* parentPd = parent->getSelectedPrimitiveDescriptor();
+        const auto* childPd = child->getSelectedPrimitiveDescriptor();
+        if (parentPd && childPd && reorderCost(parentPd->getConfig(), childPd->getConfig(), edge) > 0)
+            reorders++;
+    }
+    return reorders;
+}
+
+}  // namespace
+
+MKLDNNLayoutAssignment::Statistics MKLDNNLayoutAssignment::run(const std::vector<MKLDNNNodePtr>& graphNodes,
+                                                               const std::vector<MKLDNNEdgePtr>& graphEdges) {
+    Statistics stats;
+    stats.reordersBefore = stats.reordersAfter = countReorders(graphEdges);
+
+    variables.clear();
+    factors.clear();
+    variableIndex.clear();
+    collectVariables(graphNodes);
+    if (variables.empty())
+        return stats;
+    collectFactors(graphEdges);
+
+    std::vector<bool> visited(variables.size(), false);
+    for (size_t root = 0; root < variables.size(); root++) {
+        if (visited[root])
+            continue;
+        std::vector<size_t> component{root};
+        visited[root] = true;
+        size_t componentFactors = 0;
+        for (size_t i = 0; i < component.size(); i++) {
+            for (auto f : variables[component[i]].factors) {
+                const auto next = factors[f].other(component[i]);
+                if (!visited[next]) {
+                    visited[next] = true;
+                    component.push_back(next);
+                }
+                componentFactors++;
+            }
+        }
+        // each factor is counted from both of its variables
+        componentFactors /= 2;
+
+        const double greedyCost = componentCost(component);
+        if (componentFactors + 1 == component.size())
+            solveTree(component);
+        else
+            solveCoordinateDescent(component);
+
+        if (!(componentCost(component) < greedyCost)) {
+            for (auto var : component)
+                variables[var].selected = variables[var].initial;
+        }
+    }
+
+    for (auto& var : variables) {
+        if (var.selected != var.initial) {
+            var.node->selectPrimitiveDescriptorByIndex(var.candidates[var.selected]);
+            stats.changedNodes++;
+        }
+    }
+    if (stats.changedNodes > 0)
+        stats.reordersAfter = countReorders(graphEdges);
+
+    return stats;
+}
+
+void MKLDNNLayoutAssignment::collectVariables(const std::vector<MKLDNNNodePtr>& graphNodes) {
+    for (const auto& node : graphNodes) {
+        // Concat and Split choose the descriptors to be executed in place, so their selection is kept
+        if (node->isConstant() || one_of(node->getType(), Concatenation, Split))
+            continue;
+        const auto* selectedPd = node->getSelectedPrimitiveDescriptor();
+        if (!selectedPd || !isFullyDefined(selectedPd->getConfig()))
+            continue;
+
+        Variable var;
+        var.node = node;
+        const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+        for (size_t i = 0; i < supportedPds.size(); i++) {
+            const auto& pd = supportedPds[i];
+            if (pd.getImplementationType() != selectedPd->getImplementationType() || !isFullyDefined(pd.getConfig()) ||
+                    pd.getConfig().inConfs.size() > node->getParentEdges().size())
+                continue;
+            if (&pd == selectedPd)
+                var.selected = var.initial = var.candidates.size();
+            var.cost.push_back(kernelPenalty * var.candidates.size() * outputBytes(pd.getConfig()));
+            var.candidates.push_back(static_cast<int>(i));
+        }
+        if (var.candidates.size() < 2)
+            continue;
+
+        variableIndex[node.get()] = variables.size();
+        variables.push_back(std::move(var));
+    }
+}
+
+void MKLDNNLayoutAssignment::collectFactors(const std::vector<MKLDNNEdgePtr>& graphEdges) {
+    auto findVariable = [&](const MKLDNNNodePtr& node) -> Variable* {
+        auto it = variableIndex.find(node.get());
+        return it == variableIndex.end() ? nullptr : &variables[it->second];
+    };
+    auto candidateConfig = [](const Variable& var, size_t choice) -> const NodeConfig& {
+        return var.node->getSupportedPrimitiveDescriptors()[var.candidates[choice]].getConfig();
+    };
+
+    std::map<std::pair<size_t, size_t>, size_t> factorIndex;
+    for (const auto& edge : graphEdges) {
+        const auto parent = edge->getParent();
+        const auto child = edge->getChild();
+        if (parent->isConstant())
+            continue;
+        auto* parentVar = findVariable(parent);
+        auto* childVar = findVariable(child);
+
+        if (parentVar && childVar) {
+            const auto parentId = variableIndex[parent.get()];
+            const auto childId = variableIndex[child.get()];
+            const auto key = std::make_pair(std::min(parentId, childId), std::max(parentId, childId));
+            auto it = factorIndex.find(key);
+            if (it == factorIndex.end()) {
+                Factor factor;
+                factor.first = key.first;
+                factor.second = key.second;
+                factor.cost.assign(variables[key.first].candidates.size(),
+                                   std::vector<double>(variables[key.second].candidates.size(), 0));
+                it = factorIndex.emplace(key, factors.size()).first;
+                variables[key.first].factors.push_back(factors.size());
+                variables[key.second].factors.push_back(factors.size());
+                factors.push_back(std::move(factor));
+            }
+            auto& factor = factors[it->second];
+            for (size_t p = 0; p < parentVar->candidates.size(); p++) {
+                for (size_t c = 0; c < childVar->candidates.size(); c++) {
+                    const double cost = reorderCost(candidateConfig(*parentVar, p), candidateConfig(*childVar, c), edge);
+                    if (parentId == factor.first)
+                        factor.cost[p][c] += cost;
+                    else
+                        factor.cost[c][p] += cost;
+                }
+            }
+        } else if (parentVar) {
+            const auto* childPd = child->getSelectedPrimitiveDescriptor();
+            if (!childPd)
+                continue;
+            for (size_t p = 0; p < parentVar->candidates.size(); p++)
+                parentVar->cost[p] += reorderCost(candidateConfig(*parentVar, p), childPd->getConfig(), edge);
+        } else if (childVar) {
+            const auto* parentPd = parent->getSelectedPrimitiveDescriptor();
+            if (!parentPd)
+                continue;
+            for (size_t c = 0; c < childVar->candidates.size(); c++)
+                childVar->cost[c] += reorderCost(parentPd->getConfig(), candidateConfig(*childVar, c), edge);
+        }
+    }
+}
+
+void MKLDNNLayoutAssignment::solveTree(const std::vector<size_t>& component) {
+    // the breadth first order from the root, so the children precede the parents in the reversed order
+    const auto root = component.front();
+    std::vector<size_t> order{root};
+    std::unordered_map<size_t, size_t> parentFactor;
+    std::unordered_set<size_t> visited{root};
+    for (size_t i = 0; i < order.size(); i++) {
+        for (auto f : variables[order[i]].factors) {
+            const auto next = factors[f].other(order[i]);
+            if (visited.insert(next).second) {
+                parentFactor[next] = f;
+                order.push_back(next);
+            }
+        }
+    }
+
+    // subtreeCost[var][choice] is the minimal cost of the subtree of the variable with the given choice,
+    // bestChoice[var][parentChoice] is the choice of the variable giving this minimum for the choice of its parent
+    std::unordered_map<size_t, std::vector<double>> subtreeCost;
+    std::unordered_map<size_t, std::vector<size_t>> bestChoice;
+    for (auto var : component)
+        subtreeCost[var] = variables[var].cost;
+
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        const auto var = *it;
+        if (var == root)
+            continue;
+        const auto& factor = factors[parentFactor[var]];
+        const auto parent = factor.other(var);
+        const auto& varCost = subtreeCost[var];
+        auto& parentCost = subtreeCost[parent];
+        auto& varBest = bestChoice[var];
+        varBest.resize(parentCost.size());
+        for (size_t p = 0; p < parentCost.size(); p++) {
+            // the current choice wins the tie
+            size_t minChoice = variables[var].selected;
+            double minCost = varCost[minChoice] + factor.get(var, minChoice, p);
+            for (size_t c = 0; c < varCost.size(); c++) {
+                const double cost = varCost[c] + factor.get(var, c, p);
+                if (cost < minCost) {
+                    minCost = cost;
+                    minChoice = c;
+                }
+            }
+            parentCost[p] += minCost;
+            varBest[p] = minChoice;
+        }
+    }
+
+    const auto& rootCost = subtreeCost[root];
+    auto& rootVar = variables[root];
+    for (size_t c = 0; c < rootCost.size(); c++) {
+        if (rootCost[c] < rootCost[rootVar.selected])
+            rootVar.selected = c;
+    }
+    for (auto var : order) {
+        if (var != root)
+            variables[var].selected = bestChoice[var][variables[factors[parentFactor[var]].other(var)].selected];
+    }
+}
+
+void MKLDNNLayoutAssignment::solveCoordinateDescent(const std::vector<size_t>& component) {
+    // the variables are visited in the topological order, each step does not increase the cost
+    std::vector<size_t> sorted(component);
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (auto var : sorted) {
+            auto& variable = variables[var];
+            double minCost = localCost(var, variable.selected);
+            for (size_t c = 0; c < variable.candidates.size(); c++) {
+                const double cost = localCost(var, c);
+                if (cost < minCost) {
+                    minCost = cost;
+                    variable.selected = c;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
+double MKLDNNLayoutAssignment::localCost(size_t var, size_t choice) const {
+    double cost = variables[var].cost[choice];
+    for (auto f : variables[var].factors) {
+        const auto& factor = factors[f];
+        cost += factor.get(var, choice, variables[factor.other(var)].selected);
+    }
+    return cost;
+}
+
+double MKLDNNLayoutAssignment::componentCost(const std::vector<size_t>& component) const {
+    double cost = 0;
+    for (auto var : component) {
+        cost += variables[var].cost[variables[var].selected];
+        for (auto f : variables[var].factors) {
+            if (factors[f].first == var)
+                cost += factors[f].get(var, variables[var].selected, variables[factors[f].second].selected);
+        }
+    }
+    return cost;
+}
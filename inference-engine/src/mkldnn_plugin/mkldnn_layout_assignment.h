@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+#include "mkldnn_edge.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Graph-wide selection of the primitive descriptors which refines the greedy node-by-node selection.
+ * Each node with several fully defined descriptors of the selected implementation type is a variable, the cost of
+ * the assignment is the sum of the kernel costs of the selected descriptors and of the reorders on the edges where
+ * the descriptors of the parent and the child are incompatible. The connected components which are chains or trees
+ * are solved exactly by dynamic programming, the other ones by the coordinate descent started from the greedy
+ * selection, so the estimated cost never exceeds the one of the greedy selection.
+ *
+ * Must be called after the greedy selection of the primitive descriptors and before the edges initialization.
+ */
+class MKLDNNLayoutAssignment {
+public:
+    struct Statistics {
+        // the reorders on the non constant edges estimated for the greedy and for the final selection
+        size_t reordersBefore = 0;
+        size_t reordersAfter = 0;
+        size_t changedNodes = 0;
+    };
+
+    Statistics run(const std::vector<MKLDNNNodePtr>& graphNodes, const std::vector<MKLDNNEdgePtr>& graphEdges);
+
+private:
+    struct Variable {
+        MKLDNNNodePtr node;
+        // indexes of the supported primitive descriptors and their costs including the reorders to the fixed nodes
+        std::vector<int> candidates;
+        std::vector<double> cost;
+        std::vector<size_t> factors;
+        size_t selected = 0;
+        size_t initial = 0;
+    };
+
+    // the reorders cost of all the edges between two variables, the first one has the lower index
+    struct Factor {
+        size_t first;
+        size_t second;
+        std::vector<std::vector<double>> cost;
+
+        size_t other(size_t var) const { return var == first ? second : first; }
+        double get(size_t var, size_t varChoice, size_t otherChoice) const {
+            return var == first ? cost[varChoice][otherChoice] : cost[otherChoice][varChoice];
+        }
+    };
+
+    void collectVariables(const std::vector<MKLDNNNodePtr>& graphNodes);
+    void collectFactors(const std::vector<MKLDNNEdgePtr>& graphEdges);
+    void solveTree(const std::vector<size_t>& component);
+    void solveCoordinateDescent(const std::vector<size_t>& component);
+    double componentCost(const std::vector<size_t>& component) const;
+    double localCost(size_t var, size_t choice) const;
+
+    std::vector<Variable> variables;
+    std::vector<Factor> factors;
+    std::unordered_map<const MKLDNNNode*, size_t> variableIndex;
+};
+
+}  // namespace MKLDNNPlugin
@@ -10,8 +10,35 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
-void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+MKLDNNVariableState::MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+        InferenceEngine::IVariableStateInternal{name} {
+    current = std::make_shared<MKLDNNMemory>(storage->getEngine());
+    current->Create(storage->getDesc());
+    cpu_memcpy(current->GetData(), storage->GetData(), storage->GetSize());
+
+    next = std::make_shared<MKLDNNMemory>(storage->getEngine());
+    next->Create(storage->getDesc());
+}
+
+void MKLDNNVariableState::Reset() {
+    current->FillZero();
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState || newState->cbuffer().as<const void*>() == nullptr)
+        IE_THROW() << "Variable state " << name << " cannot be set from an empty blob";
+    if (newState->byteSize() != current->GetSize())
+        IE_THROW() << "Variable state " << name << " has size " << current->GetSize()
+                   << " bytes, but the blob has " << newState->byteSize() << " bytes";
+
+    cpu_memcpy(current->GetData(), newState->cbuffer().as<const void*>(), current->GetSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    auto snapshot = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(current->getDesc()));
+    snapshot->allocate();
+    cpu_memcpy(snapshot->buffer(), current->GetData(), current->GetSize());
+    return snapshot;
 }
 
 }  // namespace MKLDNNPlugin
@@ -14,16 +14,37 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Variable state keeping two buffers with the layout of the MemoryInput storage.
+ * The graph reads the current buffer and writes the next one, commit() swaps them by pointer.
+ * The data is copied only when the state is accessed through the IVariableStateInternal API.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const MKLDNNMemoryPtr& getCurrent() const {
+        return current;
+    }
+
+    const MKLDNNMemoryPtr& getNext() const {
+        return next;
+    }
+
+    /**
+     * @brief Makes the state written by the last inference the current one
+     */
+    void commit() {
+        std::swap(current, next);
+    }
+
+private:
+    MKLDNNMemoryPtr current;
+    MKLDNNMemoryPtr next;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -78,6 +78,7 @@ MKLDNNNode::MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::en
           type(TypeFromName(op->get_type_name())), profiling(op->get_friendly_name()) {
     algorithm = Algorithm::Default;
     fusingPort = -1;
+    originalOpIdentity = op.get();
     const std::string errorPrefix = "Ngraph operation " + std::string(op->get_type_name()) + " with name " + op->get_friendly_name();
 
     for (size_t i = 0; i < op->get_input_size(); i++) {
@@ -405,6 +406,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(uni);
 
     SEARCH_TYPE(winograd);
+    SEARCH_TYPE(sparse);
     SEARCH_TYPE(_dw);
     SEARCH_TYPE(_1x1);
 
@@ -746,12 +748,19 @@ void MKLDNNNode::prepareMemory(const NodeDesc *selected_pd, mkldnn::primitive_de
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            std::string data_key;
+            if (weightsCacheIdentityKeys && originalOpIdentity) {
+                // the blob is built from the constant inputs of the same operation in the graphs of all the streams
+                char op_ptr[32];
+                snprintf(op_ptr, sizeof op_ptr, "%p", originalOpIdentity);
+                data_key = std::string(internalBlob->getTensorDesc().getPrecision().name()) + "_" + op_ptr;
+            } else {
+                data_key = std::to_string(weightCache->GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize()));
+            }
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+                                            + "_" + data_key;
 
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
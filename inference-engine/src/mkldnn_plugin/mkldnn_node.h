@@ -19,6 +19,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "cache/multi_cache.h"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 #include "utils/ngraph_utils.hpp"
@@ -570,6 +571,18 @@ public:
     */
     std::pair<std::vector<float>, std::vector<float>> getScalesAndShifts(const MKLDNNNode *parentNode) const;
 
+    void setRuntimeCache(MultiCachePtr cache) {
+        rtParamsCache = cache;
+    }
+
+    /**
+     * @brief Makes the node to identify its internal blobs in the weights cache by the source ngraph operation
+     * instead of hashing the blobs content. The operation is shared by the graphs of all the streams.
+     */
+    void setWeightsCacheIdentityKeys(bool value) {
+        weightsCacheIdentityKeys = value;
+    }
+
 protected:
     bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const;
 
@@ -728,6 +741,16 @@ protected:
     std::vector<VectorDims> lastInputDims = {};
     std::shared_ptr<ngraph::Node> opToShapeInfer;
 
+    /**
+     * @brief Returns the runtime parameters cache shared between the graphs of the executable network.
+     * Nodes use it in prepareParams() to reuse primitives (executors) already compiled for the same input shapes.
+     */
+    MultiCachePtr getRuntimeCache() const {
+        if (!rtParamsCache)
+            IE_THROW() << "Runtime cache is not set for node " << getName() << ".";
+        return rtParamsCache;
+    }
+
 private:
     std::vector<MKLDNNEdgeWeakPtr> parentEdges;
     std::vector<MKLDNNEdgeWeakPtr> childEdges;
@@ -743,12 +766,20 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    // the longest path (in executable nodes) from the graph inputs, the nodes of the same level are independent
+    int execLevel = -1;
 
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
     PerfCounters profiling;
 
+    MultiCachePtr rtParamsCache;
+
+    // identity of the source ngraph operation, must not be dereferenced
+    const void* originalOpIdentity = nullptr;
+    bool weightsCacheIdentityKeys = false;
+
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
 
     void createShapeInferSubgraph(const std::shared_ptr<ngraph::Node>& op);
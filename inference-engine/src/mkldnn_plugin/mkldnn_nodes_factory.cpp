@@ -80,6 +80,11 @@
 #include "nodes/mkldnn_reduce_node.h"
 #include "nodes/mkldnn_if_node.h"
 #include "nodes/mkldnn_ctc_greedy_decoder_node.h"
+#include "nodes/mkldnn_color_convert_node.h"
+#include "nodes/mkldnn_subgraph_node.h"
+#include "nodes/mkldnn_mha_node.h"
+#include "nodes/mkldnn_einsum_node.h"
+#include "nodes/mkldnn_random_uniform_node.h"
 
 #define MKLDNN_NODE(__prim, __type) \
     registerNodeIfRequired(MKLDNNPlugin, __prim, __type, MKLDNNNodeImpl<__prim>)
@@ -168,4 +173,9 @@ MKLDNNPlugin::MKLDNNNode::NodesFactory::NodesFactory()
     MKLDNN_NODE(MKLDNNTopKNode, TopK);
     MKLDNN_NODE(MKLDNNStridedSliceNode, StridedSlice);
     MKLDNN_NODE(MKLDNNGRNNode, GRN);
+    MKLDNN_NODE(MKLDNNColorConvertNode, ColorConvert);
+    MKLDNN_NODE(MKLDNNSnippetNode, Subgraph);
+    MKLDNN_NODE(MKLDNNMultiHeadAttentionNode, MultiHeadAttention);
+    MKLDNN_NODE(MKLDNNEinsumNode, Einsum);
+    MKLDNN_NODE(MKLDNNRandomUniformNode, RandomUniform);
 }
@@ -35,6 +35,7 @@
 #include <transformations/common_optimizations/nop_elimination.hpp>
 #include <transformations/common_optimizations/wrap_interpolate_into_transposes.hpp>
 #include <transformations/common_optimizations/transpose_sinking.hpp>
+#include <transformations/common_optimizations/mha_fusion.hpp>
 #include <transformations/op_conversions/convert_broadcast_to_tiles.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_shuffle_channels3.hpp>
@@ -55,6 +56,7 @@
 #include <transformations/op_conversions/convert_sequences_to_tensor_iterator.hpp>
 #include <transformations/op_conversions/convert_subtract.hpp>
 #include <transformations/op_conversions/softmax_decomposition.hpp>
+#include <transformations/op_conversions/einsum_decomposition.hpp>
 #include <transformations/control_flow/unroll_tensor_iterator.hpp>
 #include <transformations/op_conversions/convert_mod.hpp>
 #include <transformations/op_conversions/convert_ti_to_sequences.hpp>
@@ -82,9 +84,11 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/graph_util.hpp>
+#include <ngraph/rt_info.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -105,7 +109,17 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_normalize_node.h"
+#include "nodes/mkldnn_einsum_node.h"
+#include "nodes/mkldnn_subgraph_node.h"
+#include "nodes/mkldnn_mha_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/random_uniform.hpp"
+#include "ngraph_transformations/add_preprocessing.hpp"
+#include "ngraph_transformations/shift_scale_weights_fusion.hpp"
+#include "ngraph_transformations/weights_decompression.hpp"
+#include "ngraph_transformations/expand_snippets.hpp"
+#include <snippets/pass/collapse_subgraph.hpp>
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -131,7 +145,8 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT) {
+static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
+                                               const bool _enableWeightsDecompression, const bool _enableBF16) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -142,6 +157,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else if (_enableWeightsDecompression) {
+        // the compressed MatMul weights are kept as is up to the FullyConnected node which decompresses them on the fly
+        manager.register_pass<MarkWeightsDecompression>();
     }
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -165,7 +183,34 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     static const auto precisions = get_convert_precisions();
 
+    // RandomUniform only takes the precision of its output, the node generates the sequence of the original type.
+    // The operation is replaced by the CPU one, which keeps the original type as an attribute exported with the network.
+    type_to_fuse_map type_to_fuse = {
+        {ngraph::opset8::RandomUniform::get_type_info_static(),
+         [](const std::shared_ptr<ngraph::Node>& node, ngraph::element::Type to, size_t idx) {
+            auto randomUniform = ngraph::as_type_ptr<ngraph::opset8::RandomUniform>(node);
+            if (!randomUniform)
+                return false;
+            auto cpuRandomUniform = std::make_shared<MKLDNNPlugin::RandomUniformNode>(randomUniform->input_value(0),
+                                                                                      randomUniform->input_value(1),
+                                                                                      randomUniform->input_value(2),
+                                                                                      to,
+                                                                                      randomUniform->get_out_type(),
+                                                                                      randomUniform->get_global_seed(),
+                                                                                      randomUniform->get_op_seed());
+            cpuRandomUniform->set_friendly_name(randomUniform->get_friendly_name());
+            ngraph::copy_runtime_info(randomUniform, cpuRandomUniform);
+            ngraph::replace_node(randomUniform, cpuRandomUniform);
+            return true;
+        }}};
+
     manager.register_pass<ngraph::pass::CommonOptimizations>();
+    // the shift and scale of the Parameters (e.g. the mean and scale preprocessing) are folded to the weights of the
+    // first layer, the other Add and Multiply nodes are left to the eltwise fusing of the graph
+    auto shiftScaleFusion = manager.register_pass<ngraph::pass::GraphRewrite>();
+    shiftScaleFusion->add_matcher<AddConvolutionFusion>();
+    shiftScaleFusion->add_matcher<AddMatMulFusion>();
+    shiftScaleFusion->add_matcher<MultiplyMatMulFusion>();
     manager.register_pass<ngraph::pass::WrapInterpolateIntoTransposes>();
     manager.register_pass<ngraph::pass::TransposeSinking>();
     manager.register_pass<ngraph::pass::ConvertRNNSequenceToTensorIterator>();
@@ -193,7 +238,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
     }
     manager.register_pass<ngraph::pass::Validate>();
-    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions);
+    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions, type_to_fuse);
     manager.register_pass<ngraph::pass::EliminateConvert>();
 
     auto pass_config = manager.get_pass_config();
@@ -302,6 +347,12 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                 return MKLDNNNormalizeL2Node::isSupportedOperation(node, errorMsg);
             });
 
+    pass_config->set_callback<ngraph::pass::EinsumDecomposition>(
+            [](const_node_ptr &node) -> bool {
+                std::string errorMsg;
+                return !MKLDNNEinsumNode::isDecomposable(node) && MKLDNNEinsumNode::isSupportedOperation(node, errorMsg);
+            });
+
     pass_config->enable<ngraph::pass::SoftmaxDecomposition>();
     pass_config->set_callback<ngraph::pass::SoftmaxDecomposition>(
             [](const_node_ptr &node) -> bool {
@@ -431,9 +482,17 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 
     ngraph::pass::Manager postLPTPassManager;
+    // the attention node has the FP32 kernel only, so in BF16 mode and on the platforms without AVX-512 the attention
+    // stays on the oneDNN MatMuls, the quantized attention too as the callback rejects its u8/i8 inputs
+    if (with_cpu_x86_avx512_core() && !_enableBF16)
+        postLPTPassManager.register_pass<ngraph::pass::MHAFusion>();
     postLPTPassManager.register_pass<ngraph::pass::FakeQuantizeDecomposition>();
     postLPTPassManager.register_pass<ngraph::pass::UnrollTensorIterator>();
 
+    postLPTPassManager.get_pass_config()->set_callback<ngraph::pass::MHAFusion>([](const_node_ptr &node) -> bool {
+        std::string errMsg;
+        return !MKLDNNMultiHeadAttentionNode::isSupportedOperation(node, errMsg);
+    });
     postLPTPassManager.get_pass_config()->set_callback<ngraph::pass::FakeQuantizeDecomposition>([](const_node_ptr &node) -> bool {
         std::string errMsg;
         return MKLDNNFakeQuantizeNode::isSupportedOperation(node, errMsg);
@@ -446,12 +505,39 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     postLPTPassManager.run_passes(nGraphFunc);
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableWeightsDecompression,
+                           const bool _enableBF16) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableWeightsDecompression, _enableBF16);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
+static void SnippetsTransformation(std::shared_ptr<ngraph::Function> nGraphFunc) {
+    ngraph::pass::Manager snippetsManager;
+    snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+    // the eltwise operations following these ones are fused into them as post ops by the graph optimizer
+    snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                    ngraph::snippets::pass::AttachToSubgraph>(
+            [](const std::shared_ptr<const ngraph::Node>& node) -> bool {
+                for (const auto& input : node->inputs()) {
+                    const auto parent = input.get_source_output().get_node();
+                    if (ov::is_type<ngraph::opset1::Convolution>(parent) ||
+                        ov::is_type<ngraph::opset1::GroupConvolution>(parent) ||
+                        ov::is_type<ngraph::opset1::ConvolutionBackpropData>(parent) ||
+                        ov::is_type<ngraph::opset1::MatMul>(parent) ||
+                        ov::is_type<MKLDNNPlugin::FullyConnectedNode>(parent))
+                        return true;
+                }
+                // the decompression of the weights is fused to the FullyConnected node
+                return isDecompressedWeights(node->output(0));
+            });
+    // the subgraphs which the Subgraph node can't take or generate the code for are executed by the regular nodes
+    snippetsManager.register_pass<MKLDNNPlugin::ExpandSnippets>([](const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
+        return !MKLDNNSnippetNode::isLowerable(subgraph);
+    });
+    snippetsManager.run_passes(nGraphFunc);
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -483,7 +569,19 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
             || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled for the plugin */;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT);
+    // the mean and scale preprocessing becomes a part of the network, so it is fused to the first layers
+    // instead of being applied to the input data before each inference
+    const auto inputsInfo = clonedNetwork.getInputsInfo();
+    ngraph::pass::Manager preprocessingManager;
+    preprocessingManager.register_pass<AddPreprocessing>(inputsInfo);
+    preprocessingManager.run_passes(nGraphFunc);
+    const auto& weightsDecompressionProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION);
+    const bool enableWeightsDecompression = weightsDecompressionProp != config.end() ?
+            weightsDecompressionProp->second == PluginConfigParams::YES : engConfig.weightsDecompression;
+    const auto& enforceBF16Prop = config.find(PluginConfigParams::KEY_ENFORCE_BF16);
+    const bool enableBF16 = enforceBF16Prop != config.end() ?
+            enforceBF16Prop->second == PluginConfigParams::YES : engConfig.enforceBF16;
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableWeightsDecompression, enableBF16);
 
     // Here the OV perf modes are turned into specific settings (as we need the network for better params selection)
     const auto& mode = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
@@ -568,6 +666,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    // the subgraphs are executed by the generated kernels, which are available only for AVX2 and AVX-512
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        SnippetsTransformation(nGraphFunc);
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
@@ -694,7 +797,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         const auto& lptProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE);
         const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
-        Transformation(clonedNetwork, enableLPT);
+        Transformation(clonedNetwork, enableLPT, conf.weightsDecompression, conf.enforceBF16);
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
@@ -770,6 +873,9 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
+    auto compiledConstants = std::make_shared<MKLDNNCompiledConstants>();
+    deserializer >> *compiledConstants;
+
     Config conf = engConfig;
     conf.readProperties(config);
 
@@ -777,7 +883,13 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    // the subgraphs are expanded on the export, so they are tokenized again
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        SnippetsTransformation(cnnnetwork.getFunction());
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing,
+                                                           compiledConstants->empty() ? nullptr : compiledConstants);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -7,6 +7,8 @@
 
 #include <pugixml.hpp>
 
+#include <cstring>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
@@ -64,6 +66,32 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    /*
+        Compiled constants format:
+        [ ConstantsHeader ]
+        [ name size | name | dnnl_memory_desc_t | data size | data ] x count
+    */
+    struct ConstantsHeader {
+        char magic[8];
+        uint64_t version;
+        uint64_t desc_size;    // layout of the oneDNN descriptor must be the same for export and import
+        uint64_t count;
+        uint64_t size;         // size of the whole section including the header
+    };
+
+    constexpr char constantsMagic[8] = {'C', 'P', 'U', 'C', 'O', 'N', 'S', 'T'};
+    constexpr uint64_t constantsVersion = 1;
+
+    template<typename T>
+    void write(std::ostream & stream, const T & value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof value);
+    }
+
+    template<typename T>
+    void read(std::istream & stream, T & value) {
+        stream.read(reinterpret_cast<char*>(&value), sizeof value);
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
@@ -124,6 +152,36 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
+void CNNNetworkSerializer::operator << (const std::map<std::string, MKLDNNMemoryCPtr> & constants) {
+    ConstantsHeader hdr = {};
+    std::memcpy(hdr.magic, constantsMagic, sizeof hdr.magic);
+    hdr.version = constantsVersion;
+    hdr.desc_size = sizeof(dnnl_memory_desc_t);
+    hdr.count = constants.size();
+
+    const size_t header_offset = _ostream.tellp();
+    write(_ostream, hdr);
+
+    for (const auto & constant : constants) {
+        const auto & name = constant.first;
+        const auto & memory = constant.second;
+        const auto desc = memory->GetPrimitive().get_desc();
+        const uint64_t dataSize = memory->GetSize();
+
+        write(_ostream, static_cast<uint64_t>(name.size()));
+        _ostream.write(name.c_str(), name.size());
+        write(_ostream, desc.data);
+        write(_ostream, dataSize);
+        _ostream.write(static_cast<const char*>(memory->GetData()), dataSize);
+    }
+
+    const size_t end_offset = _ostream.tellp();
+    hdr.size = end_offset - header_offset;
+    _ostream.seekp(header_offset);
+    write(_ostream, hdr);
+    _ostream.seekp(end_offset);
+}
+
 CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
     : _istream(istream)
     , _cnn_network_builder(fn) {
@@ -173,4 +231,45 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+void CNNNetworkDeserializer::operator >> (MKLDNNCompiledConstants & constants) {
+    const auto header_offset = _istream.tellg();
+
+    ConstantsHeader hdr = {};
+    read(_istream, hdr);
+    if (!_istream || std::memcmp(hdr.magic, constantsMagic, sizeof hdr.magic) != 0) {
+        _istream.clear();
+        _istream.seekg(header_offset);
+        return;
+    }
+
+    const auto end_offset = header_offset + static_cast<std::streamoff>(hdr.size);
+    if (hdr.version != constantsVersion || hdr.desc_size != sizeof(dnnl_memory_desc_t)) {
+        // the constants will be computed during the graph compilation
+        _istream.seekg(end_offset);
+        return;
+    }
+
+    for (uint64_t i = 0; i < hdr.count; i++) {
+        uint64_t nameSize = 0;
+        read(_istream, nameSize);
+        std::string name(nameSize, '\0');
+        _istream.read(&name[0], nameSize);
+
+        mkldnn::memory::desc desc;
+        read(_istream, desc.data);
+
+        uint64_t dataSize = 0;
+        read(_istream, dataSize);
+        std::vector<char> data(dataSize);
+        _istream.read(data.data(), dataSize);
+
+        if (!_istream)
+            IE_THROW(NetworkNotRead) << "The compiled constants section is corrupted.";
+
+        constants.add(name, desc, std::move(data));
+    }
+
+    _istream.seekg(end_offset);
+}
+
 }  // namespace MKLDNNPlugin
@@ -3,9 +3,12 @@
 //
 #pragma once
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_compiled_constants.h"
 
 #include <iostream>
 #include <functional>
+#include <map>
+#include <string>
 #include <cpp/ie_cnn_network.h>
 
 namespace MKLDNNPlugin {
@@ -14,6 +17,11 @@ class CNNNetworkSerializer {
 public:
     CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
     void operator << (const InferenceEngine::CNNNetwork & network);
+    /**
+     * @brief Writes the constant subgraphs outputs of the compiled graph (see MKLDNNGraph::getCompiledConstants()).
+     * Must follow the network.
+     */
+    void operator << (const std::map<std::string, MKLDNNMemoryCPtr> & constants);
 
 private:
     std::ostream & _ostream;
@@ -28,6 +36,11 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    /**
+     * @brief Reads the constant subgraphs outputs written after the network.
+     * The stream position is left unchanged if the blob doesn't contain them (e.g. it was exported by the older version).
+     */
+    void operator >> (MKLDNNCompiledConstants & constants);
 
 private:
     std::istream & _istream;
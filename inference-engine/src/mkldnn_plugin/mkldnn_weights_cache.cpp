@@ -3,13 +3,106 @@
 //
 
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_itt.h"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+namespace {
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t load64(const unsigned char* data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof word);
+    return word;
+}
+
+inline uint64_t hashRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t value) {
+    acc ^= hashRound(0, value);
+    return acc * prime1 + prime4;
+}
+
+inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t hashChunk(const unsigned char* data, size_t size) {
+    size_t i = 0;
+    uint64_t h = prime5;
+    if (size >= 32) {
+        uint64_t v0 = prime1 + prime2, v1 = prime2, v2 = 0, v3 = 0 - prime1;
+        for (; i + 32 <= size; i += 32) {
+            v0 = hashRound(v0, load64(data + i));
+            v1 = hashRound(v1, load64(data + i + 8));
+            v2 = hashRound(v2, load64(data + i + 16));
+            v3 = hashRound(v3, load64(data + i + 24));
+        }
+        h = rotl(v0, 1) + rotl(v1, 7) + rotl(v2, 12) + rotl(v3, 18);
+        h = mergeRound(h, v0);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+    }
+    h += size;
+
+    for (; i + 8 <= size; i += 8) {
+        h ^= hashRound(0, load64(data + i));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    for (; i < size; i++) {
+        h ^= data[i] * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+    return avalanche(h);
+}
+}  // namespace
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "SimpleDataHash::hash");
+
+    constexpr size_t chunkSize = 1 << 20;
+    const size_t chunksNum = (size + chunkSize - 1) / chunkSize;
+    if (chunksNum <= 1)
+        return hashChunk(data, size);
+
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * chunkSize;
+        chunkHashes[i] = hashChunk(data + offset, std::min(chunkSize, size - offset));
+    });
+
+    uint64_t h = prime5 + size;
+    for (const auto chunkHash : chunkHashes)
+        h = mergeRound(h, chunkHash);
+    return avalanche(h);
+}
+
+const SimpleDataHash MKLDNNWeightsSharing::simpleHash{};
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
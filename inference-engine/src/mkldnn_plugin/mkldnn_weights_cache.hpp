@@ -24,26 +24,12 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    /**
+     * Computes 64-bit hash of the data.
+     * The data is split into the fixed size chunks which are hashed in parallel, so the result doesn't depend
+     * on the number of threads. Each chunk is processed by 8-byte words in 4 independent lanes.
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
 };
 
 /**
@@ -93,12 +79,12 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    static const SimpleDataHash& GetHashFunc () { return simpleHash; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
-    static const SimpleDataHash simpleCRC;
+    static const SimpleDataHash simpleHash;
 };
 
 /**
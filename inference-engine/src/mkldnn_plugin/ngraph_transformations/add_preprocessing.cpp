@@ -0,0 +1,105 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "add_preprocessing.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::AddPreprocessing, "AddPreprocessing", 0);
+
+MKLDNNPlugin::AddPreprocessing::AddPreprocessing(const InferenceEngine::InputsDataMap& inputsInfo) : inputsInfo(inputsInfo) {}
+
+bool MKLDNNPlugin::AddPreprocessing::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool changed = false;
+    for (const auto& param : f->get_parameters()) {
+        const auto info = inputsInfo.find(param->get_friendly_name());
+        if (info == inputsInfo.end() || !info->second)
+            continue;
+        auto& pp = info->second->getPreProcess();
+        const size_t channels = pp.getNumberOfChannels();
+        if (channels == 0)
+            continue;
+
+        const auto& shape = param->get_partial_shape();
+        if (param->get_element_type() != ngraph::element::f32 || shape.rank().is_dynamic() || shape.rank().get_length() < 2 ||
+                shape[1].is_dynamic() || static_cast<size_t>(shape[1].get_length()) != channels)
+            continue;
+        // the output name of the network is defined by the Parameter itself
+        const auto consumers = param->output(0).get_target_inputs();
+        if (std::any_of(consumers.begin(), consumers.end(), [](const ngraph::Input<ngraph::Node>& input) {
+                return ngraph::is_type<ngraph::opset1::Result>(input.get_node());
+            }))
+            continue;
+        const size_t rank = shape.rank().get_length();
+
+        std::shared_ptr<ngraph::Node> mean, scale;
+        if (pp.getMeanVariant() == InferenceEngine::MEAN_VALUE) {
+            std::vector<float> meanValues(channels), stdScales(channels);
+            for (size_t c = 0; c < channels; c++) {
+                meanValues[c] = pp[c]->meanValue;
+                stdScales[c] = pp[c]->stdScale;
+            }
+            // the zero scale is reported by the graph on the network loading
+            if (std::any_of(stdScales.begin(), stdScales.end(), [](float value) { return value == 0; }))
+                continue;
+
+            ngraph::Shape constShape(rank, 1);
+            constShape[1] = channels;
+            if (std::any_of(meanValues.begin(), meanValues.end(), [](float value) { return value != 0; }))
+                mean = ngraph::opset1::Constant::create(ngraph::element::f32, constShape, meanValues);
+            if (std::any_of(stdScales.begin(), stdScales.end(), [](float value) { return value != 1; }))
+                scale = ngraph::opset1::Constant::create(ngraph::element::f32, constShape, stdScales);
+        } else if (pp.getMeanVariant() == InferenceEngine::MEAN_IMAGE) {
+            // the mean image is set for each channel as the blob of the spatial size of the input
+            if (rank != 4 || shape[2].is_dynamic() || shape[3].is_dynamic())
+                continue;
+            const size_t height = shape[2].get_length();
+            const size_t width = shape[3].get_length();
+
+            std::vector<float> meanImage;
+            meanImage.reserve(channels * height * width);
+            bool isValid = true;
+            for (size_t c = 0; c < channels && isValid; c++) {
+                const auto& meanBlob = pp[c]->meanData;
+                isValid = meanBlob && meanBlob->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+                          meanBlob->size() == height * width;
+                if (isValid) {
+                    const auto data = meanBlob->cbuffer().as<const float*>();
+                    meanImage.insert(meanImage.end(), data, data + meanBlob->size());
+                }
+            }
+            if (!isValid)
+                continue;
+
+            mean = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, channels, height, width}, meanImage);
+        }
+
+        ngraph::Output<ngraph::Node> output = param;
+        ngraph::NodeVector newOps;
+        if (mean) {
+            output = std::make_shared<ngraph::opset1::Subtract>(output, mean);
+            output.get_node_shared_ptr()->set_friendly_name(param->get_friendly_name() + "/mean");
+            newOps.push_back(output.get_node_shared_ptr());
+        }
+        if (scale) {
+            output = std::make_shared<ngraph::opset1::Divide>(output, scale);
+            output.get_node_shared_ptr()->set_friendly_name(param->get_friendly_name() + "/scale");
+            newOps.push_back(output.get_node_shared_ptr());
+        }
+        if (!newOps.empty()) {
+            ngraph::copy_runtime_info(param, newOps);
+            for (auto input : consumers)
+                input.replace_source_output(output);
+        }
+
+        pp.init(0);
+        pp.setVariant(InferenceEngine::NONE);
+        changed = true;
+    }
+    return changed;
+}
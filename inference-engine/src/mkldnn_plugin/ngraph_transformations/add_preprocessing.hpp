@@ -0,0 +1,30 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+#include <ie_input_info.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Converts the mean values, the mean image and the scales of the PreProcessInfo of the inputs to the operations
+ * (x - mean) / scale after the corresponding Parameters, so they are fused to the following nodes instead of being
+ * applied to the input data by a separate pass on each inference. The mean and scale information is removed from the
+ * PreProcessInfo of the converted inputs. The inputs which are not supported (not f32 Parameters, inconsistent
+ * values) are left as is.
+ */
+class AddPreprocessing : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit AddPreprocessing(const InferenceEngine::InputsDataMap& inputsInfo);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    const InferenceEngine::InputsDataMap& inputsInfo;
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,7 @@
 
 #include "convert_matmul_to_fc.hpp"
 #include "op/fully_connected.hpp"
+#include "weights_decompression.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -13,7 +14,7 @@ NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
 MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -41,9 +42,16 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
             return false;
         }
 
+        // The compressed weights are already in the form of the FullyConnected weights [O, K] and are not transformed
+        // so the decompression chain is kept
+        const bool decompressedWeights = isDecompressedWeights(fc_input_b);
+        if (decompressedWeights && (!matmul->get_transpose_b() || rank_b != 2)) {
+            return false;
+        }
+
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if ((!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && !decompressedWeights) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "expand_snippets.hpp"
+
+#include <ngraph/rt_info.hpp>
+
+#include <unordered_map>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ExpandSnippets, "ExpandSnippets", 0);
+
+namespace {
+
+void expand(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
+    const auto body = subgraph->get_body();
+
+    // the outputs of the body operations are mapped to the outputs of their copies in the function
+    std::unordered_map<const ngraph::Node*, ngraph::OutputVector> mapping;
+    const auto& parameters = body->get_parameters();
+    for (size_t i = 0; i < parameters.size(); i++)
+        mapping[parameters[i].get()] = {subgraph->input_value(i)};
+
+    for (const auto& op : body->get_ordered_ops()) {
+        if (ngraph::op::is_parameter(op) || ngraph::op::is_output(op))
+            continue;
+        ngraph::OutputVector inputs;
+        for (const auto& input : op->input_values())
+            inputs.push_back(mapping.at(input.get_node())[input.get_index()]);
+        auto copy = op->clone_with_new_inputs(inputs);
+        copy->set_friendly_name(op->get_friendly_name());
+        ngraph::copy_runtime_info(op, copy);
+        mapping[op.get()] = copy->outputs();
+    }
+
+    const auto& results = body->get_results();
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto source = results[i]->input_value(0);
+        const auto& replacement = mapping.at(source.get_node())[source.get_index()];
+        replacement.get_tensor().add_names(subgraph->output(i).get_names());
+        subgraph->output(i).replace(replacement);
+    }
+}
+
+}  // namespace
+
+MKLDNNPlugin::ExpandSnippets::ExpandSnippets(Predicate predicate) : predicate(std::move(predicate)) {}
+
+bool MKLDNNPlugin::ExpandSnippets::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool expanded = false;
+    for (const auto& op : f->get_ordered_ops()) {
+        const auto subgraph = ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph || (predicate && !predicate(subgraph)))
+            continue;
+        expand(subgraph);
+        expanded = true;
+    }
+    return expanded;
+}
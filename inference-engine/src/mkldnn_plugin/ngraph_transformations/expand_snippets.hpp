@@ -0,0 +1,33 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+#include <snippets/op/subgraph.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Replaces the snippets Subgraphs selected by the predicate with the operations of their bodies, so the subgraphs
+ * which can't be lowered are executed by the regular nodes, and the function can be serialized (the bodies are not
+ * serialized by the Subgraph). All the subgraphs are expanded if the predicate is not set.
+ */
+class ExpandSnippets : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    using Predicate = std::function<bool(const std::shared_ptr<ngraph::snippets::op::Subgraph>&)>;
+
+    explicit ExpandSnippets(Predicate predicate = nullptr);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    Predicate predicate;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,45 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "random_uniform.hpp"
+
+#include <ngraph/validation_util.hpp>
+
+MKLDNNPlugin::RandomUniformNode::RandomUniformNode(const ngraph::Output<ngraph::Node> &out_shape,
+                                                   const ngraph::Output<ngraph::Node> &min_val,
+                                                   const ngraph::Output<ngraph::Node> &max_val,
+                                                   const ngraph::element::Type &output_type,
+                                                   const ngraph::element::Type &sequence_type,
+                                                   uint64_t global_seed,
+                                                   uint64_t op_seed)
+    : Op({out_shape, min_val, max_val}), m_output_type(output_type), m_sequence_type(sequence_type),
+      m_global_seed(global_seed), m_op_seed(op_seed) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::RandomUniformNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::RandomUniformNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                             m_output_type, m_sequence_type, m_global_seed, m_op_seed);
+}
+
+void MKLDNNPlugin::RandomUniformNode::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1).compatible(get_input_element_type(2)),
+                          "'min_val' should have the same type as 'max_val'.");
+
+    ngraph::PartialShape output_shape = ngraph::PartialShape::dynamic();
+    if (const auto& const_shape = ngraph::get_constant_from_source(input_value(0)))
+        output_shape = ngraph::PartialShape(const_shape->cast_vector<int64_t>());
+
+    set_output_type(0, m_output_type, output_shape);
+}
+
+bool MKLDNNPlugin::RandomUniformNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("output_type", m_output_type);
+    visitor.on_attribute("sequence_type", m_sequence_type);
+    visitor.on_attribute("global_seed", m_global_seed);
+    visitor.on_attribute("op_seed", m_op_seed);
+    return true;
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+// RandomUniform with the output precision of the plugin. The sequence type is the out_type of the original operation,
+// the node generates the values of this type and stores them in the output type, so the type is kept as an attribute.
+class RandomUniformNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("RandomUniformCPU", "cpu_plugin_opset");
+
+    RandomUniformNode() = default;
+
+    RandomUniformNode(const ngraph::Output<ngraph::Node> &out_shape,
+                      const ngraph::Output<ngraph::Node> &min_val,
+                      const ngraph::Output<ngraph::Node> &max_val,
+                      const ngraph::element::Type &output_type,
+                      const ngraph::element::Type &sequence_type,
+                      uint64_t global_seed,
+                      uint64_t op_seed);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    // the sequence differs from run to run, it isn't folded
+    bool constant_fold(ngraph::OutputVector& output_values, const ngraph::OutputVector& inputs_values) override {
+        return false;
+    }
+
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+    ngraph::element::Type get_sequence_type() const { return m_sequence_type; }
+
+    uint64_t get_global_seed() const { return m_global_seed; }
+
+    uint64_t get_op_seed() const { return m_op_seed; }
+
+private:
+    ngraph::element::Type m_output_type;
+    ngraph::element::Type m_sequence_type;
+    uint64_t m_global_seed = 0;
+    uint64_t m_op_seed = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,211 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shift_scale_weights_fusion.hpp"
+#include <algorithm>
+#include <numeric>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "transformations/utils/utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::AddConvolutionFusion, "AddConvolutionFusion", 0);
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::AddMatMulFusion, "AddMatMulFusion", 0);
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MultiplyMatMulFusion, "MultiplyMatMulFusion", 0);
+
+namespace {
+
+// checks that the constant broadcasted to the tensor of the given rank (numpy rules) varies along the axis only
+bool isBroadcastedAlongAxis(const ngraph::Shape& constShape, size_t rank, size_t axis, size_t dim) {
+    if (constShape.size() > rank)
+        return false;
+    const size_t offset = rank - constShape.size();
+    for (size_t i = 0; i < constShape.size(); i++) {
+        if (constShape[i] != 1 && (i + offset != axis || constShape[i] != dim))
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::AddConvolutionFusion::AddConvolutionFusion() {
+    auto param = ngraph::pattern::wrap_type<ngraph::opset1::Parameter>(ngraph::pattern::has_static_rank());
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto mul = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({param, scale}, ngraph::pattern::consumers_count(1));
+    auto input = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{param, mul});
+    auto shift = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto add = ngraph::pattern::wrap_type<ngraph::opset1::Add>({input, shift}, ngraph::pattern::consumers_count(1));
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto conv = ngraph::pattern::wrap_type<ngraph::opset1::Convolution>({add, weights});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto convNode = ngraph::as_type_ptr<ngraph::opset1::Convolution>(pattern_to_output.at(conv).get_node_shared_ptr());
+        if (!convNode || transformation_callback(convNode)) {
+            return false;
+        }
+
+        auto isZero = [](std::ptrdiff_t pad) { return pad == 0; };
+        if (!std::all_of(convNode->get_pads_begin().begin(), convNode->get_pads_begin().end(), isZero) ||
+            !std::all_of(convNode->get_pads_end().begin(), convNode->get_pads_end().end(), isZero)) {
+            return false;
+        }
+
+        auto shiftNode = pattern_to_output.at(shift).get_node_shared_ptr();
+        auto weightsNode = pattern_to_output.at(weights).get_node_shared_ptr();
+        const auto& weightsShape = weightsNode->get_shape();
+        const size_t rank = weightsShape.size();
+        // the shift and the scale must not change the shape of the input
+        const auto& inputShape = pattern_to_output.at(param).get_partial_shape();
+        if (!inputShape.same_scheme(pattern_to_output.at(add).get_partial_shape()) ||
+            static_cast<size_t>(inputShape.rank().get_length()) != rank ||
+            shiftNode->get_element_type() != weightsNode->get_element_type() ||
+            !isBroadcastedAlongAxis(shiftNode->get_shape(), rank, 1, weightsShape[1])) {
+            return false;
+        }
+
+        // the scale preceding the shift is applied to the input channels of the weights
+        std::shared_ptr<ngraph::Node> scaleNode;
+        if (pattern_to_output.count(mul)) {
+            scaleNode = pattern_to_output.at(scale).get_node_shared_ptr();
+            if (scaleNode->get_element_type() != weightsNode->get_element_type() ||
+                !isBroadcastedAlongAxis(scaleNode->get_shape(), rank, 1, weightsShape[1])) {
+                return false;
+            }
+        }
+
+        // the shift of each input channel is multiplied by the weights and summed up for each output channel
+        std::vector<int64_t> axes(rank - 1);
+        std::iota(axes.begin(), axes.end(), 1);
+        auto weightedShift = ngraph::op::util::make_try_fold<ngraph::opset1::Multiply>(weightsNode, shiftNode);
+        auto biasPerChannel = ngraph::op::util::make_try_fold<ngraph::opset1::ReduceSum>(weightedShift,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{axes.size()}, axes), true);
+        std::vector<int64_t> biasShape(rank, 1);
+        biasShape[1] = static_cast<int64_t>(weightsShape[0]);
+        auto bias = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(biasPerChannel,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{rank}, biasShape), false);
+
+        ngraph::NodeVector fusedNodes{pattern_to_output.at(add).get_node_shared_ptr(), convNode};
+        std::shared_ptr<ngraph::Node> newWeights = weightsNode;
+        if (scaleNode) {
+            newWeights = ngraph::op::util::make_try_fold<ngraph::opset1::Multiply>(weightsNode, scaleNode);
+            fusedNodes.push_back(pattern_to_output.at(mul).get_node_shared_ptr());
+        }
+
+        auto newConv = convNode->clone_with_new_inputs({pattern_to_output.at(param), newWeights});
+        auto newAdd = std::make_shared<ngraph::opset1::Add>(newConv, bias);
+        newConv->set_friendly_name(convNode->get_friendly_name() + "/WithoutShift");
+        newAdd->set_friendly_name(convNode->get_friendly_name());
+        ngraph::copy_runtime_info(fusedNodes, {newConv, newWeights, newAdd, bias});
+        ngraph::replace_node(convNode, newAdd);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(conv, "AddConvolutionFusion");
+    this->register_matcher(m, callback);
+}
+
+MKLDNNPlugin::AddMatMulFusion::AddMatMulFusion() {
+    auto param = ngraph::pattern::wrap_type<ngraph::opset1::Parameter>(ngraph::pattern::has_static_rank());
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto mul = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({param, scale}, ngraph::pattern::consumers_count(1));
+    auto input = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{param, mul});
+    auto shift = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto add = ngraph::pattern::wrap_type<ngraph::opset1::Add>({input, shift}, ngraph::pattern::consumers_count(1));
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({add, weights});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmulNode = ngraph::as_type_ptr<ngraph::opset1::MatMul>(pattern_to_output.at(matmul).get_node_shared_ptr());
+        if (!matmulNode || matmulNode->get_transpose_a() || transformation_callback(matmulNode)) {
+            return false;
+        }
+
+        auto shiftNode = pattern_to_output.at(shift).get_node_shared_ptr();
+        auto weightsNode = pattern_to_output.at(weights).get_node_shared_ptr();
+        const auto& weightsShape = weightsNode->get_shape();
+        // the scale preceding the shift is fused to the new MatMul by MultiplyMatMulFusion
+        const auto addInput = pattern_to_output.count(mul) ? pattern_to_output.at(mul) : pattern_to_output.at(param);
+        const auto& inputShape = addInput.get_partial_shape();
+        const size_t rank = inputShape.rank().get_length();
+        if (rank < 2 || !inputShape.same_scheme(pattern_to_output.at(add).get_partial_shape()) ||
+            weightsShape.size() != 2 || shiftNode->get_element_type() != weightsNode->get_element_type()) {
+            return false;
+        }
+        const bool transposeB = matmulNode->get_transpose_b();
+        const size_t K = transposeB ? weightsShape[1] : weightsShape[0];
+        if (!isBroadcastedAlongAxis(shiftNode->get_shape(), rank, rank - 1, K)) {
+            return false;
+        }
+
+        // the shift is the row of the size K multiplied by the weights
+        auto shiftRow = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(shiftNode,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, -1}), false);
+        shiftRow = ngraph::op::util::make_try_fold<ngraph::opset1::Broadcast>(shiftRow,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, std::vector<int64_t>{1, static_cast<int64_t>(K)}));
+        auto bias = ngraph::op::util::make_try_fold<ngraph::opset1::MatMul>(shiftRow, weightsNode, false, transposeB);
+
+        auto newMatMul = matmulNode->clone_with_new_inputs({addInput, weightsNode});
+        auto newAdd = std::make_shared<ngraph::opset1::Add>(newMatMul, bias);
+        newMatMul->set_friendly_name(matmulNode->get_friendly_name() + "/WithoutShift");
+        newAdd->set_friendly_name(matmulNode->get_friendly_name());
+        ngraph::copy_runtime_info({pattern_to_output.at(add).get_node_shared_ptr(), matmulNode}, {newMatMul, newAdd, bias});
+        ngraph::replace_node(matmulNode, newAdd);
+        register_new_node(newMatMul);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "AddMatMulFusion");
+    this->register_matcher(m, callback);
+}
+
+MKLDNNPlugin::MultiplyMatMulFusion::MultiplyMatMulFusion() {
+    auto input = ngraph::pattern::wrap_type<ngraph::opset1::Parameter>(ngraph::pattern::has_static_rank());
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto mul = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({input, scale}, ngraph::pattern::consumers_count(1));
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({mul, weights});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmulNode = ngraph::as_type_ptr<ngraph::opset1::MatMul>(pattern_to_output.at(matmul).get_node_shared_ptr());
+        if (!matmulNode || matmulNode->get_transpose_a() || transformation_callback(matmulNode)) {
+            return false;
+        }
+
+        auto scaleNode = pattern_to_output.at(scale).get_node_shared_ptr();
+        auto weightsNode = pattern_to_output.at(weights).get_node_shared_ptr();
+        const auto& weightsShape = weightsNode->get_shape();
+        const auto& inputShape = pattern_to_output.at(input).get_partial_shape();
+        const size_t rank = inputShape.rank().get_length();
+        if (rank < 2 || !inputShape.same_scheme(pattern_to_output.at(mul).get_partial_shape()) ||
+            weightsShape.size() != 2 || scaleNode->get_element_type() != weightsNode->get_element_type()) {
+            return false;
+        }
+        const bool transposeB = matmulNode->get_transpose_b();
+        const size_t K = transposeB ? weightsShape[1] : weightsShape[0];
+        if (!isBroadcastedAlongAxis(scaleNode->get_shape(), rank, rank - 1, K)) {
+            return false;
+        }
+
+        // the scale of the row k of the input is applied to the row k of the weights (the column if transposed)
+        const std::vector<int64_t> scaleShape = transposeB ? std::vector<int64_t>{1, -1} : std::vector<int64_t>{-1, 1};
+        auto scaleReshaped = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(scaleNode,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, scaleShape), false);
+        auto newWeights = ngraph::op::util::make_try_fold<ngraph::opset1::Multiply>(weightsNode, scaleReshaped);
+
+        auto newMatMul = matmulNode->clone_with_new_inputs({pattern_to_output.at(input), newWeights});
+        newMatMul->set_friendly_name(matmulNode->get_friendly_name());
+        ngraph::copy_runtime_info({pattern_to_output.at(mul).get_node_shared_ptr(), matmulNode}, {newMatMul, newWeights});
+        ngraph::replace_node(matmulNode, newMatMul);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MultiplyMatMulFusion");
+    this->register_matcher(m, callback);
+}
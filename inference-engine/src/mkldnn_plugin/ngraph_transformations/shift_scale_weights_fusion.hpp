@@ -0,0 +1,46 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+// The shift and the scale are folded only when x is a Parameter, so the passes are limited to the first layers of the
+// network, the shifts and the scales inside the network are left to the eltwise fusing of the graph.
+
+/**
+ * Add(x [* scale], shift) -> Convolution(W) is replaced with Convolution(x, W [* scale]) -> Add(bias),
+ * where bias[co] = sum(W[co] * shift)
+ * The shift and the scale must be constant over the spatial dimensions and the convolution must not have the padding,
+ * since the padded values are not shifted.
+ */
+class AddConvolutionFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    AddConvolutionFusion();
+};
+
+/**
+ * Add(x [* scale], shift) -> MatMul(W) is replaced with MatMul(x [* scale], W) -> Add(shift * W), the shift is
+ * broadcasted along the reduced dimension only
+ */
+class AddMatMulFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    AddMatMulFusion();
+};
+
+/**
+ * Multiply(x, scale) -> MatMul(W) is replaced with MatMul(x, W * scale), the scale is broadcasted along the reduced
+ * dimension only
+ */
+class MultiplyMatMulFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MultiplyMatMulFusion();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,163 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression.hpp"
+#include <algorithm>
+#include <vector>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+
+#include "transformations/convert_precision.hpp"
+#include "transformations/rt_info/disable_constant_folding.hpp"
+#include "transformations/utils/utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkWeightsDecompression, "MarkWeightsDecompression", 0);
+
+namespace {
+
+// returns the values of the constant broadcasted along the axis of the tensor of the given rank (numpy rules) or
+// the empty vector if the constant varies along the other axes
+std::vector<float> getPerChannelValues(const std::shared_ptr<ngraph::opset1::Constant>& constant, size_t rank, size_t axis, size_t dim) {
+    const auto& constShape = constant->get_shape();
+    if (constShape.size() > rank)
+        return {};
+    const size_t offset = rank - constShape.size();
+    for (size_t i = 0; i < constShape.size(); i++) {
+        if (constShape[i] != 1 && (i + offset != axis || constShape[i] != dim))
+            return {};
+    }
+    auto values = constant->cast_vector<float>();
+    if (values.size() == 1)
+        values.resize(dim, values[0]);
+    return values;
+}
+
+}  // namespace
+
+MKLDNNPlugin::MarkWeightsDecompression::MarkWeightsDecompression() {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(
+            {ngraph::element::f16, ngraph::element::bf16, ngraph::element::u8, ngraph::element::i8}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+    auto zeroPoint = ngraph::pattern::any_input();
+    auto subtract = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert, zeroPoint}, ngraph::pattern::consumers_count(1));
+    auto shifted = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert, subtract});
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({shifted, scale}, ngraph::pattern::consumers_count(1));
+    auto decompressed = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{shifted, multiply});
+    auto activations = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({activations, decompressed});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        const auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmulNode = ngraph::as_type_ptr<ngraph::opset1::MatMul>(pattern_to_output.at(matmul).get_node_shared_ptr());
+        if (!matmulNode || transformation_callback(matmulNode)) {
+            return false;
+        }
+
+        auto weightsNode = ngraph::as_type_ptr<ngraph::opset1::Constant>(pattern_to_output.at(weights).get_node_shared_ptr());
+        auto convertNode = pattern_to_output.at(convert).get_node_shared_ptr();
+        // the chain is already in the canonical form
+        if (!weightsNode || ov::is_keep_const_precision(weightsNode) || convertNode->get_output_element_type(0) != ngraph::element::f32) {
+            return false;
+        }
+
+        // the leading dimensions of the weights are 1 and the weights don't increase the rank of the output
+        const auto& weightsShape = weightsNode->get_shape();
+        const size_t rank = weightsShape.size();
+        const auto activationsRank = pattern_to_output.at(activations).get_partial_shape().rank().get_length();
+        if (rank < 2 || activationsRank < 2 || rank > static_cast<size_t>(activationsRank) ||
+            std::any_of(weightsShape.begin(), weightsShape.end() - 2, [](size_t dim) { return dim != 1; })) {
+            return false;
+        }
+
+        const bool transposeB = matmulNode->get_transpose_b();
+        const size_t channelAxis = transposeB ? rank - 2 : rank - 1;
+        const size_t N = weightsShape[channelAxis];
+        const size_t K = transposeB ? weightsShape[rank - 1] : weightsShape[rank - 2];
+        // the scalar shift and scale are converted to the power by the CPU specific opset conversion
+        if (N < 2) {
+            return false;
+        }
+
+        std::vector<float> zeroPoints(N, 0.f), scales(N, 1.f);
+        if (pattern_to_output.count(subtract)) {
+            auto zeroPointNode = ngraph::get_constant_from_source(pattern_to_output.at(zeroPoint));
+            if (!zeroPointNode)
+                return false;
+            zeroPoints = getPerChannelValues(zeroPointNode, rank, channelAxis, N);
+            if (zeroPoints.empty())
+                return false;
+        }
+        if (pattern_to_output.count(multiply)) {
+            auto scaleNode = ngraph::as_type_ptr<ngraph::opset1::Constant>(pattern_to_output.at(scale).get_node_shared_ptr());
+            scales = getPerChannelValues(scaleNode, rank, channelAxis, N);
+            if (scales.empty())
+                return false;
+        }
+
+        // the weights are stored as [N, K] like the weights of the FullyConnected node
+        ngraph::NodeVector newOps;
+        std::shared_ptr<ngraph::Node> newWeights = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(weightsNode,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2},
+                std::vector<int64_t>{static_cast<int64_t>(weightsShape[rank - 2]), static_cast<int64_t>(weightsShape[rank - 1])}), false);
+        if (!transposeB) {
+            newWeights = ngraph::op::util::make_try_fold<ngraph::opset1::Transpose>(newWeights,
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, std::vector<int64_t>{1, 0}));
+        }
+        if (!ngraph::is_type<ngraph::opset1::Constant>(newWeights) || newWeights->get_shape() != ngraph::Shape{N, K}) {
+            return false;
+        }
+        newWeights->set_friendly_name(weightsNode->get_friendly_name());
+        ov::enable_keep_const_precision(newWeights);
+        newOps.push_back(newWeights);
+
+        std::shared_ptr<ngraph::Node> output = std::make_shared<ngraph::opset1::Convert>(newWeights, ngraph::element::f32);
+        output->set_friendly_name(convertNode->get_friendly_name());
+        ov::disable_constant_folding(output);
+        newOps.push_back(output);
+
+        // (w - zero_point) * scale = w * scale + shift, where shift = -zero_point * scale
+        if (std::any_of(scales.begin(), scales.end(), [](float value) { return value != 1.f; })) {
+            auto scaleConst = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{N, 1}, scales);
+            output = std::make_shared<ngraph::opset1::Multiply>(output, scaleConst);
+            output->set_friendly_name(matmulNode->get_friendly_name() + "/decompression_scale");
+            newOps.push_back(output);
+        }
+        if (std::any_of(zeroPoints.begin(), zeroPoints.end(), [](float value) { return value != 0.f; })) {
+            std::vector<float> shifts(N);
+            for (size_t n = 0; n < N; n++)
+                shifts[n] = -zeroPoints[n] * scales[n];
+            auto shiftConst = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{N, 1}, shifts);
+            output = std::make_shared<ngraph::opset1::Add>(output, shiftConst);
+            output->set_friendly_name(matmulNode->get_friendly_name() + "/decompression_shift");
+            newOps.push_back(output);
+        }
+
+        auto newMatMul = std::make_shared<ngraph::opset1::MatMul>(pattern_to_output.at(activations), output,
+                                                                  matmulNode->get_transpose_a(), true);
+        newMatMul->set_friendly_name(matmulNode->get_friendly_name());
+        newOps.push_back(newMatMul);
+        ngraph::copy_runtime_info(m.get_matched_nodes(), newOps);
+        ngraph::replace_node(matmulNode, newMatMul);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MarkWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+bool MKLDNNPlugin::isDecompressedWeights(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Add>(node) && ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1)))
+        node = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Multiply>(node) && ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1)))
+        node = node->get_input_node_shared_ptr(0);
+    if (!ngraph::is_type<ngraph::opset1::Convert>(node) || !ov::pass::constant_folding_is_disabled(node))
+        return false;
+    auto weights = node->get_input_node_shared_ptr(0);
+    return ngraph::is_type<ngraph::opset1::Constant>(weights) && ov::is_keep_const_precision(weights);
+}
@@ -0,0 +1,29 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * The compressed weights of MatMul Constant(f16/bf16/u8/i8) -> Convert(f32) [-> Subtract(zero point)] [-> Multiply(scale)]
+ * are brought to the canonical form Constant[N, K] -> Convert(f32) [-> Multiply(scale[N, 1])] [-> Add(shift[N, 1])]
+ * with transpose_b = true, where shift = -zero_point * scale. The Constant keeps its precision during ConvertPrecision
+ * and the Convert is not constant folded, so the chain reaches the graph where it is fused to the FullyConnected node
+ * which decompresses the weights on the fly. The zero point and the scale must be per output channel.
+ */
+class MarkWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkWeightsDecompression();
+};
+
+/**
+ * Returns true if the output is the end of the decompression chain produced by MarkWeightsDecompression
+ */
+bool isDecompressedWeights(const ngraph::Output<ngraph::Node>& output);
+
+}  // namespace MKLDNNPlugin
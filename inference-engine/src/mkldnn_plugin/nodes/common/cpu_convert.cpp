@@ -5,6 +5,7 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include <ngraph/type/float16.hpp>
 #include <mkldnn_selective_build.h>
 #include <type_traits>
 #include <tuple>
@@ -38,6 +39,11 @@ struct PrecisionInfo<Precision::BF16> {
     using value_type = MKLDNNPlugin::bfloat16_t;
 };
 
+template <>
+struct PrecisionInfo<Precision::FP16> {
+    using value_type = ngraph::float16;
+};
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
@@ -109,7 +115,8 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
     MKLDNN_CVT(FP64, I64), MKLDNN_CVT(FP64, FP32), MKLDNN_CVT(FP64, BF16), MKLDNN_CVT(FP64, BOOL),
     MKLDNN_CVT(U32, U8),  MKLDNN_CVT(U32, I8),   MKLDNN_CVT(U32, U16),
     MKLDNN_CVT(U32, I16), MKLDNN_CVT(U32, I32),  MKLDNN_CVT(U32, U64),
-    MKLDNN_CVT(U32, I64), MKLDNN_CVT(U32, FP32), MKLDNN_CVT(U32, BF16), MKLDNN_CVT(U32, BOOL));
+    MKLDNN_CVT(U32, I64), MKLDNN_CVT(U32, FP32), MKLDNN_CVT(U32, BF16), MKLDNN_CVT(U32, BOOL),
+    MKLDNN_CVT(FP16, FP32), MKLDNN_CVT(FP32, FP16));
 
     if (!ctx.converted)
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
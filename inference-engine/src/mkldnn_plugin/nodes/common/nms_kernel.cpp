@@ -0,0 +1,425 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.h"
+
+#include <ie_parallel.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF_IOU(field) offsetof(jit_nms_iou_call_args, field)
+#define GET_OFF_FILTER(field) offsetof(jit_nms_filter_call_args, field)
+
+namespace {
+// the kept boxes are checked by the chunks, the check stops at the first chunk with the suppressing box
+constexpr size_t suppressChunkSize = 64;
+// the number of the boxes checked by each thread at once if the selection is parallel
+constexpr size_t selectBlockPerThread = 16;
+// the filtered indices are written by the full vectors of the widest ISA
+constexpr size_t maxLanes = 16;
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_nms_iou_kernel_f32 : public jit_uni_nms_iou_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_iou_kernel_f32)
+
+    explicit jit_uni_nms_iou_kernel_f32(jit_nms_config_params jcp) : jit_uni_nms_iou_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_box, ptr[reg_params + GET_OFF_IOU(box)]);
+        for (int f = 0; f < NmsBoxes::FIELDS_NUM; f++)
+            mov(reg_boxes[f], ptr[reg_params + GET_OFF_IOU(boxes) + f * sizeof(float*)]);
+        mov(reg_iou, ptr[reg_params + GET_OFF_IOU(iou)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_IOU(work_amount)]);
+
+        for (int f = 0; f < NmsBoxes::FIELDS_NUM; f++)
+            uni_vbroadcastss(vmm_box(f), ptr[reg_box + f * sizeof(float)]);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        mov(reg_tmp.cvt32(), float2int(jcp_.norm));
+        vmovd(Xbyak::Xmm(vmm_norm.getIdx()), reg_tmp.cvt32());
+        uni_vbroadcastss(vmm_norm, Xbyak::Xmm(vmm_norm.getIdx()));
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, lanes);
+            jl(main_loop_end_label, T_NEAR);
+
+            // sizes of the intersection along both axes
+            uni_vminps(vmm_size0, vmm_box(NmsBoxes::C2), ptr[reg_boxes[NmsBoxes::C2]]);
+            uni_vmaxps(vmm_tmp, vmm_box(NmsBoxes::C0), ptr[reg_boxes[NmsBoxes::C0]]);
+            uni_vsubps(vmm_size0, vmm_size0, vmm_tmp);
+            uni_vaddps(vmm_size0, vmm_size0, vmm_norm);
+            uni_vminps(vmm_size1, vmm_box(NmsBoxes::C3), ptr[reg_boxes[NmsBoxes::C3]]);
+            uni_vmaxps(vmm_tmp, vmm_box(NmsBoxes::C1), ptr[reg_boxes[NmsBoxes::C1]]);
+            uni_vsubps(vmm_size1, vmm_size1, vmm_tmp);
+            uni_vaddps(vmm_size1, vmm_size1, vmm_norm);
+            if (!jcp_.matrix_iou) {
+                uni_vmaxps(vmm_size0, vmm_size0, vmm_zero);
+                uni_vmaxps(vmm_size1, vmm_size1, vmm_zero);
+            }
+
+            uni_vmovups(vmm_area, ptr[reg_boxes[NmsBoxes::AREA]]);
+            uni_vmulps(vmm_size0, vmm_size0, vmm_size1);
+            uni_vaddps(vmm_tmp, vmm_box(NmsBoxes::AREA), vmm_area);
+            uni_vsubps(vmm_tmp, vmm_tmp, vmm_size0);
+            uni_vdivps(vmm_size0, vmm_size0, vmm_tmp);
+
+            if (jcp_.matrix_iou) {
+                // the boxes do not overlap by the bounds
+                uni_vmovups(vmm_tmp, ptr[reg_boxes[NmsBoxes::C0]]);
+                compare_lt(vmm_box(NmsBoxes::C2), vmm_tmp, true);
+                uni_vmovups(vmm_tmp, ptr[reg_boxes[NmsBoxes::C2]]);
+                compare_lt(vmm_tmp, vmm_box(NmsBoxes::C0), false);
+                uni_vmovups(vmm_tmp, ptr[reg_boxes[NmsBoxes::C1]]);
+                compare_lt(vmm_box(NmsBoxes::C3), vmm_tmp, false);
+                uni_vmovups(vmm_tmp, ptr[reg_boxes[NmsBoxes::C3]]);
+                compare_lt(vmm_tmp, vmm_box(NmsBoxes::C1), false);
+            } else {
+                // the boxes with the empty area, the area of the box is checked by the caller
+                if (isa == avx512_common)
+                    vcmpps(k_mask, vmm_area, vmm_zero, _cmp_le_os);
+                else
+                    vcmpps(vmm_mask, vmm_area, vmm_zero, _cmp_le_os);
+            }
+            if (isa == avx512_common)
+                vblendmps(vmm_size0 | k_mask, vmm_size0, vmm_zero);
+            else
+                vblendvps(vmm_size0, vmm_size0, vmm_zero, vmm_mask);
+
+            uni_vmovups(ptr[reg_iou], vmm_size0);
+
+            for (int f = 0; f < NmsBoxes::FIELDS_NUM; f++)
+                add(reg_boxes[f], vlen);
+            add(reg_iou, vlen);
+            sub(reg_work_amount, lanes);
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int lanes = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_box = r8;
+    Xbyak::Reg64 reg_boxes[NmsBoxes::FIELDS_NUM] = {r9, r10, r11, r12, r13};
+    Xbyak::Reg64 reg_iou = r14;
+    Xbyak::Reg64 reg_work_amount = r15;
+    Xbyak::Reg64 reg_tmp = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_box(int f) { return Vmm(f); }
+    Vmm vmm_zero = Vmm(5);
+    Vmm vmm_norm = Vmm(6);
+    Vmm vmm_area = Vmm(7);
+    Vmm vmm_size0 = Vmm(8);
+    Vmm vmm_size1 = Vmm(9);
+    Vmm vmm_tmp = Vmm(10);
+    Vmm vmm_mask = Vmm(11);
+    Vmm vmm_cmp = Vmm(12);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_cmp = Xbyak::Opmask(2);
+
+    // mask = a < b, or mask |= a < b
+    void compare_lt(const Vmm& a, const Vmm& b, bool first) {
+        if (isa == avx512_common) {
+            vcmpps(first ? k_mask : k_cmp, a, b, _cmp_lt_os);
+            if (!first)
+                korw(k_mask, k_mask, k_cmp);
+        } else {
+            vcmpps(first ? vmm_mask : vmm_cmp, a, b, _cmp_lt_os);
+            if (!first)
+                vorps(vmm_mask, vmm_mask, vmm_cmp);
+        }
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_nms_filter_kernel_f32 : public jit_uni_nms_filter_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_filter_kernel_f32)
+
+    explicit jit_uni_nms_filter_kernel_f32(jit_nms_config_params jcp) : jit_uni_nms_filter_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_scores, ptr[reg_params + GET_OFF_FILTER(scores)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF_FILTER(indices)]);
+        mov(reg_lanes, ptr[reg_params + GET_OFF_FILTER(lanes)]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF_FILTER(threshold)]);
+        uni_vbroadcastss(vmm_threshold, ptr[reg_tmp]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_FILTER(work_amount)]);
+        mov(reg_dst, reg_indices);
+
+        // the lanes of all kept scores are in the natural order, it gives the indices of the first vector
+        uni_vmovups(vmm_index, ptr[reg_lanes + lanes_order_offset(all_lanes_mask)]);
+        mov(reg_tmp.cvt32(), lanes);
+        if (isa == avx512_common) {
+            vpbroadcastd(vmm_step, reg_tmp.cvt32());
+        } else {
+            vmovd(Xbyak::Xmm(vmm_step.getIdx()), reg_tmp.cvt32());
+            vpbroadcastd(vmm_step, Xbyak::Xmm(vmm_step.getIdx()));
+        }
+
+        const int predicate = jcp_.strict_threshold ? _cmp_lt_os : _cmp_le_os;
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, lanes);
+            jl(main_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_score, ptr[reg_scores]);
+            if (isa == avx512_common) {
+                vcmpps(k_mask, vmm_threshold, vmm_score, predicate);
+                vpcompressd(vmm_dst | k_mask | T_z, vmm_index);
+                kmovw(reg_mask.cvt32(), k_mask);
+            } else {
+                vcmpps(vmm_mask, vmm_threshold, vmm_score, predicate);
+                vmovmskps(reg_mask.cvt32(), vmm_mask);
+                // the kept lanes are moved to the beginning of the vector by the permutation of the mask
+                mov(reg_tmp, reg_mask);
+                shl(reg_tmp, 5);
+                uni_vmovups(vmm_permutation, ptr[reg_lanes + reg_tmp]);
+                vpermd(vmm_dst, vmm_permutation, vmm_index);
+            }
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+            popcnt(reg_mask.cvt32(), reg_mask.cvt32());
+            lea(reg_dst, ptr[reg_dst + reg_mask * sizeof(int)]);
+
+            uni_vpaddd(vmm_index, vmm_index, vmm_step);
+            add(reg_scores, vlen);
+            sub(reg_work_amount, lanes);
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        sub(reg_dst, reg_indices);
+        shr(reg_dst, 2);
+        mov(ptr[reg_params + GET_OFF_FILTER(filtered)], reg_dst);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int lanes = vlen / sizeof(float);
+    const int all_lanes_mask = (1 << lanes) - 1;
+
+    // AVX-512 compresses the lanes by itself, the table has the natural order of the lanes only
+    int lanes_order_offset(int mask) const {
+        return isa == avx512_common ? 0 : mask * lanes * sizeof(int);
+    }
+
+    Xbyak::Reg64 reg_scores = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_lanes = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_mask = r13;
+    Xbyak::Reg64 reg_tmp = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_threshold = Vmm(0);
+    Vmm vmm_score = Vmm(1);
+    Vmm vmm_index = Vmm(2);
+    Vmm vmm_step = Vmm(3);
+    Vmm vmm_mask = Vmm(4);
+    Vmm vmm_permutation = Vmm(5);
+    Vmm vmm_dst = Vmm(6);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
+
+NmsKernel::NmsKernel(const jit_nms_config_params& params) : jcp(params) {
+    if (mayiuse(avx512_common)) {
+        iou_kernel.reset(new jit_uni_nms_iou_kernel_f32<avx512_common>(jcp));
+        filter_kernel.reset(new jit_uni_nms_filter_kernel_f32<avx512_common>(jcp));
+        lanes = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+        filter_lanes.resize(lanes);
+        std::iota(filter_lanes.begin(), filter_lanes.end(), 0);
+    } else if (mayiuse(avx2)) {
+        iou_kernel.reset(new jit_uni_nms_iou_kernel_f32<avx2>(jcp));
+        filter_kernel.reset(new jit_uni_nms_filter_kernel_f32<avx2>(jcp));
+        lanes = cpu_isa_traits<avx2>::vlen / sizeof(float);
+        // for each mask of the kept lanes: the kept lanes go first, the order of the rest does not matter
+        filter_lanes.resize((1 << lanes) * lanes, 0);
+        for (int mask = 0; mask < (1 << lanes); mask++) {
+            int* order = &filter_lanes[mask * lanes];
+            for (int lane = 0; lane < lanes; lane++) {
+                if (mask & (1 << lane))
+                    *order++ = lane;
+            }
+        }
+    }
+
+    if (iou_kernel)
+        iou_kernel->create_ker();
+    if (filter_kernel)
+        filter_kernel->create_ker();
+}
+
+float NmsKernel::area(const float* box) const {
+    if (jcp.matrix_iou && (box[NmsBoxes::C2] < box[NmsBoxes::C0] || box[NmsBoxes::C3] < box[NmsBoxes::C1]))
+        return 0.f;
+    return (box[NmsBoxes::C2] - box[NmsBoxes::C0] + jcp.norm) * (box[NmsBoxes::C3] - box[NmsBoxes::C1] + jcp.norm);
+}
+
+float NmsKernel::iou(const float* box, const NmsBoxes& boxes, size_t i) const {
+    const float c0 = boxes.field(NmsBoxes::C0)[i];
+    const float c1 = boxes.field(NmsBoxes::C1)[i];
+    const float c2 = boxes.field(NmsBoxes::C2)[i];
+    const float c3 = boxes.field(NmsBoxes::C3)[i];
+    const float area = boxes.field(NmsBoxes::AREA)[i];
+
+    float size0 = (std::min)(box[NmsBoxes::C2], c2) - (std::max)(box[NmsBoxes::C0], c0) + jcp.norm;
+    float size1 = (std::min)(box[NmsBoxes::C3], c3) - (std::max)(box[NmsBoxes::C1], c1) + jcp.norm;
+    if (jcp.matrix_iou) {
+        if (c0 > box[NmsBoxes::C2] || c2 < box[NmsBoxes::C0] || c1 > box[NmsBoxes::C3] || c3 < box[NmsBoxes::C1])
+            return 0.f;
+    } else {
+        if (box[NmsBoxes::AREA] <= 0.f || area <= 0.f)
+            return 0.f;
+        size0 = (std::max)(size0, 0.f);
+        size1 = (std::max)(size1, 0.f);
+    }
+
+    const float intersection = size0 * size1;
+    return intersection / (box[NmsBoxes::AREA] + area - intersection);
+}
+
+void NmsKernel::iou(const float* box, const NmsBoxes& boxes, size_t begin, size_t end, float* dst) const {
+    if (!jcp.matrix_iou && box[NmsBoxes::AREA] <= 0.f) {
+        std::fill(dst, dst + (end - begin), 0.f);
+        return;
+    }
+
+    size_t i = begin;
+    if (iou_kernel && end - begin >= static_cast<size_t>(lanes)) {
+        jit_nms_iou_call_args args;
+        args.box = box;
+        for (int f = 0; f < NmsBoxes::FIELDS_NUM; f++)
+            args.boxes[f] = boxes.field(f) + begin;
+        args.iou = dst;
+        args.work_amount = (end - begin) / lanes * lanes;
+        (*iou_kernel)(&args);
+        i += args.work_amount;
+    }
+    for (; i < end; i++)
+        dst[i - begin] = iou(box, boxes, i);
+}
+
+size_t NmsKernel::getFilterCapacity(size_t count) {
+    return count + maxLanes;
+}
+
+size_t NmsKernel::filter(const float* scores, size_t count, float threshold, int* indices) const {
+    size_t filtered = 0;
+    size_t i = 0;
+    if (filter_kernel && count >= static_cast<size_t>(lanes)) {
+        jit_nms_filter_call_args args;
+        args.scores = scores;
+        args.indices = indices;
+        args.lanes = filter_lanes.data();
+        args.threshold = &threshold;
+        args.work_amount = count / lanes * lanes;
+        args.filtered = 0;
+        (*filter_kernel)(&args);
+        filtered = args.filtered;
+        i = args.work_amount;
+    }
+    // the tail is compacted without branches as well
+    for (; i < count; i++) {
+        indices[filtered] = static_cast<int>(i);
+        filtered += jcp.strict_threshold ? scores[i] > threshold : scores[i] >= threshold;
+    }
+    return filtered;
+}
+
+bool NmsKernel::isSuppressed(const float* box, const NmsBoxes& kept, size_t begin, size_t end, float iouThreshold) const {
+    float iouValues[suppressChunkSize];
+    for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += suppressChunkSize) {
+        const size_t chunkEnd = (std::min)(end, chunkBegin + suppressChunkSize);
+        iou(box, kept, chunkBegin, chunkEnd, iouValues);
+        for (size_t i = 0; i < chunkEnd - chunkBegin; i++) {
+            if (iouValues[i] >= iouThreshold)
+                return true;
+        }
+    }
+    return false;
+}
+
+std::vector<int> NmsKernel::selectBoxes(const NmsBoxes& boxes, float iouThreshold, size_t maxOutput, bool parallel) const {
+    std::vector<int> selected;
+    const size_t count = boxes.size();
+    NmsBoxes kept;
+    kept.reset((std::min)(count, maxOutput));
+    selected.reserve((std::min)(count, maxOutput));
+
+    float box[NmsBoxes::FIELDS_NUM];
+    auto keepBox = [&](size_t i) {
+        kept.push_back(box, box[NmsBoxes::AREA]);
+        selected.push_back(static_cast<int>(i));
+    };
+
+    if (!parallel) {
+        for (size_t i = 0; i < count && selected.size() < maxOutput; i++) {
+            boxes.get(i, box);
+            if (!isSuppressed(box, kept, 0, kept.size(), iouThreshold))
+                keepBox(i);
+        }
+        return selected;
+    }
+
+    // The boxes of a block are checked against the boxes kept before the block in parallel, then the rest of them
+    // are checked against the boxes kept from the same block in order, so the result is the same as of the serial one
+    const size_t blockSize = parallel_get_max_threads() * selectBlockPerThread;
+    std::vector<uint8_t> suppressed(blockSize);
+    for (size_t blockBegin = 0; blockBegin < count && selected.size() < maxOutput; blockBegin += blockSize) {
+        const size_t blockEnd = (std::min)(count, blockBegin + blockSize);
+        const size_t keptBefore = kept.size();
+        parallel_for(blockEnd - blockBegin, [&](size_t i) {
+            float candidate[NmsBoxes::FIELDS_NUM];
+            boxes.get(blockBegin + i, candidate);
+            suppressed[i] = isSuppressed(candidate, kept, 0, keptBefore, iouThreshold);
+        });
+
+        for (size_t i = blockBegin; i < blockEnd && selected.size() < maxOutput; i++) {
+            if (suppressed[i - blockBegin])
+                continue;
+            boxes.get(i, box);
+            if (!isSuppressed(box, kept, keptBefore, kept.size(), iouThreshold))
+                keepBox(i);
+        }
+    }
+    return selected;
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_nms_config_params {
+    bool matrix_iou;        // IoU of MatrixNms: the boxes which do not overlap by bounds have zero IoU, the areas are not checked
+    float norm;             // added to the sizes of the boxes, 1 for the boxes which coordinates are not normalized
+    bool strict_threshold;  // the scores greater than the threshold are kept, the scores not less than it otherwise
+};
+
+struct jit_nms_iou_call_args {
+    const float* box;       // corners and area of the box
+    const float* boxes[5];  // corners and areas of the boxes
+    float* iou;
+    size_t work_amount;     // multiple of the vector length
+};
+
+struct jit_nms_filter_call_args {
+    const float* scores;
+    int* indices;           // the kept indices are written by the full vectors
+    const int* lanes;       // lanes order of the vector for each mask of the kept scores
+    const float* threshold;
+    size_t work_amount;     // multiple of the vector length
+    size_t filtered;        // output: number of the kept scores
+};
+
+struct jit_uni_nms_iou_kernel {
+    void (*ker_)(const jit_nms_iou_call_args *);
+
+    void operator()(const jit_nms_iou_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_nms_iou_kernel(jit_nms_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_nms_iou_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_nms_config_params jcp_;
+};
+
+struct jit_uni_nms_filter_kernel {
+    void (*ker_)(jit_nms_filter_call_args *);
+
+    void operator()(jit_nms_filter_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_nms_filter_kernel(jit_nms_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_nms_filter_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_nms_config_params jcp_;
+};
+
+/**
+ * Boxes in the structure of arrays layout: each corner coordinate and the area are stored in their own array,
+ * so the IoU of one box with many others is computed by full vector loads. The corners are (C0, C1) and (C2, C3),
+ * the order of the axes is defined by the node.
+ */
+class NmsBoxes {
+public:
+    enum Field { C0, C1, C2, C3, AREA, FIELDS_NUM };
+
+    void reset(size_t capacity) {
+        capacity_ = capacity;
+        size_ = 0;
+        data_.resize(capacity * FIELDS_NUM);
+    }
+
+    void push_back(const float* box, float area) {
+        assert(size_ < capacity_);
+        for (int f = C0; f <= C3; f++)
+            data_[f * capacity_ + size_] = box[f];
+        data_[AREA * capacity_ + size_] = area;
+        size_++;
+    }
+
+    // corners and area of the i-th box
+    void get(size_t i, float* box) const {
+        for (int f = C0; f < FIELDS_NUM; f++)
+            box[f] = data_[f * capacity_ + i];
+    }
+
+    const float* field(int f) const {
+        return data_.data() + f * capacity_;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+private:
+    std::vector<float> data_;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+};
+
+/**
+ * Vectorized parts of the NonMaxSuppression family: the filtering of the scores by the threshold with the compaction
+ * of the kept indices, the IoU of one box with many others and the greedy selection of the boxes.
+ */
+class NmsKernel {
+public:
+    explicit NmsKernel(const jit_nms_config_params& params);
+
+    float area(const float* box) const;
+
+    // The IoU of the box with the boxes [begin, end), the box is given by its corners and area
+    void iou(const float* box, const NmsBoxes& boxes, size_t begin, size_t end, float* dst) const;
+    float iou(const float* box, const NmsBoxes& boxes, size_t i) const;
+
+    // Writes the ascending indices of the kept scores, the buffer must have room for getFilterCapacity(count) indices
+    size_t filter(const float* scores, size_t count, float threshold, int* indices) const;
+    static size_t getFilterCapacity(size_t count);
+
+    // Greedy selection of the boxes sorted by the scores: a box is kept if its IoU with each of the kept boxes is less
+    // than the threshold. Returns the positions of the kept boxes, at most maxOutput of them. If the selection is
+    // parallel, the blocks of the boxes are checked against the boxes kept before the block by all threads.
+    std::vector<int> selectBoxes(const NmsBoxes& boxes, float iouThreshold, size_t maxOutput, bool parallel) const;
+
+private:
+    jit_nms_config_params jcp;
+    int lanes = 1;
+    std::shared_ptr<jit_uni_nms_iou_kernel> iou_kernel;
+    std::shared_ptr<jit_uni_nms_filter_kernel> filter_kernel;
+    std::vector<int> filter_lanes;
+
+    bool isSuppressed(const float* box, const NmsBoxes& kept, size_t begin, size_t end, float iouThreshold) const;
+};
+
+}  // namespace MKLDNNPlugin
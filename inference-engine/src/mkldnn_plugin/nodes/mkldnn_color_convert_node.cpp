@@ -0,0 +1,550 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_color_convert_node.h"
+
+#include <mkldnn.hpp>
+#include <mkldnn_extension_utils.h>
+
+#include <ngraph/opsets/opset8.hpp>
+
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_color_convert_call_args, field)
+
+namespace {
+// conversion coefficients, the same as in the ngraph reference implementation
+constexpr float yScale = 1.164f;
+constexpr float yShift = -16.f;
+constexpr float uvShift = -128.f;
+constexpr float rFromV = 1.596f;
+constexpr float gFromU = -0.391f;
+constexpr float gFromV = -0.813f;
+constexpr float bFromU = 2.018f;
+constexpr float maxValue = 255.f;
+}  // namespace
+
+/*
+ * The kernel converts work_amount pixels of an image row, work_amount must be a multiple of the vector length.
+ * Y, U and V values are loaded to separate vectors, the chroma values are duplicated for the pairs of pixels with
+ * a permutation. R, G and B vectors are interleaved with permutations and blends and stored as is, so the output
+ * of a step is 3 full vectors.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_color_convert_kernel_f32 : public jit_uni_color_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_color_convert_kernel_f32);
+
+    explicit jit_uni_color_convert_kernel_f32(jit_color_convert_params jcp) : jit_uni_color_convert_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_y, ptr[reg_params + GET_OFF(y)]);
+        mov(reg_u, ptr[reg_params + GET_OFF(u)]);
+        mov(reg_v, ptr[reg_params + GET_OFF(v)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_aux.getIdx())};
+
+        const int src_size = jcp_.src_prc.size();
+        const int dst_size = jcp_.dst_prc.size();
+
+        Label main_loop_label;
+        Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            convert_block();
+
+            add(reg_y, step * src_size);
+            if (jcp_.nv12) {
+                add(reg_u, step * src_size);
+            } else {
+                add(reg_u, step / 2 * src_size);
+                add(reg_v, step / 2 * src_size);
+            }
+            add(reg_dst, 3 * step * dst_size);
+
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+
+        prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    enum TableEntry {
+        Y_SCALE,
+        Y_SHIFT,
+        UV_SHIFT,
+        R_FROM_V,
+        G_FROM_U,
+        G_FROM_V,
+        B_FROM_U,
+        ZERO,
+        MAX_VALUE,
+        SIGN_MASK,
+        ROUND_HALF,
+        CHROMA_IDX_U,
+        CHROMA_IDX_V,
+        INTERLEAVE_IDX,             // 3 entries, one per output vector
+        SCALES = INTERLEAVE_IDX + 3,
+        SHIFTS = SCALES + 3
+    };
+
+    Vmm vmm_y = Vmm(0);
+    Vmm vmm_u = Vmm(1);
+    Vmm vmm_v = Vmm(2);
+    Vmm vmm_r = Vmm(3);
+    Vmm vmm_g = Vmm(4);
+    Vmm vmm_b = Vmm(5);
+    Vmm vmm_idx = Vmm(6);
+    Vmm vmm_dst0 = Vmm(7);
+    Vmm vmm_dst1 = Vmm(8);
+    Vmm vmm_dst2 = Vmm(9);
+    Vmm vmm_aux = Vmm(10);
+
+    Opmask k_blend_mask = Opmask(1);
+
+    using reg64_t = const Xbyak::Reg64;
+    reg64_t reg_y = r8;
+    reg64_t reg_u = r9;
+    reg64_t reg_v = r10;
+    reg64_t reg_dst = r11;
+    reg64_t reg_work_amount = r12;
+    reg64_t reg_table = r13;
+    reg64_t reg_tmp = r14;
+    reg64_t reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = abi_param1;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+
+    Xbyak::Label l_table;
+
+    inline Xbyak::Address table_val(int index) {
+        return ptr[reg_table + index * vlen];
+    }
+
+    void load(const Xbyak::Reg64& reg_src, const Vmm& vmm_dst, int load_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_dst.getIdx())},
+                                std::make_shared<load_emitter_context>(jcp_.src_prc, Precision::FP32, load_num),
+                                {}, load_pool_gpr_idxs);
+    }
+
+    void blend(const Vmm& vmm_dst, const Vmm& vmm_src, uint32_t mask) {
+        if (isa == cpu::x64::avx512_common) {
+            mov(reg_tmp.cvt32(), mask);
+            kmovw(k_blend_mask, reg_tmp.cvt32());
+            vblendmps(vmm_dst | k_blend_mask, vmm_dst, vmm_src);
+        } else {
+            vblendps(vmm_dst, vmm_dst, vmm_src, mask);
+        }
+    }
+
+    void convert_block() {
+        load(reg_y, vmm_y, step);
+        if (jcp_.nv12) {
+            load(reg_u, vmm_u, step);
+            uni_vmovups(vmm_idx, table_val(CHROMA_IDX_V));
+            vpermps(vmm_v, vmm_idx, vmm_u);
+            uni_vmovups(vmm_idx, table_val(CHROMA_IDX_U));
+            vpermps(vmm_u, vmm_idx, vmm_u);
+        } else {
+            load(reg_u, vmm_u, step / 2);
+            load(reg_v, vmm_v, step / 2);
+            uni_vmovups(vmm_idx, table_val(CHROMA_IDX_U));
+            vpermps(vmm_u, vmm_idx, vmm_u);
+            vpermps(vmm_v, vmm_idx, vmm_v);
+        }
+
+        // y = 1.164 * (Y - 16), u = U - 128, v = V - 128
+        // the products and the sums are not fused and go in the order of the reference, so the results are bit exact
+        uni_vaddps(vmm_y, vmm_y, table_val(Y_SHIFT));
+        uni_vmulps(vmm_aux, vmm_y, table_val(Y_SCALE));
+        uni_vaddps(vmm_u, vmm_u, table_val(UV_SHIFT));
+        uni_vaddps(vmm_v, vmm_v, table_val(UV_SHIFT));
+
+        uni_vmulps(vmm_r, vmm_v, table_val(R_FROM_V));
+        uni_vaddps(vmm_r, vmm_r, vmm_aux);
+        uni_vmulps(vmm_g, vmm_u, table_val(G_FROM_U));
+        uni_vaddps(vmm_g, vmm_g, vmm_aux);
+        uni_vmulps(vmm_idx, vmm_v, table_val(G_FROM_V));
+        uni_vaddps(vmm_g, vmm_g, vmm_idx);
+        uni_vmulps(vmm_b, vmm_u, table_val(B_FROM_U));
+        uni_vaddps(vmm_b, vmm_b, vmm_aux);
+
+        const Vmm channels[3] = {jcp_.rgb ? vmm_r : vmm_b, vmm_g, jcp_.rgb ? vmm_b : vmm_r};
+        for (int c = 0; c < 3; c++) {
+            if (jcp_.round) {
+                // std::round: the largest float below 0.5 is added with the sign of the value and the sum is truncated,
+                // 0.5 itself would round 0.49999997 up
+                uni_vandps(vmm_aux, channels[c], table_val(SIGN_MASK));
+                uni_vorps(vmm_aux, vmm_aux, table_val(ROUND_HALF));
+                uni_vaddps(channels[c], channels[c], vmm_aux);
+                uni_vroundps(channels[c], channels[c], 3);  // truncate
+            }
+            uni_vmaxps(channels[c], channels[c], table_val(ZERO));
+            uni_vminps(channels[c], channels[c], table_val(MAX_VALUE));
+            if (jcp_.scaleShift) {
+                uni_vmulps(channels[c], channels[c], table_val(SCALES + c));
+                uni_vaddps(channels[c], channels[c], table_val(SHIFTS + c));
+            }
+        }
+
+        // interleaving: element j of the output vector k is the channel (k * step + j) % 3 of the pixel (k * step + j) / 3
+        for (int k = 0; k < 3; k++) {
+            uint32_t mask1 = 0, mask2 = 0;
+            for (int j = 0; j < step; j++) {
+                const int channel = (k * step + j) % 3;
+                mask1 |= static_cast<uint32_t>(channel == 1) << j;
+                mask2 |= static_cast<uint32_t>(channel == 2) << j;
+            }
+
+            uni_vmovups(vmm_idx, table_val(INTERLEAVE_IDX + k));
+            vpermps(vmm_dst0, vmm_idx, channels[0]);
+            vpermps(vmm_dst1, vmm_idx, channels[1]);
+            vpermps(vmm_dst2, vmm_idx, channels[2]);
+            blend(vmm_dst0, vmm_dst1, mask1);
+            blend(vmm_dst0, vmm_dst2, mask2);
+
+            store_emitter->emit_code({static_cast<size_t>(vmm_dst0.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                                     std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_prc, step,
+                                                                             k * step * static_cast<int>(jcp_.dst_prc.size())),
+                                     store_pool_vec_idxs, store_pool_gpr_idxs);
+        }
+    }
+
+    void prepare_table() {
+        auto broadcast = [&](float value) {
+            for (int d = 0; d < step; ++d)
+                dd(float2int(value));
+        };
+
+        align(64);
+        L(l_table);
+
+        broadcast(yScale);
+        broadcast(yShift);
+        broadcast(uvShift);
+        broadcast(rFromV);
+        broadcast(gFromU);
+        broadcast(gFromV);
+        broadcast(bFromU);
+        broadcast(0.f);
+        broadcast(maxValue);
+        for (int d = 0; d < step; ++d)
+            dd(0x80000000);
+        broadcast(std::nextafter(0.5f, 0.f));
+
+        // NV12: U and V values are interleaved, I420: U and V values are loaded to the separate vectors
+        for (int d = 0; d < step; ++d)
+            dd(jcp_.nv12 ? (d / 2) * 2 : d / 2);
+        for (int d = 0; d < step; ++d)
+            dd(jcp_.nv12 ? (d / 2) * 2 + 1 : d / 2);
+
+        for (int k = 0; k < 3; k++) {
+            for (int d = 0; d < step; ++d)
+                dd((k * step + d) / 3);
+        }
+
+        for (int c = 0; c < 3; c++)
+            broadcast(jcp_.scales[c]);
+        for (int c = 0; c < 3; c++)
+            broadcast(jcp_.shifts[c]);
+    }
+};
+
+namespace {
+template <typename src_t, typename dst_t>
+void convertRow(const jit_color_convert_params& jcp, const src_t* y, const src_t* u, const src_t* v, dst_t* dst,
+                size_t start, size_t end) {
+    for (size_t x = start; x < end; x++) {
+        const float yVal = yScale * (static_cast<float>(y[x]) + yShift);
+        float uVal, vVal;
+        if (jcp.nv12) {
+            uVal = static_cast<float>(u[(x / 2) * 2]) + uvShift;
+            vVal = static_cast<float>(u[(x / 2) * 2 + 1]) + uvShift;
+        } else {
+            uVal = static_cast<float>(u[x / 2]) + uvShift;
+            vVal = static_cast<float>(v[x / 2]) + uvShift;
+        }
+
+        const float r = yVal + rFromV * vVal;
+        const float g = yVal + gFromU * uVal + gFromV * vVal;
+        const float b = yVal + bFromU * uVal;
+        const float channels[3] = {jcp.rgb ? r : b, g, jcp.rgb ? b : r};
+        for (int c = 0; c < 3; c++) {
+            float value = jcp.round ? std::round(channels[c]) : channels[c];
+            value = std::min(std::max(value, 0.f), maxValue);
+            if (jcp.scaleShift)
+                value = value * jcp.scales[c] + jcp.shifts[c];
+            dst[x * 3 + c] = static_cast<dst_t>(value);
+        }
+    }
+}
+}  // namespace
+
+bool MKLDNNColorConvertNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!one_of(op->get_type_info(), ngraph::opset8::NV12toRGB::get_type_info_static(), ngraph::opset8::NV12toBGR::get_type_info_static(),
+                                         ngraph::opset8::I420toRGB::get_type_info_static(), ngraph::opset8::I420toBGR::get_type_info_static())) {
+            errorMessage = "Only opset8 NV12toRGB, NV12toBGR, I420toRGB and I420toBGR operations are supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNColorConvertNode::MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                               MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ColorConvert node with name '" + getName() + "'";
+
+    if (ov::is_type<ngraph::opset8::NV12toRGB>(op)) {
+        algorithm = ColorConvertNV12toRGB;
+    } else if (ov::is_type<ngraph::opset8::NV12toBGR>(op)) {
+        algorithm = ColorConvertNV12toBGR;
+    } else if (ov::is_type<ngraph::opset8::I420toRGB>(op)) {
+        algorithm = ColorConvertI420toRGB;
+    } else {
+        algorithm = ColorConvertI420toBGR;
+    }
+
+    jcp.nv12 = one_of(algorithm, ColorConvertNV12toRGB, ColorConvertNV12toBGR);
+    jcp.rgb = one_of(algorithm, ColorConvertNV12toRGB, ColorConvertI420toRGB);
+    for (int c = 0; c < 3; c++) {
+        jcp.scales[c] = 1.f;
+        jcp.shifts[c] = 0.f;
+    }
+
+    const size_t planesNum = jcp.nv12 ? 2 : 3;
+    if (getOriginalInputsNumber() != 1 && getOriginalInputsNumber() != planesNum)
+        IE_THROW() << errorPrefix << " has incorrect number of input edges";
+    if (getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of output edges";
+
+    isSinglePlane = getOriginalInputsNumber() == 1;
+}
+
+Precision MKLDNNColorConvertNode::getOutputPrecision() const {
+    if (!fusedWith.empty())
+        return fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+    return getOriginalInputPrecisionAtPort(0) == Precision::U8 ? Precision::U8 : Precision::FP32;
+}
+
+bool MKLDNNColorConvertNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (node->getType() == Convert) {
+        // the converted values must be equal to the rounded ones, so only conversion to FP32 is fused
+        return fusedWith.empty() && node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    }
+
+    if (node->getType() != Eltwise || getOutputPrecision() != Precision::FP32 || !node->getFusedWith().empty() ||
+        !one_of(node->getAlgorithm(), EltwiseAdd, EltwiseSubtract, EltwiseMultiply, EltwiseDivide) ||
+        node->getParentEdges().size() != 2)
+        return false;
+
+    const size_t dataPort = node->getParentEdgesAtPort(0)[0]->getParent().get() == this ? 0 : 1;
+    if (dataPort == 1 && one_of(node->getAlgorithm(), EltwiseSubtract, EltwiseDivide))
+        return false;
+
+    const auto constParent = node->getParentEdgesAtPort(1 - dataPort)[0]->getParent();
+    if (constParent->getType() != Input || !constParent->isConstant() || constParent->getChildEdges().size() != 1)
+        return false;
+
+    // per-tensor or per output channel (the innermost NHWC dimension) values
+    const auto& constDims = node->getInputShapeAtPort(1 - dataPort).getDims();
+    if (constDims.size() > getOutputShapeAtPort(0).getRank())
+        return false;
+    for (size_t i = 0; i + 1 < constDims.size(); i++) {
+        if (constDims[i] != 1)
+            return false;
+    }
+    return constDims.empty() || one_of(constDims.back(), 1u, 3u);
+}
+
+void MKLDNNColorConvertNode::fuseScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts) {
+    auto valueAt = [](const std::vector<float>& values, int c, float defaultValue) {
+        return values.empty() ? defaultValue : values[values.size() == 1 ? 0 : c];
+    };
+    for (int c = 0; c < 3; c++) {
+        const float scale = valueAt(scales, c, 1.f);
+        jcp.scales[c] *= scale;
+        jcp.shifts[c] = jcp.shifts[c] * scale + valueAt(shifts, c, 0.f);
+    }
+    jcp.scaleShift = true;
+}
+
+void MKLDNNColorConvertNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    jcp.src_prc = getOriginalInputPrecisionAtPort(0) == Precision::U8 ? Precision::U8 : Precision::FP32;
+    jcp.dst_prc = getOutputPrecision();
+    // the original operation clips and rounds the values for the integral precision
+    jcp.round = jcp.src_prc == Precision::U8;
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
+    std::vector<PortConfigurator> inDataConf(getOriginalInputsNumber(), {LayoutType::ncsp, jcp.src_prc});
+    addSupportedPrimDesc(inDataConf,
+                         {{LayoutType::ncsp, jcp.dst_prc}},
+                         impl_type);
+}
+
+void MKLDNNColorConvertNode::createPrimitive() {
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " has not allocated destination memory";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto &srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << " has not allocated input memory";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<cpu::x64::avx512_common>(jcp));
+        kernelStep = cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float);
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<cpu::x64::avx2>(jcp));
+        kernelStep = cpu_isa_traits<cpu::x64::avx2>::vlen / sizeof(float);
+    }
+    if (kernel)
+        kernel->create_ker();
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNColorConvertNode::executeRef(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* dst,
+                                        size_t batch, size_t height, size_t width, size_t yBatchStride, size_t uvBatchStride) {
+    const auto srcY = reinterpret_cast<const src_t*>(y);
+    const auto srcU = reinterpret_cast<const src_t*>(u);
+    const auto srcV = reinterpret_cast<const src_t*>(v);
+    const auto dstData = reinterpret_cast<dst_t*>(dst);
+    const size_t uvRowStride = jcp.nv12 ? width : width / 2;
+    const size_t jitWork = kernel ? width - width % kernelStep : 0;
+
+    parallel_for2d(batch, height, [&](size_t b, size_t h) {
+        const src_t* yRow = srcY + b * yBatchStride + h * width;
+        const src_t* uRow = srcU + b * uvBatchStride + (h / 2) * uvRowStride;
+        const src_t* vRow = jcp.nv12 ? nullptr : srcV + b * uvBatchStride + (h / 2) * uvRowStride;
+        dst_t* dstRow = dstData + (b * height + h) * width * 3;
+
+        if (jitWork) {
+            auto args = jit_color_convert_call_args();
+            args.y = yRow;
+            args.u = uRow;
+            args.v = vRow;
+            args.dst = dstRow;
+            args.work_amount = jitWork;
+            (*kernel)(&args);
+        }
+        convertRow(jcp, yRow, uRow, vRow, dstRow, jitWork, width);
+    });
+}
+
+void MKLDNNColorConvertNode::execute(mkldnn::stream strm) {
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    const size_t batch = dstDims[0];
+    const size_t height = dstDims[1];
+    const size_t width = dstDims[2];
+    const size_t srcSize = jcp.src_prc.size();
+
+    const auto src0 = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const uint8_t *y = src0, *u = nullptr, *v = nullptr;
+    size_t yBatchStride = height * width, uvBatchStride = 0;
+    if (isSinglePlane) {
+        yBatchStride = height * width * 3 / 2;
+        uvBatchStride = yBatchStride;
+        u = src0 + height * width * srcSize;
+        v = jcp.nv12 ? nullptr : src0 + height * width * 5 / 4 * srcSize;
+    } else {
+        u = reinterpret_cast<const uint8_t*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+        if (jcp.nv12) {
+            uvBatchStride = height * width / 2;
+        } else {
+            v = reinterpret_cast<const uint8_t*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+            uvBatchStride = height * width / 4;
+        }
+    }
+
+    if (jcp.src_prc == Precision::U8 && jcp.dst_prc == Precision::U8) {
+        executeRef<uint8_t, uint8_t>(y, u, v, dst, batch, height, width, yBatchStride, uvBatchStride);
+    } else if (jcp.src_prc == Precision::U8) {
+        executeRef<uint8_t, float>(y, u, v, dst, batch, height, width, yBatchStride, uvBatchStride);
+    } else {
+        executeRef<float, float>(y, u, v, dst, batch, height, width, yBatchStride, uvBatchStride);
+    }
+}
+
+bool MKLDNNColorConvertNode::created() const {
+    return getType() == ColorConvert;
+}
@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_node.h>
+#include <ie_common.h>
+
+#include <cassert>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_color_convert_params {
+    bool nv12;      // NV12 (interleaved UV plane) or I420 (separate U and V planes)
+    bool rgb;       // RGB or BGR order of the output channels
+    bool round;     // the original output precision is integral
+    bool scaleShift;
+
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+
+    // per output channel scales and shifts of the fused normalization
+    float scales[3];
+    float shifts[3];
+};
+
+struct jit_color_convert_call_args {
+    const void *y;
+    const void *u;  // interleaved UV plane for NV12
+    const void *v;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_color_convert_kernel {
+    void (*ker_)(const jit_color_convert_call_args *);
+
+    void operator()(const jit_color_convert_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_color_convert_kernel(jit_color_convert_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_color_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_color_convert_params jcp_;
+};
+
+/**
+ * NV12/I420 to RGB/BGR color conversion. Single plane and multi plane inputs are supported.
+ * The node absorbs the following Convert to FP32 and per-channel Add/Subtract/Multiply/Divide
+ * normalization, so the preprocessing is performed in a single pass over the image.
+ */
+class MKLDNNColorConvertNode : public MKLDNNNode {
+public:
+    MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+    bool canFuse(const MKLDNNNodePtr& node) const override;
+
+    /**
+     * @brief Appends per-channel (or per-tensor) scales and shifts of the fused Eltwise node to the output normalization
+     */
+    void fuseScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts);
+
+    // the kernel does not depend on the input shapes
+    void prepareParams() override {}
+
+protected:
+    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
+
+private:
+    template <typename src_t, typename dst_t>
+    void executeRef(const uint8_t* y, const uint8_t* u, const uint8_t* v, uint8_t* dst,
+                    size_t batch, size_t height, size_t width, size_t yBatchStride, size_t uvBatchStride);
+
+    InferenceEngine::Precision getOutputPrecision() const;
+
+    bool isSinglePlane = true;
+    jit_color_convert_params jcp = {};
+    std::shared_ptr<jit_uni_color_convert_kernel> kernel;
+    size_t kernelStep = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -17,15 +17,62 @@
 #include <utils/general_utils.h>
 #include <ngraph/ops.hpp>
 #include <cpu/x64/jit_generator.hpp>
+#include <common/primitive_attr.hpp>
 #include "common/cpu_convert.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "cache/hash_utils.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+struct ConvKey {
+    mkldnn::memory::desc inp0;
+    mkldnn::memory::desc inp1;
+    mkldnn::memory::desc bias;
+    mkldnn::memory::desc out;
+
+    std::vector<size_t> stride;
+    std::vector<ptrdiff_t> dilation;
+    std::vector<ptrdiff_t> paddingL;
+    std::vector<ptrdiff_t> paddingR;
+
+    mkldnn::algorithm alg;
+    MKLDNNNode::AttrPtr attr;
+    impl_desc_type implType;
+
+    size_t hash() const;
+    bool operator==(const ConvKey& rhs) const;
+};
+
+size_t ConvKey::hash() const {
+    size_t seed = 0;
+    for (const auto& desc : {inp0, inp1, bias, out})
+        seed = hash_combine(seed, get_md_hash(desc));
+
+    seed = hash_combine(seed, stride);
+    seed = hash_combine(seed, dilation);
+    seed = hash_combine(seed, paddingL);
+    seed = hash_combine(seed, paddingR);
+
+    seed = hash_combine(seed, static_cast<int>(alg));
+    seed = hash_combine(seed, get_attr_hash(*attr));
+    seed = hash_combine(seed, static_cast<int>(implType));
+    return seed;
+}
+
+bool ConvKey::operator==(const ConvKey &rhs) const {
+    return inp0 == rhs.inp0 && inp1 == rhs.inp1 && bias == rhs.bias && out == rhs.out &&
+           stride == rhs.stride && dilation == rhs.dilation && paddingL == rhs.paddingL && paddingR == rhs.paddingR &&
+           alg == rhs.alg && *attr->get() == *rhs.attr->get() && implType == rhs.implType;
+}
+
+}  // namespace
+
 bool MKLDNNConvolutionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ngraph::is_type<ngraph::op::v1::Convolution>(op) && !ngraph::is_type<ngraph::op::v1::GroupConvolution>(op)) {
@@ -947,42 +994,62 @@ void MKLDNNConvolutionNode::prepareParams() {
         pAttrLocal = initPrimitiveAttr();
     }
 
-    std::shared_ptr<mkldnn::convolution_forward::desc> dnnlConvDesc;
     auto alg = isWinograd() ? mkldnn::algorithm::convolution_winograd : mkldnn::algorithm::convolution_direct;
 
+    mkldnn::memory::desc dnnlBiasDesc;
     if (withBiases) {
         auto biasMemoryDesc = getParentEdgesAtPort(2).front()->getMemory().GetDescWithType<DnnlMemoryDesc>();
         // WA to align IR bias representation (3 to 5 rank tensors) to oneDNN representation (1 rank tensor)
-        mkldnn::memory::desc dnnlBiasDesc = biasMemoryDesc->getDnnlDesc().reshape(MKLDNNExtensionUtils::convertToDnnlDims(biasesDims));
-        dnnlConvDesc = createDescriptorInternal(inMemoryDesc->getDnnlDesc(),
-                                                weightMemoryDesc->getDnnlDesc(),
-                                                dnnlBiasDesc,
-                                                outMemoryDesc->getDnnlDesc(),
-                                                alg);
-    } else {
-        dnnlConvDesc = createDescriptorInternal(inMemoryDesc->getDnnlDesc(),
-                                                weightMemoryDesc->getDnnlDesc(),
-                                                outMemoryDesc->getDnnlDesc(),
-                                                alg);
+        dnnlBiasDesc = biasMemoryDesc->getDnnlDesc().reshape(MKLDNNExtensionUtils::convertToDnnlDims(biasesDims));
     }
 
-    MKLDNNDescriptor desc(dnnlConvDesc);
+    updatePadding();
+    ConvKey key = {inMemoryDesc->getDnnlDesc(),
+                   weightMemoryDesc->getDnnlDesc(),
+                   dnnlBiasDesc,
+                   outMemoryDesc->getDnnlDesc(),
+                   stride,
+                   dilation,
+                   paddingL,
+                   paddingR,
+                   alg,
+                   pAttrLocal,
+                   selected_pd->getImplementationType()};
+
+    auto builder = [this](const ConvKey& key) -> std::shared_ptr<mkldnn::primitive> {
+        std::shared_ptr<mkldnn::convolution_forward::desc> dnnlConvDesc;
+        if (withBiases) {
+            dnnlConvDesc = createDescriptorInternal(key.inp0, key.inp1, key.bias, key.out, key.alg);
+        } else {
+            dnnlConvDesc = createDescriptorInternal(key.inp0, key.inp1, key.out, key.alg);
+        }
+
+        MKLDNNDescriptor desc(dnnlConvDesc);
 
-    auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *pAttrLocal);
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *key.attr);
 
-    convolution_forward::primitive_desc prim_desc;
-    while (static_cast<bool>(itpd))  {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+        convolution_forward::primitive_desc prim_desc;
+        while (static_cast<bool>(itpd))  {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
-        if (impl_type == selected_pd->getImplementationType()) {
-            prim_desc = convolution_forward::primitive_desc(itpd.get());
-            break;
+            if (impl_type == key.implType) {
+                prim_desc = convolution_forward::primitive_desc(itpd.get());
+                break;
+            }
+            if (!itpd.next_impl())
+                return nullptr;
         }
-        if (!itpd.next_impl())
-            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+
+        return std::make_shared<convolution_forward>(prim_desc);
+    };
+
+    auto result = getRuntimeCache()->getOrCreate(key, builder);
+
+    if (!result.first) {
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
     }
 
-    prim.reset(new convolution_forward(prim_desc));
+    prim = result.first;
 
     primArgs[DNNL_ARG_SRC] = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs[DNNL_ARG_WEIGHTS] = getWeights();
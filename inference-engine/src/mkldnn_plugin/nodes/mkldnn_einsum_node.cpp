@@ -0,0 +1,496 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_einsum_node.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset7.hpp>
+#include "ie_parallel.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the letters and the axes of the ellipsis
+constexpr size_t maxLabels = 64;
+
+const char ellipsis[] = "...";
+
+SizeVector getDenseStrides(const SizeVector& dims) {
+    SizeVector strides(dims.size(), 1);
+    for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+        strides[i] = strides[i + 1] * dims[i + 1];
+    return strides;
+}
+
+bool contains(const std::vector<size_t>& labels, size_t label) {
+    return std::find(labels.begin(), labels.end(), label) != labels.end();
+}
+
+// element offsets of the flat indices [start, start + count) of the axes with the given dims and strides
+void fillOffsets(const std::vector<size_t>& dims, const std::vector<size_t>& strides, size_t start, size_t count, size_t* offsets) {
+    const int rank = static_cast<int>(dims.size());
+    size_t index[maxLabels];
+    size_t offset = 0;
+    for (int d = rank - 1; d >= 0; d--) {
+        index[d] = start % dims[d];
+        start /= dims[d];
+        offset += index[d] * strides[d];
+    }
+    for (size_t i = 0; i < count; i++) {
+        offsets[i] = offset;
+        for (int d = rank - 1; d >= 0; d--) {
+            offset += strides[d];
+            if (++index[d] < dims[d])
+                break;
+            offset -= index[d] * strides[d];
+            index[d] = 0;
+        }
+    }
+}
+
+}  // namespace
+
+bool MKLDNNEinsumNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!ngraph::is_type<const ngraph::op::v7::Einsum>(op)) {
+            errorMessage = "Only opset7 Einsum operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+bool MKLDNNEinsumNode::isDecomposable(const std::shared_ptr<const ngraph::Node>& op) noexcept {
+    try {
+        const auto einsum = ngraph::as_type_ptr<const ngraph::op::v7::Einsum>(op);
+        if (!einsum)
+            return false;
+        std::vector<std::string> inputSubscripts;
+        std::string outputSubscript;
+        ngraph::op::v7::Einsum::parse_equation(einsum->get_equation(), inputSubscripts, outputSubscript);
+        for (const auto& subscript : inputSubscripts) {
+            auto labels = ngraph::op::v7::Einsum::extract_labels(subscript);
+            if (std::find(labels.begin(), labels.end(), ellipsis) != labels.end())
+                return false;
+            std::sort(labels.begin(), labels.end());
+            if (std::adjacent_find(labels.begin(), labels.end()) != labels.end())
+                return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNEinsumNode::MKLDNNEinsumNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                   MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Einsum node with name '" + op->get_friendly_name() + "' ";
+    const auto einsum = ngraph::as_type_ptr<const ngraph::op::v7::Einsum>(op);
+    const size_t inputsNum = getOriginalInputsNumber();
+    if (inputsNum == 0)
+        IE_THROW() << errorPrefix << "has incorrect number of input edges";
+    if (getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << "has incorrect number of output edges";
+
+    std::vector<std::string> inputSubscripts;
+    std::string outputSubscript;
+    ngraph::op::v7::Einsum::parse_equation(einsum->get_equation(), inputSubscripts, outputSubscript);
+    if (inputSubscripts.size() != inputsNum)
+        IE_THROW() << errorPrefix << "has the equation which does not match the number of inputs";
+
+    // the ellipsis axes are numpy broadcasted, so the ellipsis of each input covers the last of the ellipsis labels
+    std::vector<std::vector<std::string>> inputLabels(inputsNum);
+    size_t ellipsisRank = 0;
+    for (size_t i = 0; i < inputsNum; i++) {
+        inputLabels[i] = ngraph::op::v7::Einsum::extract_labels(inputSubscripts[i]);
+        const size_t rank = op->get_input_shape(i).size();
+        const bool withEllipsis = std::find(inputLabels[i].begin(), inputLabels[i].end(), ellipsis) != inputLabels[i].end();
+        if (withEllipsis ? rank + 1 < inputLabels[i].size() : rank != inputLabels[i].size())
+            IE_THROW() << errorPrefix << "has the subscript of input " << i << " which does not match its rank";
+        if (withEllipsis)
+            ellipsisRank = std::max(ellipsisRank, rank + 1 - inputLabels[i].size());
+    }
+
+    std::map<std::string, size_t> labelIds;
+    std::vector<bool> isEllipsisLabel(ellipsisRank, true);
+    labelDims.assign(ellipsisRank, 1);
+    auto getLabels = [&](const std::vector<std::string>& labels, size_t rank) {
+        std::vector<size_t> ids;
+        for (const auto& label : labels) {
+            if (label == ellipsis) {
+                for (size_t e = ellipsisRank - (rank + 1 - labels.size()); e < ellipsisRank; e++)
+                    ids.push_back(e);
+                continue;
+            }
+            auto it = labelIds.find(label);
+            if (it == labelIds.end()) {
+                it = labelIds.emplace(label, labelDims.size()).first;
+                labelDims.push_back(0);
+                isEllipsisLabel.push_back(false);
+            }
+            ids.push_back(it->second);
+        }
+        return ids;
+    };
+
+    std::vector<std::vector<size_t>> inputIds(inputsNum);
+    std::vector<bool> isKnownLabel;
+    for (size_t i = 0; i < inputsNum; i++) {
+        const auto& dims = op->get_input_shape(i);
+        inputIds[i] = getLabels(inputLabels[i], dims.size());
+        isKnownLabel.resize(labelDims.size(), false);
+        for (size_t axis = 0; axis < dims.size(); axis++) {
+            const size_t label = inputIds[i][axis];
+            if (isEllipsisLabel[label]) {
+                if (labelDims[label] == 1)
+                    labelDims[label] = dims[axis];
+                else if (dims[axis] != 1 && dims[axis] != labelDims[label])
+                    IE_THROW() << errorPrefix << "has the ellipsis dimensions which are not broadcastable";
+            } else if (!isKnownLabel[label]) {
+                labelDims[label] = dims[axis];
+                isKnownLabel[label] = true;
+            } else if (dims[axis] != labelDims[label]) {
+                IE_THROW() << errorPrefix << "has different dimensions of the same label";
+            }
+        }
+    }
+    if (labelDims.size() > maxLabels)
+        IE_THROW() << errorPrefix << "has too many labels";
+
+    const size_t inputLabelsNum = labelDims.size();
+    const auto& outputDims = op->get_output_shape(0);
+    const auto outputLabels = getLabels(ngraph::op::v7::Einsum::extract_labels(outputSubscript), outputDims.size());
+    if (outputLabels.size() != outputDims.size() || labelDims.size() != inputLabelsNum)
+        IE_THROW() << errorPrefix << "has the output subscript which does not match the inputs";
+    outputOperand = getOperand(OperandKind::Output, 0, outputLabels, outputDims);
+
+    std::vector<Operand> operands;
+    for (size_t i = 0; i < inputsNum; i++)
+        operands.push_back(getOperand(OperandKind::Input, i, inputIds[i], op->get_input_shape(i)));
+
+    // the labels which are needed by the output or by the operands other than the given ones
+    auto getNeededLabels = [&](const std::vector<size_t>& labels, size_t excluded0, size_t excluded1) {
+        std::vector<size_t> needed;
+        for (const auto label : labels) {
+            bool isNeeded = contains(outputLabels, label);
+            for (size_t i = 0; i < operands.size() && !isNeeded; i++)
+                isNeeded = i != excluded0 && i != excluded1 && contains(operands[i].labels, label);
+            if (isNeeded)
+                needed.push_back(label);
+        }
+        return needed;
+    };
+
+    if (operands.size() == 1) {
+        addStep(operands[0], Operand(), outputLabels, true);
+        return;
+    }
+
+    for (size_t i = 0; i < operands.size(); i++) {
+        const auto needed = getNeededLabels(operands[i].labels, i, i);
+        if (needed.size() != operands[i].labels.size())
+            operands[i] = addStep(operands[i], Operand(), needed, false);
+    }
+
+    while (operands.size() > 1) {
+        // the pair with the least FLOPs of the contraction, which is the product of the dims of all their labels
+        size_t first = 0, second = 1;
+        double bestCost = -1.0;
+        for (size_t i = 0; i < operands.size(); i++) {
+            for (size_t j = i + 1; j < operands.size(); j++) {
+                double cost = 1.0;
+                for (const auto label : operands[i].labels)
+                    cost *= labelDims[label];
+                for (const auto label : operands[j].labels)
+                    cost *= contains(operands[i].labels, label) ? 1 : labelDims[label];
+                if (bestCost < 0 || cost < bestCost) {
+                    bestCost = cost;
+                    first = i;
+                    second = j;
+                }
+            }
+        }
+
+        // the last contraction keeps exactly the output labels and writes the output
+        const bool last = operands.size() == 2;
+        auto labels = operands[first].labels;
+        for (const auto label : operands[second].labels) {
+            if (!contains(labels, label))
+                labels.push_back(label);
+        }
+        const auto dst = addStep(operands[first], operands[second], last ? outputLabels : getNeededLabels(labels, first, second), last);
+        operands.erase(operands.begin() + second);
+        operands.erase(operands.begin() + first);
+        operands.push_back(dst);
+    }
+}
+
+MKLDNNEinsumNode::Operand MKLDNNEinsumNode::getOperand(OperandKind kind, size_t index, const std::vector<size_t>& labels,
+                                                       const SizeVector& dims) const {
+    Operand operand;
+    operand.kind = kind;
+    operand.index = index;
+    const auto strides = getDenseStrides(dims);
+    for (size_t axis = 0; axis < labels.size(); axis++) {
+        // the broadcasted axis is read with zero stride
+        const size_t stride = dims[axis] == 1 && labelDims[labels[axis]] != 1 ? 0 : strides[axis];
+        auto it = std::find(operand.labels.begin(), operand.labels.end(), labels[axis]);
+        if (it == operand.labels.end()) {
+            operand.labels.push_back(labels[axis]);
+            operand.strides.push_back(stride);
+        } else {
+            // the repeated labels take the diagonal
+            operand.strides[it - operand.labels.begin()] += stride;
+        }
+    }
+    return operand;
+}
+
+MKLDNNEinsumNode::Operand MKLDNNEinsumNode::addStep(const Operand& a, const Operand& b, const std::vector<size_t>& dstLabels, bool toOutput) {
+    Step step;
+    step.a = a;
+    step.b = b;
+
+    std::vector<size_t> batchLabels, mLabels, nLabels, kLabels;
+    for (const auto label : a.labels) {
+        if (!contains(dstLabels, label))
+            kLabels.push_back(label);
+        else if (contains(b.labels, label))
+            batchLabels.push_back(label);
+        else
+            mLabels.push_back(label);
+    }
+    for (const auto label : b.labels) {
+        if (contains(a.labels, label))
+            continue;
+        if (contains(dstLabels, label))
+            nLabels.push_back(label);
+        else
+            kLabels.push_back(label);
+    }
+
+    // the innermost labels of the groups have the least strides in the operands which are read by them
+    auto sortLabels = [](std::vector<size_t>& labels, const Operand& operand) {
+        auto getStride = [&](size_t label) {
+            auto it = std::find(operand.labels.begin(), operand.labels.end(), label);
+            return it == operand.labels.end() ? 0 : operand.strides[it - operand.labels.begin()];
+        };
+        std::stable_sort(labels.begin(), labels.end(), [&](size_t lhs, size_t rhs) {
+            return getStride(lhs) > getStride(rhs);
+        });
+    };
+    sortLabels(batchLabels, toOutput ? outputOperand : a);
+    sortLabels(mLabels, toOutput && b.kind == OperandKind::None ? outputOperand : a);
+    sortLabels(nLabels, b);
+    sortLabels(kLabels, a);
+
+    if (toOutput) {
+        step.dst = outputOperand;
+    } else {
+        std::vector<size_t> labels = batchLabels;
+        labels.insert(labels.end(), mLabels.begin(), mLabels.end());
+        labels.insert(labels.end(), nLabels.begin(), nLabels.end());
+        SizeVector dims;
+        for (const auto label : labels)
+            dims.push_back(labelDims[label]);
+        bufferSizes.push_back(std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>()));
+        step.dst = getOperand(OperandKind::Buffer, bufferSizes.size() - 1, labels, dims);
+    }
+
+    step.batch = getLabelGroup(batchLabels, step);
+    step.m = getLabelGroup(mLabels, step);
+    step.n = getLabelGroup(nLabels, step);
+    step.k = getLabelGroup(kLabels, step);
+    steps.push_back(step);
+    return step.dst;
+}
+
+MKLDNNEinsumNode::LabelGroup MKLDNNEinsumNode::getLabelGroup(const std::vector<size_t>& labels, const Step& step) const {
+    const Operand* operands[OPERANDS_NUM] = {&step.a, &step.b, &step.dst};
+    LabelGroup group;
+    for (const auto label : labels) {
+        group.dims.push_back(labelDims[label]);
+        group.count *= labelDims[label];
+        for (size_t o = 0; o < OPERANDS_NUM; o++) {
+            const auto& operand = *operands[o];
+            auto it = std::find(operand.labels.begin(), operand.labels.end(), label);
+            group.strides[o].push_back(it == operand.labels.end() ? 0 : operand.strides[it - operand.labels.begin()]);
+        }
+    }
+    return group;
+}
+
+void MKLDNNEinsumNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inConfigs(getOriginalInputsNumber(), {LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfigs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNEinsumNode::createPrimitive() {
+    buffers.resize(bufferSizes.size());
+    for (size_t i = 0; i < bufferSizes.size(); i++)
+        buffers[i].resize(bufferSizes[i]);
+
+    // packed A rows, B tile and C tile; the offsets of the M, N and K labels in the operands
+    scratchSize = mBlock * kBlock + kBlock * nBlock + mBlock * nBlock;
+    offsetsSize = 2 * (mBlock + nBlock + kBlock);
+    scratch.resize(scratchSize * parallel_get_max_threads());
+    offsets.resize(offsetsSize * parallel_get_max_threads());
+    srcData.resize(getOriginalInputsNumber());
+}
+
+const float* MKLDNNEinsumNode::getSrcData(const Operand& operand) const {
+    return operand.kind == OperandKind::Input ? srcData[operand.index] : buffers[operand.index].data();
+}
+
+float* MKLDNNEinsumNode::getDstData(const Operand& operand) {
+    return operand.kind == OperandKind::Output ? dstData : buffers[operand.index].data();
+}
+
+void MKLDNNEinsumNode::executeContraction(const Step& step, const float* a, const float* b, float* dst) {
+    const size_t mBlocks = div_up(step.m.count, mBlock);
+    const size_t nBlocks = div_up(step.n.count, nBlock);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float* aTile = &scratch[ithr * scratchSize];
+        float* bTile = aTile + mBlock * kBlock;
+        float* cTile = bTile + kBlock * nBlock;
+        size_t* mOffsetsA = &offsets[ithr * offsetsSize];
+        size_t* mOffsetsDst = mOffsetsA + mBlock;
+        size_t* nOffsetsB = mOffsetsDst + mBlock;
+        size_t* nOffsetsDst = nOffsetsB + nBlock;
+        size_t* kOffsetsA = nOffsetsDst + nBlock;
+        size_t* kOffsetsB = kOffsetsA + kBlock;
+
+        for_3d(ithr, nthr, step.batch.count, mBlocks, nBlocks, [&](size_t batch, size_t mb, size_t nb) {
+            size_t batchOffsetA, batchOffsetB, batchOffsetDst;
+            fillOffsets(step.batch.dims, step.batch.strides[OPERAND_A], batch, 1, &batchOffsetA);
+            fillOffsets(step.batch.dims, step.batch.strides[OPERAND_B], batch, 1, &batchOffsetB);
+            fillOffsets(step.batch.dims, step.batch.strides[OPERAND_DST], batch, 1, &batchOffsetDst);
+
+            const size_t mStart = mb * mBlock;
+            const size_t mCount = std::min(mBlock, step.m.count - mStart);
+            const size_t nStart = nb * nBlock;
+            const size_t nCount = std::min(nBlock, step.n.count - nStart);
+            fillOffsets(step.m.dims, step.m.strides[OPERAND_A], mStart, mCount, mOffsetsA);
+            fillOffsets(step.m.dims, step.m.strides[OPERAND_DST], mStart, mCount, mOffsetsDst);
+            fillOffsets(step.n.dims, step.n.strides[OPERAND_B], nStart, nCount, nOffsetsB);
+            fillOffsets(step.n.dims, step.n.strides[OPERAND_DST], nStart, nCount, nOffsetsDst);
+
+            const float* aBase = a + batchOffsetA;
+            const float* bBase = b + batchOffsetB;
+            std::fill(cTile, cTile + mCount * nBlock, 0.f);
+            for (size_t kStart = 0; kStart < step.k.count; kStart += kBlock) {
+                const size_t kCount = std::min(kBlock, step.k.count - kStart);
+                fillOffsets(step.k.dims, step.k.strides[OPERAND_A], kStart, kCount, kOffsetsA);
+                fillOffsets(step.k.dims, step.k.strides[OPERAND_B], kStart, kCount, kOffsetsB);
+
+                // the tiles are gathered by the strides of the labels, so the operands are never transposed as a whole
+                for (size_t kk = 0; kk < kCount; kk++) {
+                    const float* bRow = bBase + kOffsetsB[kk];
+                    float* bTileRow = bTile + kk * nBlock;
+                    for (size_t j = 0; j < nCount; j++)
+                        bTileRow[j] = bRow[nOffsetsB[j]];
+                }
+                for (size_t i = 0; i < mCount; i++) {
+                    const float* aRow = aBase + mOffsetsA[i];
+                    float* aTileRow = aTile + i * kBlock;
+                    for (size_t kk = 0; kk < kCount; kk++)
+                        aTileRow[kk] = aRow[kOffsetsA[kk]];
+                }
+
+                for (size_t i = 0; i < mCount; i++) {
+                    const float* aTileRow = aTile + i * kBlock;
+                    float* cRow = cTile + i * nBlock;
+                    for (size_t kk = 0; kk < kCount; kk++) {
+                        const float aValue = aTileRow[kk];
+                        const float* bTileRow = bTile + kk * nBlock;
+                        for (size_t j = 0; j < nCount; j++)
+                            cRow[j] += aValue * bTileRow[j];
+                    }
+                }
+            }
+
+            float* dstBase = dst + batchOffsetDst;
+            for (size_t i = 0; i < mCount; i++) {
+                float* dstRow = dstBase + mOffsetsDst[i];
+                const float* cRow = cTile + i * nBlock;
+                for (size_t j = 0; j < nCount; j++)
+                    dstRow[nOffsetsDst[j]] = cRow[j];
+            }
+        });
+    });
+}
+
+void MKLDNNEinsumNode::executeReduction(const Step& step, const float* a, float* dst) {
+    const size_t mBlocks = div_up(step.m.count, mBlock);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float* sums = &scratch[ithr * scratchSize];
+        size_t* mOffsetsA = &offsets[ithr * offsetsSize];
+        size_t* mOffsetsDst = mOffsetsA + mBlock;
+        size_t* kOffsetsA = mOffsetsDst + mBlock;
+
+        for_1d(ithr, nthr, mBlocks, [&](size_t mb) {
+            const size_t mStart = mb * mBlock;
+            const size_t mCount = std::min(mBlock, step.m.count - mStart);
+            fillOffsets(step.m.dims, step.m.strides[OPERAND_A], mStart, mCount, mOffsetsA);
+            fillOffsets(step.m.dims, step.m.strides[OPERAND_DST], mStart, mCount, mOffsetsDst);
+
+            std::fill(sums, sums + mCount, 0.f);
+            for (size_t kStart = 0; kStart < step.k.count; kStart += kBlock) {
+                const size_t kCount = std::min(kBlock, step.k.count - kStart);
+                fillOffsets(step.k.dims, step.k.strides[OPERAND_A], kStart, kCount, kOffsetsA);
+                for (size_t i = 0; i < mCount; i++) {
+                    const float* aRow = a + mOffsetsA[i];
+                    float sum = 0.f;
+                    for (size_t kk = 0; kk < kCount; kk++)
+                        sum += aRow[kOffsetsA[kk]];
+                    sums[i] += sum;
+                }
+            }
+
+            for (size_t i = 0; i < mCount; i++)
+                dst[mOffsetsDst[i]] = sums[i];
+        });
+    });
+}
+
+void MKLDNNEinsumNode::execute(mkldnn::stream strm) {
+    for (size_t i = 0; i < srcData.size(); i++)
+        srcData[i] = reinterpret_cast<const float*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    dstData = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    for (const auto& step : steps) {
+        if (step.b.kind == OperandKind::None)
+            executeReduction(step, getSrcData(step.a), getDstData(step.dst));
+        else
+            executeContraction(step, getSrcData(step.a), getSrcData(step.b), getDstData(step.dst));
+    }
+}
+
+bool MKLDNNEinsumNode::created() const {
+    return getType() == Einsum;
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_node.h>
+#include <ie_common.h>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Einsum with any number of inputs, the ellipsis (numpy broadcasted) and the repeated labels.
+ *
+ * Each label is a single axis addressed by its element stride, so the diagonal of the repeated labels is read with
+ * the sum of their strides and the transposes of the operands are only the orders of the strides. The inputs are
+ * contracted by pairs in the order chosen by the estimated FLOPs, each contraction is a batched matrix multiplication
+ * over the groups of the labels which reads the operands and writes the result by the strides, the last one writes
+ * straight to the output. The labels of a single input which are absent in the rest of the equation are reduced first.
+ *
+ * The node covers only the equations which EinsumDecomposition rejects (see isDecomposable), the ones mapped to MatMul
+ * keep running on the oneDNN MatMul. The contractions are scalar loops, they are not handed to the GEMM kernels.
+ */
+class MKLDNNEinsumNode : public MKLDNNNode {
+public:
+    MKLDNNEinsumNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+    // the equations without the ellipsis and the repeated labels are decomposed to MatMul/Transpose/ReduceSum,
+    // which run on oneDNN and are faster than this node
+    static bool isDecomposable(const std::shared_ptr<const ngraph::Node>& op) noexcept;
+
+private:
+    enum class OperandKind { None, Input, Buffer, Output };
+
+    // the input, the intermediate result or the output seen as a set of the labeled axes
+    struct Operand {
+        OperandKind kind = OperandKind::None;
+        size_t index = 0;               // input port or buffer index
+        std::vector<size_t> labels;     // unique labels
+        std::vector<size_t> strides;    // element strides of the labels, zero for the broadcasted ones
+    };
+
+    enum { OPERAND_A, OPERAND_B, OPERAND_DST, OPERANDS_NUM };
+
+    // the labels iterated as one flat index, the strides are zero for the operands which do not have the label
+    struct LabelGroup {
+        std::vector<size_t> dims;
+        std::vector<size_t> strides[OPERANDS_NUM];
+        size_t count = 1;
+    };
+
+    // dst[batch, m, n] = sum by k of a[batch, m, k] * b[batch, k, n], the reduction of a single operand has no b
+    struct Step {
+        Operand a, b, dst;
+        LabelGroup batch, m, n, k;
+    };
+
+    Operand getOperand(OperandKind kind, size_t index, const std::vector<size_t>& labels, const InferenceEngine::SizeVector& dims) const;
+    Operand addStep(const Operand& a, const Operand& b, const std::vector<size_t>& dstLabels, bool toOutput);
+    LabelGroup getLabelGroup(const std::vector<size_t>& labels, const Step& step) const;
+
+    const float* getSrcData(const Operand& operand) const;
+    float* getDstData(const Operand& operand);
+    void executeContraction(const Step& step, const float* a, const float* b, float* dst);
+    void executeReduction(const Step& step, const float* a, float* dst);
+
+    // the C tile of 32 x 128 and the B tile of 128 x 128 fit L2 together with the packed rows of A
+    const size_t mBlock = 32;
+    const size_t nBlock = 128;
+    const size_t kBlock = 128;
+
+    std::vector<size_t> labelDims;
+    Operand outputOperand;
+    std::vector<Step> steps;
+    std::vector<size_t> bufferSizes;
+    std::vector<std::vector<float>> buffers;
+
+    size_t scratchSize = 0;
+    size_t offsetsSize = 0;
+    std::vector<float> scratch;
+    std::vector<size_t> offsets;
+
+    std::vector<const float*> srcData;
+    float* dstData = nullptr;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -39,6 +39,7 @@
 #include <map>
 #include <functional>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "cache/hash_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -73,6 +74,88 @@ struct EltwiseEmitter {
     }
 };
 
+/**
+ * Describes the eltwise operation (the node itself or one of the fused nodes) which is compiled into the jit kernel.
+ * FakeQuantize post ops embed the pointers to the quantization data into the kernel, so such ops are identified by the node.
+ */
+struct EltwiseOpData {
+    Type type;
+    Algorithm algorithm;
+    mkldnn::algorithm mkldnnAlgorithm;
+    float alpha;
+    float beta;
+    float gamma;
+    const MKLDNNNode* quantizationNode;
+
+    bool operator==(const EltwiseOpData& rhs) const {
+        return type == rhs.type && algorithm == rhs.algorithm && mkldnnAlgorithm == rhs.mkldnnAlgorithm &&
+               alpha == rhs.alpha && beta == rhs.beta && gamma == rhs.gamma && quantizationNode == rhs.quantizationNode;
+    }
+};
+
+struct EltwiseKey {
+    std::vector<EltwiseOpData> ops;
+    jit_eltwise_params jep;
+    size_t schedulerWorkAmount;
+    size_t fullWorkAmount;
+    size_t batchDimIdx;
+    bool useJit;
+
+    size_t hash() const;
+    bool operator==(const EltwiseKey& rhs) const;
+};
+
+size_t EltwiseKey::hash() const {
+    size_t seed = 0;
+    for (const auto& op : ops) {
+        seed = hash_combine(seed, static_cast<int>(op.type));
+        seed = hash_combine(seed, static_cast<int>(op.algorithm));
+        seed = hash_combine(seed, static_cast<int>(op.mkldnnAlgorithm));
+        seed = hash_combine(seed, op.alpha);
+        seed = hash_combine(seed, op.beta);
+        seed = hash_combine(seed, op.gamma);
+        seed = hash_combine(seed, op.quantizationNode);
+    }
+
+    seed = hash_combine(seed, jep.inputs_number);
+    seed = hash_combine(seed, jep.input_size);
+    seed = hash_combine(seed, jep.dims);
+    for (size_t i = 0; i < jep.inputs_number; i++) {
+        seed = hash_combine(seed, static_cast<int>(jep.src_prc[i].getPrecVal()));
+        seed = hash_combine(seed, jep.src_offsets[i]);
+        seed = hash_combine(seed, jep.src_size[i]);
+    }
+    seed = hash_combine(seed, static_cast<int>(jep.dst_prc.getPrecVal()));
+    seed = hash_combine(seed, jep.dst_offsets);
+    seed = hash_combine(seed, jep.oc_offsets);
+    seed = hash_combine(seed, jep.dst_size);
+    seed = hash_combine(seed, jep.oc_size);
+    seed = hash_combine(seed, jep.work_amount);
+
+    seed = hash_combine(seed, schedulerWorkAmount);
+    seed = hash_combine(seed, fullWorkAmount);
+    seed = hash_combine(seed, batchDimIdx);
+    seed = hash_combine(seed, useJit);
+    return seed;
+}
+
+bool EltwiseKey::operator==(const EltwiseKey& rhs) const {
+    if (ops != rhs.ops || schedulerWorkAmount != rhs.schedulerWorkAmount || fullWorkAmount != rhs.fullWorkAmount ||
+        batchDimIdx != rhs.batchDimIdx || useJit != rhs.useJit)
+        return false;
+
+    if (jep.inputs_number != rhs.jep.inputs_number || jep.input_size != rhs.jep.input_size || jep.dims != rhs.jep.dims ||
+        jep.dst_prc != rhs.jep.dst_prc || jep.dst_offsets != rhs.jep.dst_offsets || jep.oc_offsets != rhs.jep.oc_offsets ||
+        jep.dst_size != rhs.jep.dst_size || jep.oc_size != rhs.jep.oc_size || jep.work_amount != rhs.jep.work_amount)
+        return false;
+
+    for (size_t i = 0; i < jep.inputs_number; i++) {
+        if (jep.src_prc[i] != rhs.jep.src_prc[i] || jep.src_offsets[i] != rhs.jep.src_offsets[i] || jep.src_size[i] != rhs.jep.src_size[i])
+            return false;
+    }
+    return true;
+}
+
 }   // namespace
 
 template <cpu_isa_t isa>
@@ -1479,11 +1562,34 @@ void MKLDNNEltwiseNode::prepareParams() {
     std::transform(jep.oc_offsets.begin(), jep.oc_offsets.end(), jep.oc_offsets.begin(),
                    [](size_t& offset) { return offset * sizeof(float);});
 
-    if (canUseOptimizedImpl) {
-        execPtr = std::make_shared<EltwiseJitExecutor>(jep, *this, schedulerWorkAmount, batchDimIdx);
-    } else {
-        execPtr = std::make_shared<EltwiseRefExecutor>(jep, fullWorkAmount, batchDimIdx);
-    }
+    auto describeOp = [](const MKLDNNNode& node) {
+        EltwiseOpData data = {node.getType(), node.getAlgorithm(), mkldnn::algorithm::undef, 0.f, 0.f, 0.f, nullptr};
+        if (node.getType() == Eltwise) {
+            const auto& eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode&>(node);
+            data.mkldnnAlgorithm = eltwiseNode.getMKLDNNAlgorithm();
+            data.alpha = eltwiseNode.getAlpha();
+            data.beta = eltwiseNode.getBeta();
+            data.gamma = eltwiseNode.getGamma();
+        } else {
+            data.quantizationNode = &node;
+        }
+        return data;
+    };
+
+    EltwiseKey key = {{describeOp(*this)}, jep, schedulerWorkAmount, fullWorkAmount, batchDimIdx, canUseOptimizedImpl};
+    for (const auto& fusedNode : fusedWith)
+        key.ops.push_back(describeOp(*fusedNode));
+
+    auto builder = [this](const EltwiseKey& key) -> executorPtr {
+        if (key.useJit) {
+            return std::make_shared<EltwiseJitExecutor>(key.jep, *this, key.schedulerWorkAmount, key.batchDimIdx);
+        } else {
+            return std::make_shared<EltwiseRefExecutor>(key.jep, key.fullWorkAmount, key.batchDimIdx);
+        }
+    };
+
+    auto result = getRuntimeCache()->getOrCreate(key, builder);
+    execPtr = result.first;
 }
 
 bool MKLDNNEltwiseNode::needPrepareParams() const {
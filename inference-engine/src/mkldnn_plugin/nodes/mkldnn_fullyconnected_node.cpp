@@ -7,18 +7,227 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/type/bfloat16.hpp>
+#include <ngraph/type/float16.hpp>
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include "ie_parallel.hpp"
 #include "utils/general_utils.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
+#define GET_SPARSE_OFF(field) offsetof(jit_fc_sparse_call_args, field)
+
+namespace {
+
+// The dot products of a tile of the rows of the input and the rows of the compressed weights [N, K]. The weights are
+// converted to FP32 right after the load, so they are read from the memory in the compressed precision only. The
+// vectors of the partial sums are stored as is, the lanes are summed up by the node together with the tail along K.
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    explicit jit_uni_fc_decompression_kernel_f32(jit_fc_decompression_config_params jcp) : jit_uni_fc_decompression_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src[0], ptr[reg_params + GET_OFF(src)]);
+        mov(reg_wei[0], ptr[reg_params + GET_OFF(wei)]);
+        mov(reg_k_blocks, ptr[reg_params + GET_OFF(k_blocks)]);
+        mov(reg_aux, ptr[reg_params + GET_OFF(src_stride)]);
+        for (int m = 1; m < jcp_.rows; m++)
+            lea(reg_src[m], ptr[reg_src[m - 1] + reg_aux]);
+        mov(reg_aux, ptr[reg_params + GET_OFF(wei_stride)]);
+        for (int n = 1; n < jcp_.channels; n++)
+            lea(reg_wei[n], ptr[reg_wei[n - 1] + reg_aux]);
+
+        for (int m = 0; m < jcp_.rows; m++)
+            for (int n = 0; n < jcp_.channels; n++)
+                uni_vpxor(vmm_acc(m, n), vmm_acc(m, n), vmm_acc(m, n));
+
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_k_blocks, 0);
+            je(exit_label, T_NEAR);
+
+            for (int m = 0; m < jcp_.rows; m++)
+                uni_vmovups(vmm_src(m), ptr[reg_src[m]]);
+            for (int n = 0; n < jcp_.channels; n++) {
+                load_weights(ptr[reg_wei[n]]);
+                for (int m = 0; m < jcp_.rows; m++)
+                    vfmadd231ps(vmm_acc(m, n), vmm_src(m), vmm_wei);
+            }
+
+            for (int m = 0; m < jcp_.rows; m++)
+                add(reg_src[m], vlen);
+            for (int n = 0; n < jcp_.channels; n++)
+                add(reg_wei[n], lanes * static_cast<int>(jcp_.wei_prc.size()));
+            dec(reg_k_blocks);
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        mov(reg_aux, ptr[reg_params + GET_OFF(acc)]);
+        for (int m = 0; m < jcp_.rows; m++)
+            for (int n = 0; n < jcp_.channels; n++)
+                uni_vmovups(ptr[reg_aux + (m * jcp_.channels + n) * vlen], vmm_acc(m, n));
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename impl::utils::conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int lanes = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src[4] = {r8, r9, r10, r11};
+    Xbyak::Reg64 reg_wei[4] = {r12, r13, r14, r15};
+    Xbyak::Reg64 reg_k_blocks = rax;
+    Xbyak::Reg64 reg_aux = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // the accumulators take the first rows * channels registers, then the rows of the input and the weights follow
+    Vmm vmm_acc(int m, int n) const {
+        return Vmm(m * jcp_.channels + n);
+    }
+    Vmm vmm_src(int m) const {
+        return Vmm(jcp_.rows * jcp_.channels + m);
+    }
+    Vmm vmm_wei = Vmm(jcp_.rows * jcp_.channels + jcp_.rows);
+
+    void load_weights(const Xbyak::Address& addr) {
+        switch (jcp_.wei_prc) {
+            case Precision::FP16:
+                vcvtph2ps(vmm_wei, addr);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_wei, addr);
+                vpslld(vmm_wei, vmm_wei, 16);
+                break;
+            case Precision::U8:
+                vpmovzxbd(vmm_wei, addr);
+                vcvtdq2ps(vmm_wei, vmm_wei);
+                break;
+            case Precision::I8:
+                vpmovsxbd(vmm_wei, addr);
+                vcvtdq2ps(vmm_wei, vmm_wei);
+                break;
+            default:
+                assert(!"unsupported precision of the compressed weights");
+        }
+    }
+};
+
+// The product of a block row of the sparse weights and the transposed input: for each non-zero block the row of the
+// transposed input pointed by the index of the block is loaded once and multiplied by the broadcasted values of all
+// the channels of the block, so the vectors are computed along M and the zero blocks are not read at all.
+template <cpu_isa_t isa>
+struct jit_uni_fc_sparse_kernel_f32 : public jit_uni_fc_sparse_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_sparse_kernel_f32)
+
+    explicit jit_uni_fc_sparse_kernel_f32(jit_fc_sparse_config_params jcp) : jit_uni_fc_sparse_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_SPARSE_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_SPARSE_OFF(dst)]);
+        mov(reg_values, ptr[reg_params + GET_SPARSE_OFF(values)]);
+        mov(reg_indices, ptr[reg_params + GET_SPARSE_OFF(indices)]);
+        mov(reg_blocks, ptr[reg_params + GET_SPARSE_OFF(blocks)]);
+        mov(reg_src_stride, ptr[reg_params + GET_SPARSE_OFF(src_stride)]);
+
+        for (int c = 0; c < jcp_.channels; c++)
+            for (int v = 0; v < jcp_.vecs; v++)
+                uni_vpxor(vmm_acc(c, v), vmm_acc(c, v), vmm_acc(c, v));
+
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_blocks, 0);
+            je(exit_label, T_NEAR);
+
+            movsxd(reg_aux, dword[reg_indices]);
+            imul(reg_aux, reg_src_stride);
+            add(reg_aux, reg_src);
+            for (int v = 0; v < jcp_.vecs; v++)
+                uni_vmovups(vmm_src(v), ptr[reg_aux + v * vlen]);
+            for (int c = 0; c < jcp_.channels; c++) {
+                vbroadcastss(vmm_wei, ptr[reg_values + c * sizeof(float)]);
+                for (int v = 0; v < jcp_.vecs; v++)
+                    vfmadd231ps(vmm_acc(c, v), vmm_src(v), vmm_wei);
+            }
+
+            add(reg_indices, sizeof(int32_t));
+            add(reg_values, jcp_.channels * sizeof(float));
+            dec(reg_blocks);
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        mov(reg_aux, ptr[reg_params + GET_SPARSE_OFF(dst_stride)]);
+        for (int c = 0; c < jcp_.channels; c++) {
+            for (int v = 0; v < jcp_.vecs; v++)
+                uni_vmovups(ptr[reg_dst + v * vlen], vmm_acc(c, v));
+            add(reg_dst, reg_aux);
+        }
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename impl::utils::conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_values = r10;
+    Xbyak::Reg64 reg_indices = r11;
+    Xbyak::Reg64 reg_blocks = r12;
+    Xbyak::Reg64 reg_src_stride = r13;
+    Xbyak::Reg64 reg_aux = rax;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // the accumulators take the first channels * vecs registers, then the vectors of the input and the weight follow
+    Vmm vmm_acc(int c, int v) const {
+        return Vmm(c * jcp_.vecs + v);
+    }
+    Vmm vmm_src(int v) const {
+        return Vmm(jcp_.channels * jcp_.vecs + v);
+    }
+    Vmm vmm_wei = Vmm(jcp_.channels * jcp_.vecs + jcp_.vecs);
+};
+
+}  // namespace
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -79,6 +288,9 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
+    // the weights decompression is executed by the node itself
+    if (weightsDecompression || sparseWeights)
+        return;
 
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
@@ -128,7 +340,175 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!weightsDecompression && !sparseWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type implType;
+    if (sparseWeights)
+        implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512_sparse : impl_desc_type::jit_avx2_sparse;
+    else
+        implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+
+    std::vector<PortConfigurator> inPortConfs = {{LayoutType::ncsp, Precision::FP32},
+                                                 {LayoutType::ncsp, weightsDecompression ? compressedWeightsPrecision : Precision::FP32}};
+    if (withBiases)
+        inPortConfs.push_back({LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inPortConfs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         implType);
+}
+
+bool MKLDNNFullyConnectedNode::canDecompressWeights(const Precision& weightsPrecision) const {
+    if (sparseWeights)
+        return false;
+    if (!one_of(weightsPrecision, Precision::FP16, Precision::BF16, Precision::U8, Precision::I8))
+        return false;
+    // FP16 is converted by the F16C instructions
+    if (!mayiuse(avx512_common) && !(mayiuse(avx2) && (weightsPrecision != Precision::FP16 || cpu().has(Xbyak::util::Cpu::tF16C))))
+        return false;
+    return fusedWith.empty() && one_of(getInputShapeAtPort(DATA_ID).getRank(), 2, 3) &&
+           one_of(getOriginalInputPrecisionAtPort(DATA_ID), Precision::FP32, Precision::BF16);
+}
+
+void MKLDNNFullyConnectedNode::setWeightsDecompression(const Precision& weightsPrecision, std::vector<float> scales,
+                                                       std::vector<float> shifts) {
+    if (!canDecompressWeights(weightsPrecision))
+        IE_THROW() << errorPrefix << " doesn't support the decompression of the weights of " << weightsPrecision << " precision";
+    if (scales.size() != getOutputShapeAtPort(0).getStaticDims().back() || (!shifts.empty() && shifts.size() != scales.size()))
+        IE_THROW() << errorPrefix << " has incorrect number of the decompression scales or shifts";
+
+    weightsDecompression = true;
+    compressedWeightsPrecision = weightsPrecision;
+    decompressionScales = std::move(scales);
+    decompressionShifts = std::move(shifts);
+}
+
+bool MKLDNNFullyConnectedNode::canUseSparseWeights() const {
+    if (!mayiuse(avx2) || weightsDecompression)
+        return false;
+    const auto& weightsShape = getInputShapeAtPort(WEIGHTS_ID);
+    const auto& dataShape = getInputShapeAtPort(DATA_ID);
+    if (!fusedWith.empty() || !one_of(dataShape.getRank(), 2, 3) || weightsShape.getRank() != 2 ||
+        weightsShape.getStaticDims()[1] != dataShape.getStaticDims().back() ||
+        !one_of(getOriginalInputPrecisionAtPort(DATA_ID), Precision::FP32, Precision::BF16))
+        return false;
+
+    // the kernel computes the vectors along M, so with less rows than a vector the lanes are mostly padding and
+    // the dense oneDNN primitive is faster at any realistic sparsity
+    const auto& dataDims = dataShape.getStaticDims();
+    const size_t M = std::accumulate(dataDims.begin(), dataDims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+    const size_t lanes = (mayiuse(avx512_common) ? cpu_isa_traits<avx512_common>::vlen : cpu_isa_traits<avx2>::vlen) / sizeof(float);
+    return M >= lanes;
+}
+
+void MKLDNNFullyConnectedNode::setSparseWeights(const float* weights) {
+    if (!canUseSparseWeights())
+        IE_THROW() << errorPrefix << " doesn't support the sparse weights";
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const size_t channelsBlock = sparseChannelsBlock;
+    const size_t channelsBlocks = impl::utils::div_up(N, channelsBlock);
+
+    sparseOffsets.assign(1, 0);
+    sparseIndices.clear();
+    sparseValues.clear();
+    for (size_t nb = 0; nb < channelsBlocks; nb++) {
+        const size_t n0 = nb * channelsBlock;
+        const size_t channels = std::min(channelsBlock, N - n0);
+        for (size_t k = 0; k < K; k++) {
+            bool isZero = true;
+            for (size_t c = 0; c < channels && isZero; c++)
+                isZero = weights[(n0 + c) * K + k] == 0.f;
+            if (isZero)
+                continue;
+            sparseIndices.push_back(static_cast<int32_t>(k));
+            // the tail of the channels is padded with zeros, its outputs are not used
+            for (size_t c = 0; c < channelsBlock; c++)
+                sparseValues.push_back(c < channels ? weights[(n0 + c) * K + k] : 0.f);
+        }
+        sparseOffsets.push_back(sparseIndices.size());
+    }
+    sparseWeights = true;
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (weightsDecompression) {
+        if (!decompressionKernels.empty())
+            return;
+
+        const auto& inDims = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+        const size_t M = std::accumulate(inDims.begin(), inDims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+        const size_t N = getChildEdgeAt(0)->getMemory().getStaticDims().back();
+        const bool isAvx512 = mayiuse(avx512_common);
+        decompressionLanes = (isAvx512 ? cpu_isa_traits<avx512_common>::vlen : cpu_isa_traits<avx2>::vlen) / sizeof(float);
+        decompressionRowsBlock = isAvx512 ? 4 : 2;
+
+        decompressionKernels.resize(decompressionRowsBlock);
+        for (auto& kernels : decompressionKernels)
+            kernels.resize(decompressionChannelsBlock);
+        // the kernels of the full tiles and of the tails only
+        for (size_t rows : {std::min(M, decompressionRowsBlock), M % decompressionRowsBlock}) {
+            for (size_t channels : {std::min(N, decompressionChannelsBlock), N % decompressionChannelsBlock}) {
+                if (rows == 0 || channels == 0 || decompressionKernels[rows - 1][channels - 1])
+                    continue;
+                jit_fc_decompression_config_params jcp;
+                jcp.wei_prc = compressedWeightsPrecision;
+                jcp.rows = static_cast<int>(rows);
+                jcp.channels = static_cast<int>(channels);
+                auto& kernel = decompressionKernels[rows - 1][channels - 1];
+                if (isAvx512)
+                    kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx512_common>(jcp));
+                else
+                    kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx2>(jcp));
+                kernel->create_ker();
+            }
+        }
+        return;
+    }
+
+    if (sparseWeights) {
+        if (!sparseKernels.empty())
+            return;
+
+        const auto& inDims = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+        const size_t M = std::accumulate(inDims.begin(), inDims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+        const size_t K = inDims.back();
+        const size_t N = getChildEdgeAt(0)->getMemory().getStaticDims().back();
+        const bool isAvx512 = mayiuse(avx512_common);
+        sparseLanes = (isAvx512 ? cpu_isa_traits<avx512_common>::vlen : cpu_isa_traits<avx2>::vlen) / sizeof(float);
+        sparseVecsBlock = isAvx512 ? 4 : 2;
+        const size_t vecs = impl::utils::div_up(M, sparseLanes);
+        const size_t paddedM = vecs * sparseLanes;
+
+        // the padding of the transposed input stays zero
+        sparseSrcTransposed.assign(K * paddedM, 0.f);
+        sparseDstTransposed.assign(impl::utils::rnd_up(N, sparseChannelsBlock) * paddedM, 0.f);
+
+        sparseKernels.resize(sparseVecsBlock);
+        // the kernels of the full strips and of the tail only
+        for (size_t kernelVecs : {std::min(vecs, sparseVecsBlock), vecs % sparseVecsBlock}) {
+            if (kernelVecs == 0 || sparseKernels[kernelVecs - 1])
+                continue;
+            jit_fc_sparse_config_params jcp;
+            jcp.vecs = static_cast<int>(kernelVecs);
+            jcp.channels = static_cast<int>(sparseChannelsBlock);
+            auto& kernel = sparseKernels[kernelVecs - 1];
+            if (isAvx512)
+                kernel.reset(new jit_uni_fc_sparse_kernel_f32<avx512_common>(jcp));
+            else
+                kernel.reset(new jit_uni_fc_sparse_kernel_f32<avx2>(jcp));
+            kernel->create_ker();
+        }
+        return;
+    }
+
     if (prim)
         return;
 
@@ -156,7 +536,138 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+void MKLDNNFullyConnectedNode::executeDecompression() {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto src = reinterpret_cast<const float*>(srcMemory.GetPtr());
+    const auto wei = reinterpret_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    auto dst = reinterpret_cast<float*>(dstMemory.GetPtr());
+
+    const auto& srcDims = srcMemory.getStaticDims();
+    const size_t K = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+    const size_t N = dstMemory.getStaticDims().back();
+    const size_t weiSize = compressedWeightsPrecision.size();
+    const size_t kBlocks = K / decompressionLanes;
+    const size_t kTail = kBlocks * decompressionLanes;
+    const size_t rowsBlock = decompressionRowsBlock;
+    const size_t channelsBlock = decompressionChannelsBlock;
+
+    // sum(x[k] * (w[k] * scale + shift)) = sum(x[k] * w[k]) * scale + sum(x[k]) * shift
+    std::vector<float> rowSums;
+    if (!decompressionShifts.empty()) {
+        rowSums.resize(M);
+        parallel_for(M, [&](size_t m) {
+            rowSums[m] = std::accumulate(src + m * K, src + (m + 1) * K, 0.f);
+        });
+    }
+
+    auto decompress = [&](const uint8_t* row, size_t k) -> float {
+        switch (compressedWeightsPrecision) {
+            case Precision::FP16: return ngraph::float16::from_bits(reinterpret_cast<const uint16_t*>(row)[k]);
+            case Precision::BF16: return ngraph::bfloat16::from_bits(reinterpret_cast<const uint16_t*>(row)[k]);
+            case Precision::U8: return static_cast<float>(row[k]);
+            case Precision::I8: return static_cast<float>(reinterpret_cast<const int8_t*>(row)[k]);
+            default: IE_THROW() << errorPrefix << " has unsupported precision of the compressed weights";
+        }
+    };
+
+    parallel_for2d(impl::utils::div_up(N, channelsBlock), impl::utils::div_up(M, rowsBlock), [&](size_t nb, size_t mb) {
+        const size_t m0 = mb * rowsBlock;
+        const size_t n0 = nb * channelsBlock;
+        const size_t rows = std::min(rowsBlock, M - m0);
+        const size_t channels = std::min(channelsBlock, N - n0);
+
+        // [rows][channels][lanes] for up to 4 rows, 4 channels and 16 lanes
+        float acc[4 * 4 * 16];
+        jit_fc_decompression_call_args args;
+        args.src = src + m0 * K;
+        args.wei = wei + n0 * K * weiSize;
+        args.acc = acc;
+        args.src_stride = K * sizeof(float);
+        args.wei_stride = K * weiSize;
+        args.k_blocks = kBlocks;
+        (*decompressionKernels[rows - 1][channels - 1])(&args);
+
+        for (size_t m = 0; m < rows; m++) {
+            const float* srcRow = src + (m0 + m) * K;
+            for (size_t n = 0; n < channels; n++) {
+                const float* lanes = acc + (m * channels + n) * decompressionLanes;
+                float sum = std::accumulate(lanes, lanes + decompressionLanes, 0.f);
+                const uint8_t* weiRow = wei + (n0 + n) * K * weiSize;
+                for (size_t k = kTail; k < K; k++)
+                    sum += srcRow[k] * decompress(weiRow, k);
+
+                float value = sum * decompressionScales[n0 + n];
+                if (!rowSums.empty())
+                    value += rowSums[m0 + m] * decompressionShifts[n0 + n];
+                if (bias)
+                    value += bias[n0 + n];
+                dst[(m0 + m) * N + n0 + n] = value;
+            }
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto src = reinterpret_cast<const float*>(srcMemory.GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    auto dst = reinterpret_cast<float*>(dstMemory.GetPtr());
+
+    const auto& srcDims = srcMemory.getStaticDims();
+    const size_t K = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+    const size_t N = dstMemory.getStaticDims().back();
+    const size_t vecs = impl::utils::div_up(M, sparseLanes);
+    const size_t paddedM = vecs * sparseLanes;
+    const size_t channelsBlock = sparseChannelsBlock;
+    const size_t vecsBlock = sparseVecsBlock;
+    float* srcTransposed = sparseSrcTransposed.data();
+    float* dstTransposed = sparseDstTransposed.data();
+
+    // the tiles of 16 rows of the input are transposed to keep the reads sequential
+    const size_t tile = 16;
+    parallel_for2d(impl::utils::div_up(M, tile), impl::utils::div_up(K, tile), [&](size_t mb, size_t kb) {
+        for (size_t m = mb * tile; m < std::min(M, (mb + 1) * tile); m++)
+            for (size_t k = kb * tile; k < std::min(K, (kb + 1) * tile); k++)
+                srcTransposed[k * paddedM + m] = src[m * K + k];
+    });
+
+    parallel_for2d(sparseOffsets.size() - 1, impl::utils::div_up(vecs, vecsBlock), [&](size_t nb, size_t vb) {
+        const size_t v0 = vb * vecsBlock;
+        const size_t kernelVecs = std::min(vecsBlock, vecs - v0);
+
+        jit_fc_sparse_call_args args;
+        args.src = srcTransposed + v0 * sparseLanes;
+        args.dst = dstTransposed + nb * channelsBlock * paddedM + v0 * sparseLanes;
+        args.values = sparseValues.data() + sparseOffsets[nb] * channelsBlock;
+        args.indices = sparseIndices.data() + sparseOffsets[nb];
+        args.blocks = sparseOffsets[nb + 1] - sparseOffsets[nb];
+        args.src_stride = paddedM * sizeof(float);
+        args.dst_stride = paddedM * sizeof(float);
+        (*sparseKernels[kernelVecs - 1])(&args);
+    });
+
+    parallel_for2d(impl::utils::div_up(M, tile), impl::utils::div_up(N, tile), [&](size_t mb, size_t nb) {
+        for (size_t m = mb * tile; m < std::min(M, (mb + 1) * tile); m++)
+            for (size_t n = nb * tile; n < std::min(N, (nb + 1) * tile); n++)
+                dst[m * N + n] = dstTransposed[n * paddedM + m] + (bias ? bias[n] : 0.f);
+    });
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (weightsDecompression) {
+        executeDecompression();
+        return;
+    }
+    if (sparseWeights) {
+        executeSparse();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -180,6 +691,8 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (weightsDecompression || sparseWeights)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -236,6 +749,8 @@ bool MKLDNNFullyConnectedNode::created() const {
 const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
+            impl_desc_type::jit_avx512_sparse,
+            impl_desc_type::jit_avx2_sparse,
             impl_desc_type::gemm_blas,
             impl_desc_type::gemm_avx512,
             impl_desc_type::gemm_avx2,
@@ -336,6 +851,8 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (weightsDecompression || sparseWeights)
+        return;
     createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inputDesc[0])->getDnnlDesc(),
                              MemoryDescUtils::convertToDnnlMemoryDesc(outputDesc[0])->getDnnlDesc());
 }
@@ -361,6 +878,9 @@ std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getDstMemDesc(mkldnn::prim
 }
 
 InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
+    if (weightsDecompression)
+        return compressedWeightsPrecision;
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
@@ -12,12 +12,75 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_decompression_config_params {
+    InferenceEngine::Precision wei_prc;     // the precision of the compressed weights
+    int rows;                               // the rows of the input computed by a call
+    int channels;                           // the output channels computed by a call
+};
+
+struct jit_fc_decompression_call_args {
+    const float *src;       // [rows] the rows of the input
+    const void *wei;        // [channels] the rows of the compressed weights [N, K]
+    float *acc;             // [rows][channels][lanes] the partial sums of the lanes of the vectors
+    size_t src_stride;      // the stride of the rows of the input in bytes
+    size_t wei_stride;      // the stride of the rows of the weights in bytes
+    size_t k_blocks;        // number of the vectors along K
+};
+
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args *);
+
+    void operator()(const jit_fc_decompression_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_decompression_kernel(jit_fc_decompression_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_decompression_config_params jcp_;
+};
+
+struct jit_fc_sparse_config_params {
+    int vecs;                               // the vectors of the transposed input computed by a call
+    int channels;                           // the output channels of a block of the weights
+};
+
+struct jit_fc_sparse_call_args {
+    const float *src;       // [K][M] the transposed input shifted to the first computed vector
+    float *dst;             // [channels][M] the transposed output shifted to the first computed vector
+    const float *values;    // [blocks][channels] the values of the non-zero blocks of the weights
+    const int32_t *indices; // [blocks] the indices of the blocks along K
+    size_t blocks;          // number of the non-zero blocks
+    size_t src_stride;      // the stride of the rows of the transposed input in bytes
+    size_t dst_stride;      // the stride of the rows of the transposed output in bytes
+};
+
+struct jit_uni_fc_sparse_kernel {
+    void (*ker_)(const jit_fc_sparse_call_args *);
+
+    void operator()(const jit_fc_sparse_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_sparse_kernel(jit_fc_sparse_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_sparse_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_sparse_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +106,20 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * The weights of the given precision are kept compressed and decompressed by the node on the fly:
+     * W[n][k] = W_compressed[n][k] * scales[n] + shifts[n]. The empty shifts mean zeros.
+     */
+    bool canDecompressWeights(const InferenceEngine::Precision& weightsPrecision) const;
+    void setWeightsDecompression(const InferenceEngine::Precision& weightsPrecision, std::vector<float> scales, std::vector<float> shifts);
+
+    /**
+     * The FP32 weights [N, K] are packed to the block-CSR format of the blocks of sparseChannelsBlock output channels
+     * by one input channel, the blocks of zeros are skipped by the kernel.
+     */
+    bool canUseSparseWeights() const;
+    void setSparseWeights(const float* weights);
+
 protected:
     AttrPtr initPrimitiveAttr();
 
@@ -58,6 +135,36 @@ private:
 
     bool withBiases = false;
 
+    void executeDecompression();
+
+    // the weights decompression which replaces the oneDNN primitive
+    bool weightsDecompression = false;
+    InferenceEngine::Precision compressedWeightsPrecision;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+    // the kernels are indexed by [rows - 1][channels - 1] of the tiles
+    std::vector<std::vector<std::unique_ptr<jit_uni_fc_decompression_kernel>>> decompressionKernels;
+    size_t decompressionLanes = 0;
+    size_t decompressionRowsBlock = 0;
+    const size_t decompressionChannelsBlock = 4;
+
+    void executeSparse();
+
+    // the sparse weights which replace the oneDNN primitive
+    bool sparseWeights = false;
+    // the offsets of the rows of the blocks for each block of the output channels, [N / channels block + 1]
+    std::vector<size_t> sparseOffsets;
+    std::vector<int32_t> sparseIndices;
+    std::vector<float> sparseValues;
+    // the kernels are indexed by [vectors - 1] of the transposed input computed by a call
+    std::vector<std::unique_ptr<jit_uni_fc_sparse_kernel>> sparseKernels;
+    // the transposed input and output, the rows are padded to the vector length
+    std::vector<float> sparseSrcTransposed;
+    std::vector<float> sparseDstTransposed;
+    size_t sparseLanes = 0;
+    size_t sparseVecsBlock = 0;
+    const size_t sparseChannelsBlock = 4;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
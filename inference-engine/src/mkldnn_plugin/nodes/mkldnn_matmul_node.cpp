@@ -21,11 +21,43 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "mkldnn_extension_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "cache/hash_utils.h"
+#include <common/primitive_attr.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+struct MatMulKey {
+    mkldnn::memory::desc inp0;
+    mkldnn::memory::desc inp1;
+    mkldnn::memory::desc out;
+    MKLDNNNode::AttrPtr attr;
+    impl_desc_type implType;
+
+    size_t hash() const;
+    bool operator==(const MatMulKey& rhs) const;
+};
+
+size_t MatMulKey::hash() const {
+    size_t seed = 0;
+    for (const auto& desc : {inp0, inp1, out})
+        seed = hash_combine(seed, get_md_hash(desc));
+
+    seed = hash_combine(seed, get_attr_hash(*attr));
+    seed = hash_combine(seed, static_cast<int>(implType));
+    return seed;
+}
+
+bool MatMulKey::operator==(const MatMulKey &rhs) const {
+    return inp0 == rhs.inp0 && inp1 == rhs.inp1 && out == rhs.out &&
+           *attr->get() == *rhs.attr->get() && implType == rhs.implType;
+}
+
+}  // namespace
+
 bool MKLDNNMatMulNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto matMul = std::dynamic_pointer_cast<const ngraph::opset1::MatMul>(op);
@@ -323,26 +355,40 @@ void MKLDNNMatMulNode::prepareParams() {
 
     auto dstDnnlDesc = dstMemPtr->GetDescWithType<DnnlMemoryDesc>();
 
-    MKLDNNDescriptor desc{
-            std::make_shared<matmul::desc>(src0TransposedDesc->getDnnlDesc(),
-                                           src1TransposedDesc->getDnnlDesc(),
-                                           dstDnnlDesc->getDnnlDesc())};
+    MatMulKey key = {src0TransposedDesc->getDnnlDesc(),
+                     src1TransposedDesc->getDnnlDesc(),
+                     dstDnnlDesc->getDnnlDesc(),
+                     attr,
+                     selected_pd->getImplementationType()};
 
-    matmul::primitive_desc prim_desc;
-    primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
+    auto engine = getEngine();
 
-    while (static_cast<bool>(itpd))  {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+    auto builder = [&engine](const MatMulKey& key) -> std::shared_ptr<mkldnn::primitive> {
+        MKLDNNDescriptor desc{std::make_shared<matmul::desc>(key.inp0, key.inp1, key.out)};
 
-        if (impl_type == selected_pd->getImplementationType()) {
-            prim_desc = itpd.get();
-            break;
+        matmul::primitive_desc prim_desc;
+        primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine, *key.attr);
+
+        while (static_cast<bool>(itpd))  {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+
+            if (impl_type == key.implType) {
+                prim_desc = itpd.get();
+                break;
+            }
+            if (!itpd.next_impl())
+                return nullptr;
         }
-        if (!itpd.next_impl())
-            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+        return std::make_shared<matmul>(prim_desc);
+    };
+
+    auto result = getRuntimeCache()->getOrCreate(key, builder);
+
+    if (!result.first) {
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
     }
 
-    prim.reset(new matmul(prim_desc));
+    prim = result.first;
 
     primArgs[DNNL_ARG_SRC_0] = src0MemPtr->GetPrimitive();
     primArgs[DNNL_ARG_WEIGHTS_0] = src1MemPtr->GetPrimitive();
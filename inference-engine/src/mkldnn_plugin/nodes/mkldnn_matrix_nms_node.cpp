@@ -171,47 +171,21 @@ bool MKLDNNMatrixNmsNode::created() const {
     return getType() == MatrixNms;
 }
 
-namespace {
-
-static inline float boxArea(const float* bbox, const bool normalized) {
-    if (bbox[2] < bbox[0] || bbox[3] < bbox[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float width = bbox[2] - bbox[0];
-        const float height = bbox[3] - bbox[1];
-        if (normalized) {
-            return width * height;
-        } else {
-            return (width + 1) * (height + 1);
-        }
-    }
-}
+void MKLDNNMatrixNmsNode::createPrimitive() {
+    if (m_nmsKernel)
+        return;
 
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
+    // the boxes are (x1, y1, x2, y2), the IoU does not depend on the order of the axes
+    jit_nms_config_params jcp;
+    jcp.matrix_iou = true;
+    jcp.norm = m_normalized ? 0.f : 1.f;
+    jcp.strict_threshold = true;
+    m_nmsKernel = std::make_shared<NmsKernel>(jcp);
 }
-}  // namespace
 
 size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+    std::vector<int32_t> candidateIndex(NmsKernel::getFilterCapacity(m_numBoxes));
+    auto end = candidateIndex.begin() + m_nmsKernel->filter(scoresData, m_numBoxes, m_scoreThreshold, candidateIndex.data());
     int64_t numDet = 0;
     int64_t originalSize = std::distance(candidateIndex.begin(), end);
     if (originalSize <= 0) {
@@ -225,6 +199,13 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
         return scoresData[a] > scoresData[b];
     });
 
+    NmsBoxes sortedBoxes;
+    sortedBoxes.reset(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        sortedBoxes.push_back(box, m_nmsKernel->area(box));
+    }
+
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
@@ -232,13 +213,13 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
         float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
+        float box[NmsBoxes::FIELDS_NUM];
+        sortedBoxes.get(actual_index, box);
+        // the row of the box is the IoU with all boxes of the greater scores
+        float* iouRow = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        m_nmsKernel->iou(box, sortedBoxes, 0, actual_index, iouRow);
+        for (size_t j = 0; j < actual_index; j++)
+            max_iou = std::max(max_iou, iouRow[j]);
         iouMax[actual_index] = max_iou;
     });
 
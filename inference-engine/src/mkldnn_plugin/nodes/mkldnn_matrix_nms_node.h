@@ -11,6 +11,8 @@
 #include <string>
 #include <vector>
 
+#include "common/nms_kernel.h"
+
 namespace MKLDNNPlugin {
 
 enum class MatrixNmsSortResultType {
@@ -27,7 +29,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -91,6 +93,7 @@ private:
     size_t m_realNumClasses = 0;
     size_t m_realNumBoxes = 0;
     float (*m_decay_fn)(float, float, float) = nullptr;
+    std::shared_ptr<NmsKernel> m_nmsKernel;
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
@@ -117,6 +117,7 @@ void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
     dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    nextStore = dataStore;
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
@@ -149,18 +150,30 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+MKLDNNMemoryPtr MKLDNNMemoryInputNode::getNextStore() {
+    return nextStore;
+}
+
+void MKLDNNMemoryInputNode::bindState(const MKLDNNMemoryPtr& current, const MKLDNNMemoryPtr& next) {
+    dataStore = current;
+    nextStore = next;
+    nextStateStored = false;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    nextStateStored = true;
+    // the producer of the state may write directly into the next state storage
+    if (new_state.GetData() == nextStore->GetData())
+        return;
+    simple_copy(*nextStore, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    // the consumers may read directly from the state storage
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (dstMemory.GetData() == dataStore->GetData())
+        return;
+    simple_copy(dstMemory, *dataStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
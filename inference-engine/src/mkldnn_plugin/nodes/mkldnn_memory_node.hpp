@@ -99,8 +99,25 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    MKLDNNMemoryPtr getNextStore();
+
+    /**
+     * @brief Binds the storage owned by the variable state: the node reads the current state
+     * and the paired MemoryOutput node writes the next one, so the previous state stays intact
+     * until the inference is finished
+     */
+    void bindState(const MKLDNNMemoryPtr& current, const MKLDNNMemoryPtr& next);
+    /**
+     * @brief Returns true if the next state was written since the last bindState() call
+     */
+    bool isNextStateStored() const {
+        return nextStateStored;
+    }
+
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr nextStore;
+    bool nextStateStored = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -0,0 +1,253 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_mha_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <ngraph_ops/multi_head_attention.hpp>
+#include "ie_parallel.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+SizeVector getDenseStrides(const SizeVector& dims) {
+    SizeVector strides(dims.size(), 1);
+    for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+        strides[i] = strides[i + 1] * dims[i + 1];
+    return strides;
+}
+
+// copies the row of the input applying the scale, the row elements are strided in both the source and the destination
+inline void loadRow(float* dst, size_t dstStride, const float* src, size_t srcStride, size_t count, float scale) {
+    for (size_t i = 0; i < count; i++)
+        dst[i * dstStride] = src[i * srcStride] * scale;
+}
+
+inline void storeRow(float* dst, size_t dstStride, const float* src, size_t count, float scale) {
+    for (size_t i = 0; i < count; i++)
+        dst[i * dstStride] = src[i] * scale;
+}
+
+}  // namespace
+
+bool MKLDNNMultiHeadAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!ngraph::is_type<const ngraph::op::internal::MultiHeadAttention>(op)) {
+            errorMessage = "Only internal MultiHeadAttention operation is supported";
+            return false;
+        }
+        // the node has no BF16 and INT8 kernels, such attention is left to the MatMul nodes
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 inputs";
+                return false;
+            }
+        }
+        if (op->get_output_element_type(0) != ngraph::element::f32) {
+            errorMessage = "Supports only f32 output";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNMultiHeadAttentionNode::MKLDNNMultiHeadAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                           MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MultiHeadAttention node with name '" + op->get_friendly_name() + "' ";
+    const auto mha = ngraph::as_type_ptr<const ngraph::op::internal::MultiHeadAttention>(op);
+    if (getOriginalInputsNumber() != 3 && getOriginalInputsNumber() != 4)
+        IE_THROW() << errorPrefix << "has incorrect number of input edges";
+    if (getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << "has incorrect number of output edges";
+
+    withMask = getOriginalInputsNumber() == 4;
+    scale = mha->get_scale();
+    outputScale = mha->get_output_scale();
+
+    auto getCanonicalStrides = [](const SizeVector& dims, const std::vector<int64_t>& order) {
+        const auto strides = getDenseStrides(dims);
+        CanonicalStrides result;
+        result.batch = strides[order[0]];
+        result.head = strides[order[1]];
+        result.length = strides[order[2]];
+        result.size = strides[order[3]];
+        return result;
+    };
+
+    const auto& qDims = op->get_input_shape(Q_PORT);
+    const auto& kDims = op->get_input_shape(K_PORT);
+    const auto& vDims = op->get_input_shape(V_PORT);
+    const auto& qOrder = mha->get_q_order();
+    const auto& kOrder = mha->get_k_order();
+    const auto& vOrder = mha->get_v_order();
+    qStrides = getCanonicalStrides(qDims, qOrder);
+    kStrides = getCanonicalStrides(kDims, kOrder);
+    vStrides = getCanonicalStrides(vDims, vOrder);
+
+    batch = qDims[qOrder[0]];
+    heads = qDims[qOrder[1]];
+    queryLength = qDims[qOrder[2]];
+    headSize = qDims[qOrder[3]];
+    keyLength = kDims[kOrder[2]];
+    valueSize = vDims[vOrder[3]];
+
+    // the output is the canonical tensor transposed by the output order, so the canonical axis outOrder[i] has the stride of the i-th axis
+    const auto& outOrder = mha->get_out_order();
+    const auto outDenseStrides = getDenseStrides(op->get_output_shape(0));
+    size_t canonicalOutStrides[4];
+    for (size_t i = 0; i < outOrder.size(); i++)
+        canonicalOutStrides[outOrder[i]] = outDenseStrides[i];
+    outStrides = {canonicalOutStrides[0], canonicalOutStrides[1], canonicalOutStrides[2], canonicalOutStrides[3]};
+
+    if (withMask) {
+        // the mask is numpy broadcasted to the [B, H, Lq, Lk] scores
+        auto maskDims = op->get_input_shape(MASK_PORT);
+        maskDims.insert(maskDims.begin(), 4 - maskDims.size(), 1);
+        const SizeVector scoresDims = {batch, heads, queryLength, keyLength};
+        auto strides = getDenseStrides(maskDims);
+        for (size_t i = 0; i < maskDims.size(); i++) {
+            if (maskDims[i] == 1) {
+                strides[i] = 0;
+            } else if (maskDims[i] != scoresDims[i]) {
+                IE_THROW() << errorPrefix << "has the mask which is not broadcastable to the scores";
+            }
+        }
+        maskStrides = {strides[0], strides[1], strides[2], strides[3]};
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inConfigs = {{LayoutType::ncsp, Precision::FP32},
+                                               {LayoutType::ncsp, Precision::FP32},
+                                               {LayoutType::ncsp, Precision::FP32}};
+    if (withMask)
+        inConfigs.push_back({LayoutType::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inConfigs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNMultiHeadAttentionNode::createPrimitive() {
+    // Q block, transposed K tile, V tile, scores row, accumulators, running maximums and sums of the block rows
+    bufferSize = queryBlock * headSize + headSize * keyBlock + keyBlock * valueSize + keyBlock +
+                 queryBlock * valueSize + 2 * queryBlock;
+    buffers.resize(bufferSize * parallel_get_max_threads());
+}
+
+void MKLDNNMultiHeadAttentionNode::executeBlock(size_t b, size_t h, size_t queryStart, size_t queryCount, float* buffer) const {
+    float* q = buffer;
+    float* kT = q + queryBlock * headSize;
+    float* v = kT + headSize * keyBlock;
+    float* s = v + keyBlock * valueSize;
+    float* acc = s + keyBlock;
+    float* rowMax = acc + queryBlock * valueSize;
+    float* rowSum = rowMax + queryBlock;
+
+    const float* qBase = qData + b * qStrides.batch + h * qStrides.head;
+    const float* kBase = kData + b * kStrides.batch + h * kStrides.head;
+    const float* vBase = vData + b * vStrides.batch + h * vStrides.head;
+
+    // the scale is applied to the queries once instead of every score
+    for (size_t i = 0; i < queryCount; i++)
+        loadRow(q + i * headSize, 1, qBase + (queryStart + i) * qStrides.length, qStrides.size, headSize, scale);
+    std::fill(acc, acc + queryCount * valueSize, 0.f);
+    std::fill(rowMax, rowMax + queryCount, std::numeric_limits<float>::lowest());
+    std::fill(rowSum, rowSum + queryCount, 0.f);
+
+    for (size_t keyStart = 0; keyStart < keyLength; keyStart += keyBlock) {
+        const size_t keyCount = std::min(keyBlock, keyLength - keyStart);
+        for (size_t j = 0; j < keyCount; j++) {
+            loadRow(kT + j, keyBlock, kBase + (keyStart + j) * kStrides.length, kStrides.size, headSize, 1.f);
+            loadRow(v + j * valueSize, 1, vBase + (keyStart + j) * vStrides.length, vStrides.size, valueSize, 1.f);
+        }
+
+        for (size_t i = 0; i < queryCount; i++) {
+            const float* qRow = q + i * headSize;
+            std::fill(s, s + keyCount, 0.f);
+            for (size_t d = 0; d < headSize; d++) {
+                const float qValue = qRow[d];
+                const float* kRow = kT + d * keyBlock;
+                for (size_t j = 0; j < keyCount; j++)
+                    s[j] += qValue * kRow[j];
+            }
+            if (withMask) {
+                const float* mask = maskData + b * maskStrides.batch + h * maskStrides.head +
+                                    (queryStart + i) * maskStrides.length + keyStart * maskStrides.size;
+                for (size_t j = 0; j < keyCount; j++)
+                    s[j] += mask[j * maskStrides.size];
+            }
+
+            // online softmax: the accumulated values are rescaled when the running maximum grows
+            float blockMax = std::numeric_limits<float>::lowest();
+            for (size_t j = 0; j < keyCount; j++)
+                blockMax = std::max(blockMax, s[j]);
+            const float newMax = std::max(rowMax[i], blockMax);
+            const float correction = std::exp(rowMax[i] - newMax);
+            float* accRow = acc + i * valueSize;
+            if (correction != 1.f) {
+                for (size_t d = 0; d < valueSize; d++)
+                    accRow[d] *= correction;
+            }
+            float sum = rowSum[i] * correction;
+            for (size_t j = 0; j < keyCount; j++) {
+                const float p = std::exp(s[j] - newMax);
+                const float* vRow = v + j * valueSize;
+                for (size_t d = 0; d < valueSize; d++)
+                    accRow[d] += p * vRow[d];
+                sum += p;
+            }
+            rowMax[i] = newMax;
+            rowSum[i] = sum;
+        }
+    }
+
+    float* outBase = outData + b * outStrides.batch + h * outStrides.head;
+    for (size_t i = 0; i < queryCount; i++) {
+        storeRow(outBase + (queryStart + i) * outStrides.length, outStrides.size, acc + i * valueSize, valueSize,
+                 outputScale / rowSum[i]);
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::execute(mkldnn::stream strm) {
+    qData = reinterpret_cast<const float*>(getParentEdgeAt(Q_PORT)->getMemoryPtr()->GetPtr());
+    kData = reinterpret_cast<const float*>(getParentEdgeAt(K_PORT)->getMemoryPtr()->GetPtr());
+    vData = reinterpret_cast<const float*>(getParentEdgeAt(V_PORT)->getMemoryPtr()->GetPtr());
+    maskData = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_PORT)->getMemoryPtr()->GetPtr()) : nullptr;
+    outData = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    const size_t queryBlocks = (queryLength + queryBlock - 1) / queryBlock;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float* buffer = &buffers[ithr * bufferSize];
+        for_3d(ithr, nthr, batch, heads, queryBlocks, [&](size_t b, size_t h, size_t qb) {
+            const size_t queryStart = qb * queryBlock;
+            executeBlock(b, h, queryStart, std::min(queryBlock, queryLength - queryStart), buffer);
+        });
+    });
+}
+
+bool MKLDNNMultiHeadAttentionNode::created() const {
+    return getType() == MultiHeadAttention;
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_node.h>
+#include <ie_common.h>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fused scaled dot product attention: softmax(Q * K^T * scale + mask) * V.
+ *
+ * The queries are processed by blocks, for each block the keys and values are streamed by tiles which are packed
+ * into the per thread buffers (K tile is packed transposed), the softmax is computed online so neither the scores
+ * nor the probabilities of the whole sequence are stored. Only FP32 is supported, the BF16 and quantized attention is
+ * executed by the MatMul nodes.
+ */
+class MKLDNNMultiHeadAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNMultiHeadAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // element strides of the tensor in the canonical [B, H, L, D] order
+    struct CanonicalStrides {
+        size_t batch = 0;
+        size_t head = 0;
+        size_t length = 0;
+        size_t size = 0;
+    };
+
+    void executeBlock(size_t b, size_t h, size_t queryStart, size_t queryCount, float* buffer) const;
+
+    const size_t Q_PORT = 0;
+    const size_t K_PORT = 1;
+    const size_t V_PORT = 2;
+    const size_t MASK_PORT = 3;
+
+    // the K and V tiles of 128 rows with the head size up to 64 take 64Kb and stay in L2 while the block of queries is processed
+    const size_t queryBlock = 32;
+    const size_t keyBlock = 128;
+
+    size_t batch = 0;
+    size_t heads = 0;
+    size_t queryLength = 0;
+    size_t keyLength = 0;
+    size_t headSize = 0;
+    size_t valueSize = 0;
+
+    float scale = 1.f;
+    float outputScale = 1.f;
+    bool withMask = false;
+
+    CanonicalStrides qStrides, kStrides, vStrides, maskStrides, outStrides;
+
+    const float* qData = nullptr;
+    const float* kData = nullptr;
+    const float* vData = nullptr;
+    const float* maskData = nullptr;
+    float* outData = nullptr;
+
+    size_t bufferSize = 0;
+    std::vector<float> buffers;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
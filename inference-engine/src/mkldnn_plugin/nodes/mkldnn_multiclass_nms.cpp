@@ -135,6 +135,18 @@ void MKLDNNMultiClassNmsNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void MKLDNNMultiClassNmsNode::createPrimitive() {
+    if (nmsKernel)
+        return;
+
+    jit_nms_config_params jcp;
+    jcp.matrix_iou = false;
+    jcp.norm = normalized ? 0.f : 1.f;
+    // the scores are compared to the threshold the same way as the reference does
+    jcp.strict_threshold = false;
+    nmsKernel = std::make_shared<NmsKernel>(jcp);
+}
+
 void MKLDNNMultiClassNmsNode::execute(mkldnn::stream strm) {
     const float* boxes = reinterpret_cast<const float*>(getParentEdgeAt(NMS_BOXES)->getMemoryPtr()->GetPtr());
     const float* scores = reinterpret_cast<const float*>(getParentEdgeAt(NMS_SCORES)->getMemoryPtr()->GetPtr());
@@ -276,28 +288,13 @@ bool MKLDNNMultiClassNmsNode::created() const {
     return getType() == MulticlassNms;
 }
 
-float MKLDNNMultiClassNmsNode::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+void MKLDNNMultiClassNmsNode::getSortedBoxes(const float* boxesPtr, const std::vector<int>& candidates, NmsBoxes& sortedBoxes) const {
+    // to align with reference the coordinates are used as is
+    sortedBoxes.reset(candidates.size());
+    for (int box_idx : candidates) {
+        const float* box = &boxesPtr[box_idx * 4];
+        sortedBoxes.push_back(box, nmsKernel->area(box));
+    }
 }
 
 void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
@@ -315,24 +312,36 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
             const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+            std::vector<int> candidates(NmsKernel::getFilterCapacity(num_boxes));
+            candidates.resize(nmsKernel->filter(scoresPtr, num_boxes, score_threshold, candidates.data()));
+
             std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] >= score_threshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
+            for (int box_idx : candidates)
+                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = iou_threshold;
                 int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
+                // the selected boxes are kept in the layout of the vectorized IoU as well
+                NmsBoxes selectedBoxes;
+                selectedBoxes.reset(max_out_box);
+                std::vector<float> iouValues;
+                float currBoxData[NmsBoxes::FIELDS_NUM];
                 while (max_out_box && !sorted_boxes.empty()) {
                     boxInfo currBox = sorted_boxes.top();
                     float origScore = currBox.score;
                     sorted_boxes.pop();
                     max_out_box--;
 
+                    std::copy_n(&boxesPtr[currBox.idx * 4], 4, currBoxData);
+                    currBoxData[NmsBoxes::AREA] = nmsKernel->area(currBoxData);
+                    const int checkBegin = currBox.suppress_begin_index;
+                    iouValues.resize(fb.size() - checkBegin);
+                    nmsKernel->iou(currBoxData, selectedBoxes, checkBegin, fb.size(), iouValues.data());
+
                     bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], normalized);
+                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= checkBegin; idx--) {
+                        float iou = iouValues[idx - checkBegin];
                         currBox.score *= func(iou, adaptive_threshold);
                         if (iou >= adaptive_threshold) {
                             box_is_selected = false;
@@ -349,6 +358,7 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
                         }
                         if (currBox.score == origScore) {
                             fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
+                            selectedBoxes.push_back(currBoxData, currBoxData[NmsBoxes::AREA]);
                             continue;
                         }
                         if (currBox.score > score_threshold) {
@@ -367,41 +377,34 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
 }
 
 void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
+    // the boxes of a class are selected by all threads if there are not enough classes to occupy them
+    const bool parallelClass = num_batches * num_classes < static_cast<size_t>(parallel_get_max_threads());
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
         if (class_idx != background_class) {
             const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::vector<std::pair<float, int>> sorted_boxes;
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] >= score_threshold)  // algin with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            std::vector<int> candidates(NmsKernel::getFilterCapacity(num_boxes));
+            candidates.resize(nmsKernel->filter(scoresPtr, num_boxes, score_threshold, candidates.data()));
 
             int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+            if (candidates.size() > 0) {
+                parallel_sort(candidates.begin(), candidates.end(), [&](int l, int r) {
+                    return (scoresPtr[l] > scoresPtr[r] || ((scoresPtr[l] == scoresPtr[r]) && (l < r)));
                 });
-                int offset = batch_idx * num_classes * max_output_boxes_per_class + class_idx * max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou =
-                            intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4], normalized);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+                // only the top boxes are the candidates
+                if (max_output_boxes_per_class < candidates.size())
+                    candidates.resize(max_output_boxes_per_class);
 
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                NmsBoxes sortedBoxes;
+                getSortedBoxes(boxesPtr, candidates, sortedBoxes);
+                const auto selected = nmsKernel->selectBoxes(sortedBoxes, iou_threshold, candidates.size(), parallelClass);
+
+                int offset = batch_idx * num_classes * max_output_boxes_per_class + class_idx * max_output_boxes_per_class;
+                for (int pos : selected) {
+                    const int box_idx = candidates[pos];
+                    filtBoxes[offset + io_selection_size] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
+                    io_selection_size++;
                 }
             }
             numFiltBox[batch_idx][class_idx] = io_selection_size;
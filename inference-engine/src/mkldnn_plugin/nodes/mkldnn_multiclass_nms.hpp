@@ -7,7 +7,11 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 
+#include <memory>
 #include <string>
+#include <vector>
+
+#include "common/nms_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -23,7 +27,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -78,11 +82,13 @@ private:
     };
 
     std::vector<filteredBoxes> filtBoxes;
+    std::shared_ptr<NmsKernel> nmsKernel;
 
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    float intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized);
+    // the sorted candidates of the class in the layout of the vectorized IoU
+    void getSortedBoxes(const float* boxesPtr, const std::vector<int>& candidates, NmsBoxes& sortedBoxes) const;
 
     void nmsWithEta(const float* boxes, const float* scores, const InferenceEngine::SizeVector& boxesStrides, const InferenceEngine::SizeVector& scoresStrides);
 
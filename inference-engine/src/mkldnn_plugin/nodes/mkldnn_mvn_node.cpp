@@ -5,11 +5,13 @@
 #include "mkldnn_mvn_node.h"
 
 #include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_eltwise_node.h"
+#include "common/cpu_convert.h"
 #include <mkldnn_extension_utils.h>
 #include "utils/bfloat16.hpp"
 #include "ie_parallel.hpp"
@@ -45,6 +47,12 @@ static inline bool isFloatCompatible(memory::data_type type) {
     return memory::data_type::f32 == type || memory::data_type::bf16 == type;
 }
 
+// gamma and beta are passed to the kernel in one buffer, beta starts at the aligned offset
+// so the full vectors can be read on the tail and the memory operands are aligned on sse41
+static inline size_t getGammaBetaStride(size_t size) {
+    return rnd_up(size, 16);
+}
+
 // normalize_variance = false : src->mean
 // normalize_variance = true : src+mean->variance:sqr(x-mean)
 template <cpu_isa_t isa>
@@ -356,6 +364,108 @@ private:
     }
 };
 
+// src->mean,M2 per vector lane in one pass (Welford), planar layout only.
+// The lanes are merged and the tail is accumulated out of the kernel.
+template <cpu_isa_t isa>
+struct jit_uni_mvn_welford_kernel_f32 : public jit_uni_mvn_mean_variance_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_mvn_welford_kernel_f32)
+
+    explicit jit_uni_mvn_welford_kernel_f32(jit_mvn_config_params jcp) : jit_uni_mvn_mean_variance_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+
+        this->preamble();
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_mean, ptr[reg_params + GET_OFF(mean)]);
+        mov(reg_variance, ptr[reg_params + GET_OFF(variance)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_stride, ptr[reg_params + GET_OFF(src_stride)]);
+
+        uni_vpxor(vmm_mean, vmm_mean, vmm_mean);
+        uni_vpxor(vmm_m2, vmm_m2, vmm_m2);
+        uni_vpxor(vmm_count, vmm_count, vmm_count);
+        mov(reg_aux, l_table);
+        uni_vbroadcastss(vmm_one, ptr[reg_aux]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+                                    std::make_shared<load_emitter_context>(jcp_.src_prc, Precision::FP32, step),
+                                    {}, {load_pool_gpr_idxs});
+
+            // n += 1; delta = x - mean; mean += delta / n; M2 += delta * (x - mean)
+            uni_vaddps(vmm_count, vmm_count, vmm_one);
+            uni_vmovups(vmm_delta, vmm_val);
+            uni_vsubps(vmm_delta, vmm_delta, vmm_mean);
+            uni_vmovups(vmm_aux, vmm_delta);
+            uni_vdivps(vmm_aux, vmm_aux, vmm_count);
+            uni_vaddps(vmm_mean, vmm_mean, vmm_aux);
+            uni_vsubps(vmm_val, vmm_val, vmm_mean);
+            uni_vfmadd231ps(vmm_m2, vmm_delta, vmm_val);
+
+            add(reg_src, reg_stride);
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        uni_vmovups(ptr[reg_mean], vmm_mean);
+        uni_vmovups(ptr[reg_variance], vmm_m2);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+
+        L(l_table);
+        dd(float2int(1.f));
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_mean = r9;
+    Xbyak::Reg64 reg_variance = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_stride = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+    Xbyak::Reg64 reg_load_table = r13;
+    Xbyak::Reg64 reg_load_store_mask = r14;
+    Xbyak::Reg64 reg_aux = r15;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_mean = Vmm(1);
+    Vmm vmm_m2 = Vmm(2);
+    Vmm vmm_delta = Vmm(3);
+    Vmm vmm_count = Vmm(4);
+    Vmm vmm_one = Vmm(5);
+    Vmm vmm_aux = Vmm(6);
+
+    Xbyak::Label l_table;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+
+    std::vector<size_t> load_pool_gpr_idxs;
+};
+
 // mean,variance->mvn
 template <cpu_isa_t isa>
 struct jit_uni_mvn_kernel_f32 : public jit_uni_mvn_kernel, public jit_generator {
@@ -393,6 +503,8 @@ struct jit_uni_mvn_kernel_f32 : public jit_uni_mvn_kernel, public jit_generator
         mov(reg_mean, ptr[reg_params + GET_OFF(mean)]);
         if (jcp_.normalize_variance)
             mov(reg_variance_inv, ptr[reg_params + GET_OFF(variance)]);
+        if (jcp_.with_gamma_beta)
+            mov(reg_gamma_beta, ptr[reg_params + GET_OFF(gamma_beta)]);
         mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
         mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
         mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
@@ -508,6 +620,7 @@ private:
 
     Xbyak::Reg64 reg_load_table = r15;
     Xbyak::Reg64 reg_load_store_mask = rbp;
+    Xbyak::Reg64 reg_gamma_beta = abi_not_param1;
 
     Vmm vmm_val = Vmm(1);
     Vmm vmm_mean = Vmm(0);
@@ -538,6 +651,12 @@ private:
         if (jcp_.normalize_variance)
             uni_vmulps(vmm_val, vmm_val, vmm_variance_inv);
 
+        if (jcp_.with_gamma_beta) {
+            const int beta_offset = static_cast<int>(getGammaBetaStride(jcp_.D * jcp_.H * jcp_.W) * sizeof(float));
+            uni_vmulps(vmm_val, vmm_val, ptr[reg_gamma_beta]);
+            uni_vaddps(vmm_val, vmm_val, ptr[reg_gamma_beta + beta_offset]);
+        }
+
         apply_post_ops(jcp_.dst_prc, jcp_.planar_layout);
 
         store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
@@ -558,6 +677,8 @@ private:
 
             add(reg_src, reg_src_stride);
             add(reg_dst, reg_dst_stride);
+            if (jcp_.with_gamma_beta)
+                add(reg_gamma_beta, vlen);
             sub(reg_work_amount, 1);
 
             jmp(mvn_loop_label, T_NEAR);
@@ -634,13 +755,15 @@ bool MKLDNNMVNNode::isSupportedOperation(const std::shared_ptr<const ngraph::Nod
             // 1D: axes: [0]
             // 2D: axes: [1]
             // 3D: axes: [1,2], [2]
-            // 4D: axes: [1,2,3], [2,3]
-            // 5D: axes: [1,2,3,4], [2,3,4]
+            // 4D: axes: [1,2,3], [2,3], [3]
+            // 5D: axes: [1,2,3,4], [2,3,4], [4]
             auto axesVal = axesOp->cast_vector<int>();
             for (int& axe : axesVal)
                 axe = axe < 0 ? axe + inDataRank : axe;
             std::sort(axesVal.begin(), axesVal.end());
-            if (inDataRank == 1) {
+            if (inDataRank > 3 && axesVal.size() == 1 && axesVal[0] == inDataRank - 1) {
+                // normalization over the innermost axis, the outer dimensions are collapsed
+            } else if (inDataRank == 1) {
                 if (axesVal.size() != 1 || axesVal[0] != 0) {
                     errorMessage = "Unsupported axes.";
                     return false;
@@ -686,13 +809,18 @@ MKLDNNMVNNode::MKLDNNMVNNode(const std::shared_ptr<ngraph::Node>& op, const mkld
 
         initAcrossChannels_ = false;
         const auto& inDataShapeSize = getInputShapeAtPort(0).getRank();
-        if (inDataShapeSize == mvnOp->input_value(1).get_shape()[0] + 1 || inDataShapeSize == 1)
+        const auto axesSize = mvnOp->input_value(1).get_shape()[0];
+        if (inDataShapeSize == axesSize + 1 || inDataShapeSize == 1)
             initAcrossChannels_ = true;
+        // the supported axes are always the last ones
+        innermostAxisOnly_ = inDataShapeSize > 1 && axesSize == 1;
     } else if (auto mvnOp = ngraph::as_type_ptr<ngraph::op::v0::MVN>(op)) {
         normalizeVariance_ = mvnOp->get_normalize_variance();
         epsValue_ = mvnOp->get_eps();
         epsMode_ = INSIDE_SQRT;
         initAcrossChannels_ = mvnOp->get_across_channels();
+        const auto& inDataShapeSize = getInputShapeAtPort(0).getRank();
+        innermostAxisOnly_ = (inDataShapeSize == 2 && initAcrossChannels_) || (inDataShapeSize == 3 && !initAcrossChannels_);
     }
     execAcrossChannels_ = initAcrossChannels_;
 }
@@ -759,7 +887,8 @@ void MKLDNNMVNNode::initSupportedPrimitiveDescriptors() {
         impl_type = impl_desc_type::ref;
     }
 
-    if (mayiuse(cpu::x64::sse41)) {
+    // the outer dimensions are collapsed for the innermost axis normalization, only planar layout is applicable
+    if (mayiuse(cpu::x64::sse41) && !innermostAxisOnly_) {
         // nspc
         if (getInputShapeAtPort(0).getRank() == 4 || getInputShapeAtPort(0).getRank() == 5) {
             pushDesc(LayoutType::nspc, impl_type);
@@ -809,13 +938,31 @@ void MKLDNNMVNNode::prepareParams() {
         jcp.across_channels = execAcrossChannels_;
         int N = 0;
         std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = shape5D;
+        input_prec = jcp.src_prc;
+
+        jcp.with_gamma_beta = !gamma_.empty();
+        if (jcp.with_gamma_beta) {
+            const size_t size = jcp.D * jcp.H * jcp.W;
+            const size_t stride = getGammaBetaStride(size);
+            gammaBetaData_.assign(2 * stride, 0.f);
+            for (size_t i = 0; i < size; i++) {
+                gammaBetaData_[i] = gamma_.size() == 1 ? gamma_[0] : gamma_[i];
+                gammaBetaData_[stride + i] = beta_.size() == 1 ? beta_[0] : beta_[i];
+            }
+        }
+
+        // the mean and the variance are computed in one pass for the planar per channel case
+        const bool useWelford = normalizeVariance_ && jcp.planar_layout && !jcp.across_channels;
 
         if (mayiuse(cpu::x64::avx512_common)) {
             mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
 
             jcp.normalize_variance = false;
             mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
-            if (normalizeVariance_) {
+            if (useWelford) {
+                jcp.normalize_variance = true;
+                mvn_welford_kernel.reset(new jit_uni_mvn_welford_kernel_f32<cpu::x64::avx512_common>(jcp));
+            } else if (normalizeVariance_) {
                 jcp.normalize_variance = true;
                 mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
             }
@@ -824,7 +971,10 @@ void MKLDNNMVNNode::prepareParams() {
 
             jcp.normalize_variance = false;
             mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-            if (normalizeVariance_) {
+            if (useWelford) {
+                jcp.normalize_variance = true;
+                mvn_welford_kernel.reset(new jit_uni_mvn_welford_kernel_f32<cpu::x64::avx2>(jcp));
+            } else if (normalizeVariance_) {
                 jcp.normalize_variance = true;
                 mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
             }
@@ -833,7 +983,10 @@ void MKLDNNMVNNode::prepareParams() {
 
             jcp.normalize_variance = false;
             mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-            if (normalizeVariance_) {
+            if (useWelford) {
+                jcp.normalize_variance = true;
+                mvn_welford_kernel.reset(new jit_uni_mvn_welford_kernel_f32<cpu::x64::sse41>(jcp));
+            } else if (normalizeVariance_) {
                 jcp.normalize_variance = true;
                 mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
             }
@@ -847,6 +1000,9 @@ void MKLDNNMVNNode::prepareParams() {
 
         if (mvn_variance_kernel)
             mvn_variance_kernel->create_ker();
+
+        if (mvn_welford_kernel)
+            mvn_welford_kernel->create_ker();
         }
 }
 
@@ -859,6 +1015,12 @@ void MKLDNNMVNNode::createPrimitive() {
 }
 
 void MKLDNNMVNNode::transformTo5DCase(const SizeVector& shape) {
+    if (innermostAxisOnly_ && shape.size() > 3) {
+        // the outer dimensions are collapsed to channels, the innermost axis is normalized per channel
+        const size_t outer = std::accumulate(shape.begin(), shape.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+        shape5D = std::make_tuple(1, outer, 1, shape.back(), 1);
+        return;
+    }
     switch (shape.size()) {
         // for 1 and 2 rank, if initAcrossChannels_ is true, adjust shape to fully vectorize under unified 5d procedure.
         // otherwise there are not enough data in spatial dimension to process in one kernel.
@@ -891,7 +1053,9 @@ void MKLDNNMVNNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
     mkldnn::post_ops ops;
     VectorDims postOpDims(5);
     std::tie(postOpDims[0], postOpDims[1], postOpDims[2], postOpDims[3], postOpDims[4]) = shape5D;
-    for (auto &node : fusedWith) {
+    // gamma and beta are applied by the kernel
+    for (size_t i = gammaBetaFusedCount_; i < fusedWith.size(); i++) {
+        auto &node = fusedWith[i];
         auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
         if (fakeQuantizeNode) {
             fakeQuantizeNode->appendPostOps(ops);
@@ -917,7 +1081,7 @@ void MKLDNNMVNNode::execute(mkldnn::stream strm) {
     uint8_t *src_data = reinterpret_cast<uint8_t*>(srcMemPtr->GetPtr());
 
     if (mayiuse(cpu::x64::sse41)) {
-        if (!mvn_mean_kernel || (normalizeVariance_ && !mvn_variance_kernel) || !mvn_kernel) {
+        if (!mvn_mean_kernel || (normalizeVariance_ && !mvn_variance_kernel && !mvn_welford_kernel) || !mvn_kernel) {
             IE_THROW() << "MVN layer with name '" << getName() << "' doesn't create kernel to execute on sse41 above platform.";
         }
         if (getParentEdgeAt(0)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp)) {
@@ -1025,37 +1189,38 @@ void MKLDNNMVNNode::mvn_pln(const uint8_t* src_data, uint8_t* dst_data) {
         } else {  // per channel
             float C2inv = 1.f / static_cast<float>(C2);
             parallel_for(C, [&](size_t c) {
-                // mean for this channel
                 float mean = 0.f;
                 size_t cc = cb + c * C2;
-                // the same arg for three kernels
+                // the same arg for mean and mvn kernels
                 auto arg = jit_mvn_call_args();
                 arg.src = src_data + cc * src_data_size;
                 arg.dst = dst_data + cc * dst_data_size;
-                arg.sum = static_cast<float*>(&mean);
                 arg.src_stride = src_stride_size;
                 arg.dst_stride = dst_stride_size;
                 arg.work_amount = static_cast<size_t>(C2 / blk_size);
                 arg.oc_off = static_cast<size_t>(c * sizeof(float));
-                (*mvn_mean_kernel)(&arg);
-
-                mean *= C2inv;
+                arg.gamma_beta = gammaBetaData_.data();
 
                 if (normalizeVariance_) {
-                    // variance for this channel
+                    // mean and variance for this channel in one pass
                     float variance = 0.f;
-                    arg.mean = static_cast<float*>(&mean);
-                    arg.variance = static_cast<float*>(&variance);
-                    (*mvn_variance_kernel)(&arg);
+                    mean_variance_pln(src_data + cc * src_data_size, C2, blk_size, mean, variance);
 
                     if (epsMode_ == INSIDE_SQRT)
-                        variance = 1.f / sqrtf(variance * C2inv + epsValue_);
+                        variance = 1.f / sqrtf(variance + epsValue_);
                     else if (epsMode_ == OUTSIDE_SQRT)
-                        variance = 1.f / (sqrtf(variance * C2inv) + epsValue_);
+                        variance = 1.f / (sqrtf(variance) + epsValue_);
 
                     // mvn for this channel
+                    arg.mean = static_cast<float*>(&mean);
+                    arg.variance = static_cast<float*>(&variance);
                     (*mvn_kernel)(&arg);
                 } else {
+                    // mean for this channel
+                    arg.sum = static_cast<float*>(&mean);
+                    (*mvn_mean_kernel)(&arg);
+                    mean *= C2inv;
+
                     // mvn for this channel
                     arg.mean = static_cast<float*>(&mean);
                     (*mvn_kernel)(&arg);
@@ -1065,6 +1230,48 @@ void MKLDNNMVNNode::mvn_pln(const uint8_t* src_data, uint8_t* dst_data) {
     }
 }
 
+void MKLDNNMVNNode::mean_variance_pln(const uint8_t* src_data, size_t size, size_t blk_size, float& mean, float& variance) {
+    // the widest vector holds 16 floats
+    float lane_mean[16];
+    float lane_m2[16];
+    auto arg = jit_mvn_call_args();
+    arg.src = src_data;
+    arg.mean = lane_mean;
+    arg.variance = lane_m2;
+    arg.src_stride = blk_size * src_data_size;
+    arg.work_amount = size / blk_size;
+    (*mvn_welford_kernel)(&arg);
+
+    // merge the lanes, each of them has accumulated the same number of values
+    float count = static_cast<float>(arg.work_amount * blk_size);
+    float m2 = 0.f;
+    mean = 0.f;
+    if (arg.work_amount != 0) {
+        for (size_t i = 0; i < blk_size; i++)
+            mean += lane_mean[i];
+        mean /= static_cast<float>(blk_size);
+        for (size_t i = 0; i < blk_size; i++) {
+            const float delta = lane_mean[i] - mean;
+            m2 += lane_m2[i] + static_cast<float>(arg.work_amount) * delta * delta;
+        }
+    }
+
+    // accumulate the tail
+    const size_t tail = size - arg.work_amount * blk_size;
+    if (tail != 0) {
+        float tail_values[16];
+        cpu_convert(src_data + (size - tail) * src_data_size, tail_values, input_prec, Precision::FP32, tail);
+        for (size_t i = 0; i < tail; i++) {
+            count += 1.f;
+            const float delta = tail_values[i] - mean;
+            mean += delta / count;
+            m2 += delta * (tail_values[i] - mean);
+        }
+    }
+
+    variance = m2 / static_cast<float>(size);
+}
+
 void MKLDNNMVNNode::mvn_ref(const uint8_t* src_data, uint8_t* dst_data) {
     const float *src_data_ptr = reinterpret_cast<const float *>(src_data);
     float *dst_data_ptr = reinterpret_cast<float *>(dst_data);
@@ -1409,14 +1616,72 @@ bool MKLDNNMVNNode::canFuse(const MKLDNNNodePtr& node) const {
     bool unaryEltwise = one_of(node->getAlgorithm(), EltwiseRelu, EltwiseGelu, EltwiseElu, EltwiseSigmoid, EltwiseClamp, EltwiseTanh,
                                             EltwiseSwish, EltwiseHswish, EltwiseMish, EltwiseHsigmoid, EltwiseRoundHalfToEven,
                                             EltwiseRoundHalfAwayFromZero, EltwiseAbs, EltwiseSqrt, EltwiseSoftRelu);
+    if (canFuseGammaBeta(node)) {
+        return true;
+    }
+    // the channels are collapsed outer dimensions for the innermost axis normalization of 4D and 5D
     if ((inputRank == 1 && !unaryEltwise) ||
-        (inputRank == 2 && !unaryEltwise && initAcrossChannels_)) {
+        (inputRank == 2 && !unaryEltwise && initAcrossChannels_) ||
+        (inputRank > 3 && !unaryEltwise && innermostAxisOnly_)) {
         return false;
     }
 
     return canFuseSimpleOperation(node);
 }
 
+bool MKLDNNMVNNode::canFuseGammaBeta(const MKLDNNNodePtr& node) const {
+    // gamma and beta are applied before the post ops
+    if (!mayiuse(cpu::x64::sse41) || !innermostAxisOnly_ || fusedWith.size() != gammaBetaFusedCount_)
+        return false;
+    if (node->getType() != Eltwise ||
+        !one_of(node->getAlgorithm(), EltwiseAdd, EltwiseMultiply, EltwiseSubtract, EltwiseDivide, EltwiseMulAdd))
+        return false;
+
+    const size_t innerDim = getOutputShapeAtPort(0).getDims().back();
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        const auto parent = node->getParentEdgesAtPort(i)[0]->getParent();
+        if (parent.get() == this) {
+            // x - c, x / c and x * c1 + c2 only
+            if (i != 0 && one_of(node->getAlgorithm(), EltwiseSubtract, EltwiseDivide, EltwiseMulAdd))
+                return false;
+            continue;
+        }
+        if (parent->getType() != Input || !parent->isConstant() || parent->getChildEdges().size() != 1)
+            return false;
+
+        // the constant is either a scalar or a vector along the innermost axis
+        const auto& dims = node->getInputShapeAtPort(i).getDims();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+        if (dims.size() > getOutputShapeAtPort(0).getRank() ||
+            (size != 1 && (innerDim == Shape::UNDEFINED_DIM || dims.back() != innerDim || size != innerDim)))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNMVNNode::fuseGammaBeta(const MKLDNNNodePtr& node) {
+    std::vector<float> scales, shifts;
+    std::tie(scales, shifts) = node->getScalesAndShifts(this);
+
+    if (gamma_.empty()) {
+        gamma_ = {1.f};
+        beta_ = {0.f};
+    }
+    const size_t size = std::max(scales.size(), shifts.size());
+    if (gamma_.size() == 1 && size > 1) {
+        gamma_.resize(size, gamma_[0]);
+        beta_.resize(size, beta_[0]);
+    }
+    // (x * gamma + beta) * scale + shift
+    for (size_t i = 0; i < gamma_.size(); i++) {
+        const float scale = scales.size() == 1 ? scales[0] : scales[i];
+        const float shift = shifts.size() == 1 ? shifts[0] : shifts[i];
+        gamma_[i] *= scale;
+        beta_[i] = beta_[i] * scale + shift;
+    }
+    gammaBetaFusedCount_++;
+}
+
 bool MKLDNNMVNNode::created() const {
     return getType() == MVN;
 }
@@ -16,6 +16,7 @@ struct jit_mvn_config_params {
     bool planar_layout;
     bool across_channels;
     bool normalize_variance;
+    bool with_gamma_beta;
     InferenceEngine::Precision src_prc;
     InferenceEngine::Precision dst_prc;
     int src_data_size;
@@ -30,6 +31,7 @@ struct jit_mvn_call_args {
     float *mean;
     float *variance;
     const float *eps;
+    const float *gamma_beta;
     float *size;
     size_t src_stride;
     size_t dst_stride;
@@ -95,11 +97,20 @@ public:
 
     bool canFuse(const MKLDNNNodePtr& node) const override;
 
+    /**
+     * Checks whether the node is a Multiply/Add by a constant broadcasted along the normalized innermost axis
+     * (LayerNorm gamma and beta), such nodes are applied by the MVN kernel itself before the post ops.
+     */
+    bool canFuseGammaBeta(const MKLDNNNodePtr& node) const;
+    void fuseGammaBeta(const MKLDNNNodePtr& node);
+
     void prepareParams() override;
 
 private:
     void mvn_pln(const uint8_t *src_data, uint8_t *dst_data);
 
+    void mean_variance_pln(const uint8_t *src_data, size_t size, size_t blk_size, float &mean, float &variance);
+
     void mvn_blk(const uint8_t *src_data, uint8_t *dst_data);
 
     void mvn_ref(const uint8_t *src_data, uint8_t *dst_data);
@@ -113,6 +124,8 @@ private:
     bool initAcrossChannels_ = false;
     bool execAcrossChannels_ = false;
     bool normalizeVariance_ = true;
+    // the normalization is performed over the innermost axis only (LayerNorm)
+    bool innermostAxisOnly_ = false;
     float epsValue_ = 1e-9f;
     // Defines way to add epsilon: inside sqrt or outside.
     enum MVNEpsMode {
@@ -127,8 +140,16 @@ private:
 
     mkldnn::primitive_attr attr;
 
+    // gamma and beta composed from the first fused nodes, which are not appended as the post ops
+    std::vector<float> gamma_;
+    std::vector<float> beta_;
+    size_t gammaBetaFusedCount_ = 0;
+    // gamma and beta broadcasted to the innermost axis and padded to the vector length for the kernel
+    std::vector<float> gammaBetaData_;
+
     std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_mean_kernel;
     std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_variance_kernel;
+    std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_welford_kernel;
     std::shared_ptr<jit_uni_mvn_kernel> mvn_kernel;
 };
 
@@ -148,6 +148,14 @@ void MKLDNNNonMaxSuppressionNode::prepareParams() {
 }
 
 void MKLDNNNonMaxSuppressionNode::createPrimitive() {
+    if (!nmsKernel) {
+        jit_nms_config_params jcp;
+        jcp.matrix_iou = false;
+        jcp.norm = 0.f;
+        jcp.strict_threshold = true;
+        nmsKernel = std::make_shared<NmsKernel>(jcp);
+    }
+
     if (inputShapesDefined()) {
         prepareParams();
         updateLastInputDims();
@@ -264,39 +272,20 @@ bool MKLDNNNonMaxSuppressionNode::created() const {
     return getType() == NonMaxSuppression;
 }
 
-float MKLDNNNonMaxSuppressionNode::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+void MKLDNNNonMaxSuppressionNode::getCorners(const float *box, float *corners) const {
     if (boxEncodingType == boxEncoding::CENTER) {
         //  box format: x_center, y_center, width, height
-        yminI = boxesI[1] - boxesI[3] / 2.f;
-        xminI = boxesI[0] - boxesI[2] / 2.f;
-        ymaxI = boxesI[1] + boxesI[3] / 2.f;
-        xmaxI = boxesI[0] + boxesI[2] / 2.f;
-        yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-        xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-        ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-        xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+        corners[NmsBoxes::C0] = box[1] - box[3] / 2.f;
+        corners[NmsBoxes::C1] = box[0] - box[2] / 2.f;
+        corners[NmsBoxes::C2] = box[1] + box[3] / 2.f;
+        corners[NmsBoxes::C3] = box[0] + box[2] / 2.f;
     } else {
         //  box format: y1, x1, y2, x2
-        yminI = (std::min)(boxesI[0], boxesI[2]);
-        xminI = (std::min)(boxesI[1], boxesI[3]);
-        ymaxI = (std::max)(boxesI[0], boxesI[2]);
-        xmaxI = (std::max)(boxesI[1], boxesI[3]);
-        yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-        xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-        ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-        xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+        corners[NmsBoxes::C0] = (std::min)(box[0], box[2]);
+        corners[NmsBoxes::C1] = (std::min)(box[1], box[3]);
+        corners[NmsBoxes::C2] = (std::max)(box[0], box[2]);
+        corners[NmsBoxes::C3] = (std::max)(box[1], box[3]);
     }
-
-    float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-    float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
 }
 
 void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
@@ -315,22 +304,35 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+        std::vector<int> candidates(NmsKernel::getFilterCapacity(num_boxes));
+        candidates.resize(nmsKernel->filter(scoresPtr, num_boxes, score_threshold, candidates.data()));
+
         std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-        }
+        for (int box_idx : candidates)
+            sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
 
         fb.reserve(sorted_boxes.size());
         if (sorted_boxes.size() > 0) {
+            // the selected boxes are kept in the layout of the vectorized IoU as well
+            NmsBoxes selectedBoxes;
+            selectedBoxes.reset((std::min)(max_output_boxes_per_class, candidates.size()));
+            std::vector<float> iouValues;
+            float currCorners[NmsBoxes::FIELDS_NUM];
+
             while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
                 boxInfo currBox = sorted_boxes.top();
                 float origScore = currBox.score;
                 sorted_boxes.pop();
 
+                getCorners(&boxesPtr[currBox.idx * 4], currCorners);
+                currCorners[NmsBoxes::AREA] = nmsKernel->area(currCorners);
+                const int checkBegin = currBox.suppress_begin_index;
+                iouValues.resize(fb.size() - checkBegin);
+                nmsKernel->iou(currCorners, selectedBoxes, checkBegin, fb.size(), iouValues.data());
+
                 bool box_is_selected = true;
-                for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
+                for (int idx = static_cast<int>(fb.size()) - 1; idx >= checkBegin; idx--) {
+                    float iou = iouValues[idx - checkBegin];
                     currBox.score *= coeff(iou);
                     if (iou >= iou_threshold) {
                         box_is_selected = false;
@@ -344,6 +346,7 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
                 if (box_is_selected) {
                     if (currBox.score == origScore) {
                         fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                        selectedBoxes.push_back(currCorners, currCorners[NmsBoxes::AREA]);
                         continue;
                     }
                     if (currBox.score > score_threshold) {
@@ -362,40 +365,35 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
 
 void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                                 const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
-    int max_out_box = static_cast<int>(max_output_boxes_per_class);
+    // the boxes of a class are selected by all threads if there are not enough classes to occupy them
+    const bool parallelClass = num_batches * num_classes < static_cast<size_t>(parallel_get_max_threads());
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
-
-        int io_selection_size = 0;
-        if (sorted_boxes.size() > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
+        std::vector<int> candidates(NmsKernel::getFilterCapacity(num_boxes));
+        candidates.resize(nmsKernel->filter(scoresPtr, num_boxes, score_threshold, candidates.data()));
+
+        size_t io_selection_size = 0;
+        if (candidates.size() > 0) {
+            parallel_sort(candidates.begin(), candidates.end(), [&](int l, int r) {
+                return (scoresPtr[l] > scoresPtr[r] || ((scoresPtr[l] == scoresPtr[r]) && (l < r)));
+            });
+
+            NmsBoxes sortedBoxes;
+            sortedBoxes.reset(candidates.size());
+            float corners[NmsBoxes::FIELDS_NUM];
+            for (int box_idx : candidates) {
+                getCorners(&boxesPtr[box_idx * 4], corners);
+                sortedBoxes.push_back(corners, nmsKernel->area(corners));
+            }
 
-                if (box_is_selected) {
-                    filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                    io_selection_size++;
-                }
+            const auto selected = nmsKernel->selectBoxes(sortedBoxes, iou_threshold, max_output_boxes_per_class, parallelClass);
+            size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            for (int pos : selected) {
+                const int box_idx = candidates[pos];
+                filtBoxes[offset + io_selection_size] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
+                io_selection_size++;
             }
         }
         numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/nms_kernel.h"
 
 using namespace InferenceEngine;
 
@@ -42,7 +43,8 @@ public:
         int suppress_begin_index;
     };
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ);
+    // the corners (ymin, xmin, ymax, xmax) of the box in any of the encodings
+    void getCorners(const float *box, float *corners) const;
 
     void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                           const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
@@ -94,6 +96,7 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    std::shared_ptr<NmsKernel> nmsKernel;
     const std::string inType = "input", outType = "output";
 
     void checkPrecision(const Precision& prec, const std::vector<Precision>& precList, const std::string& name, const std::string& type);
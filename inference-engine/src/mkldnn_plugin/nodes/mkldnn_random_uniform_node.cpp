@@ -0,0 +1,551 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_random_uniform_node.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/runtime/reference/random_uniform.hpp>
+#include <ngraph/type/bfloat16.hpp>
+#include <ngraph/type/float16.hpp>
+#include <ie_ngraph_utils.hpp>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include "ngraph_transformations/op/random_uniform.hpp"
+#include <cpu/x64/jit_generator.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace ngraph::runtime::reference;
+
+#define GET_OFF(field) offsetof(jit_random_uniform_call_args, field)
+
+namespace {
+// the groups of 4 values generated by a thread at once, 16KB of the raw values
+constexpr size_t chunkGroups = 1024;
+
+// Philox4x32: the counter is {n, counter}, each round is
+// n = {mulhi(c.lo, Mc) ^ n.hi ^ key.lo, mullo(c.lo, Mc)}, c = {mulhi(n.lo, Mn) ^ c.hi ^ key.hi, mullo(n.lo, Mn)}
+inline void philox(const uint32_t* keys, uint64_t n, uint64_t counter, uint32_t* res) {
+    uint32_t n_lo = static_cast<uint32_t>(n);
+    uint32_t n_hi = static_cast<uint32_t>(n >> 32);
+    uint32_t c_lo = static_cast<uint32_t>(counter);
+    uint32_t c_hi = static_cast<uint32_t>(counter >> 32);
+    for (size_t r = 0; r < rounds_number; r++) {
+        const uint64_t prod0 = statistic_maximizing_multiplier_n * n_lo;
+        const uint64_t prod1 = statistic_maximizing_multiplier_counter * c_lo;
+        n_lo = static_cast<uint32_t>(prod1 >> 32) ^ n_hi ^ keys[2 * r];
+        n_hi = static_cast<uint32_t>(prod1);
+        c_lo = static_cast<uint32_t>(prod0 >> 32) ^ c_hi ^ keys[2 * r + 1];
+        c_hi = static_cast<uint32_t>(prod0);
+    }
+    res[0] = n_lo;
+    res[1] = n_hi;
+    res[2] = c_lo;
+    res[3] = c_hi;
+}
+
+// The mantissa bits of the values in [1, 2) are taken from the random ones, the same way as the reference does.
+inline float toFloat(uint32_t x) {
+    const uint32_t bits = (static_cast<uint32_t>(127) << 23) | (x & 0x7fffffu);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value - 1.0f;
+}
+
+inline ngraph::float16 toFloat16(uint32_t x) {
+    const uint16_t bits = (static_cast<uint16_t>(15) << 10) | (static_cast<uint16_t>(x) & 0x3ffu);
+    return ngraph::float16::from_bits(bits) - static_cast<ngraph::float16>(1);
+}
+
+inline ngraph::bfloat16 toBfloat16(uint32_t x) {
+    const uint16_t bits = (static_cast<uint16_t>(127) << 7) | (static_cast<uint16_t>(x) & 0x7fu);
+    return ngraph::bfloat16::from_bits(bits) - static_cast<ngraph::bfloat16>(1);
+}
+
+inline double toDouble(uint32_t x1, uint32_t x2) {
+    const uint64_t significant = ((static_cast<uint64_t>(x1) & 0xfffffu) << 32) | static_cast<uint64_t>(x2);
+    const uint64_t bits = (static_cast<uint64_t>(1023) << 52) | significant;
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value - 1.0;
+}
+
+// the value of the element `i` of the chunk of the raw values
+template <typename T>
+struct RandomValue;
+
+template <>
+struct RandomValue<float> {
+    float operator()(const uint32_t* raw, size_t i, float mn, float mx) const {
+        return toFloat(raw[i]) * (mx - mn) + mn;
+    }
+};
+
+template <>
+struct RandomValue<ngraph::float16> {
+    ngraph::float16 operator()(const uint32_t* raw, size_t i, ngraph::float16 mn, ngraph::float16 mx) const {
+        return toFloat16(raw[i]) * (mx - mn) + mn;
+    }
+};
+
+template <>
+struct RandomValue<ngraph::bfloat16> {
+    ngraph::bfloat16 operator()(const uint32_t* raw, size_t i, ngraph::bfloat16 mn, ngraph::bfloat16 mx) const {
+        return toBfloat16(raw[i]) * (mx - mn) + mn;
+    }
+};
+
+template <>
+struct RandomValue<double> {
+    double operator()(const uint32_t* raw, size_t i, double mn, double mx) const {
+        return toDouble(raw[2 * i], raw[2 * i + 1]) * (mx - mn) + mn;
+    }
+};
+
+template <>
+struct RandomValue<int32_t> {
+    int32_t operator()(const uint32_t* raw, size_t i, int32_t mn, int32_t mx) const {
+        return static_cast<int32_t>(raw[i] % (mx - mn) + mn);
+    }
+};
+
+template <>
+struct RandomValue<int64_t> {
+    int64_t operator()(const uint32_t* raw, size_t i, int64_t mn, int64_t mx) const {
+        const uint64_t value = (static_cast<uint64_t>(raw[2 * i + 1]) << 32) + raw[2 * i];
+        return static_cast<int64_t>(value % (mx - mn) + mn);
+    }
+};
+
+template <typename T>
+inline void storeValue(T value, Precision prec, uint8_t* dst, size_t i) {
+    switch (prec) {
+        case Precision::FP32:
+            reinterpret_cast<float*>(dst)[i] = static_cast<float>(value);
+            break;
+        case Precision::BF16:
+            reinterpret_cast<uint16_t*>(dst)[i] = ngraph::bfloat16(static_cast<float>(value)).to_bits();
+            break;
+        default:
+            reinterpret_cast<int32_t*>(dst)[i] = static_cast<int32_t>(value);
+            break;
+    }
+}
+
+template <>
+inline void storeValue<ngraph::bfloat16>(ngraph::bfloat16 value, Precision prec, uint8_t* dst, size_t i) {
+    if (prec == Precision::BF16) {
+        reinterpret_cast<uint16_t*>(dst)[i] = value.to_bits();
+    } else {
+        storeValue(static_cast<float>(value), prec, dst, i);
+    }
+}
+}  // namespace
+
+// Generates `work_amount` groups of Philox4x32-10 with the consecutive counters in parallel: the 64 bits lanes keep
+// the low and the high halves {lo, hi} of the first and the second parts of the counter, so a round is one vpmuludq
+// per part and the halves are swapped by vpshufd. The lanes of a register start with the groups ordered so that
+// vpunpcklqdq and vpunpckhqdq of the first and the second parts give the 4 values of the consecutive groups.
+template <cpu_isa_t isa>
+struct jit_uni_random_uniform_kernel_f32 : public jit_uni_random_uniform_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_random_uniform_kernel_f32)
+
+    explicit jit_uni_random_uniform_kernel_f32(jit_random_uniform_config_params jcp) : jit_uni_random_uniform_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_keys, ptr[reg_params + GET_OFF(keys)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        vpbroadcastq(vmm_n, ptr[reg_params + GET_OFF(n)]);
+        vpaddq(vmm_n, vmm_n, table_val(OFFSETS));
+        vpbroadcastq(vmm_counter, ptr[reg_params + GET_OFF(counter)]);
+        uni_vmovdqu(vmm_mult_n, table_val(MULT_N));
+        uni_vmovdqu(vmm_mult_counter, table_val(MULT_COUNTER));
+        if (jcp_.to_float) {
+            uni_vbroadcastss(vmm_min, ptr[reg_params + GET_OFF(min)]);
+            uni_vbroadcastss(vmm_range, ptr[reg_params + GET_OFF(range)]);
+        }
+
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_work_amount, lanes);
+            jl(exit_label, T_NEAR);
+
+            uni_vmovups(vmm_a, vmm_n);
+            uni_vmovups(vmm_b, vmm_counter);
+            for (size_t r = 0; r < rounds_number; r++) {
+                vpmuludq(vmm_prod_a, vmm_a, vmm_mult_n);
+                vpmuludq(vmm_prod_b, vmm_b, vmm_mult_counter);
+                vpsrlq(vmm_a, vmm_a, 32);
+                vpsrlq(vmm_b, vmm_b, 32);
+                vpshufd(vmm_prod_a, vmm_prod_a, 0xB1);
+                vpshufd(vmm_prod_b, vmm_prod_b, 0xB1);
+                xor_vmm(vmm_a, vmm_prod_b);
+                xor_vmm(vmm_a, ptr[reg_keys + (2 * r) * vlen]);
+                xor_vmm(vmm_b, vmm_prod_a);
+                xor_vmm(vmm_b, ptr[reg_keys + (2 * r + 1) * vlen]);
+            }
+
+            vpunpcklqdq(vmm_prod_a, vmm_a, vmm_b);
+            vpunpckhqdq(vmm_prod_b, vmm_a, vmm_b);
+            store(vmm_prod_a, 0);
+            store(vmm_prod_b, vlen);
+
+            vpaddq(vmm_n, vmm_n, table_val(STEP));
+            add(reg_dst, 2 * vlen);
+            sub(reg_work_amount, lanes);
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    // the groups of a register
+    const int lanes = cpu_isa_traits<isa>::vlen / sizeof(uint64_t);
+
+    Xbyak::Reg64 reg_dst = r8;
+    Xbyak::Reg64 reg_keys = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_table = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_n = Vmm(0);
+    Vmm vmm_counter = Vmm(1);
+    Vmm vmm_a = Vmm(2);
+    Vmm vmm_b = Vmm(3);
+    Vmm vmm_prod_a = Vmm(4);
+    Vmm vmm_prod_b = Vmm(5);
+    Vmm vmm_mult_n = Vmm(6);
+    Vmm vmm_mult_counter = Vmm(7);
+    Vmm vmm_min = Vmm(8);
+    Vmm vmm_range = Vmm(9);
+
+    Xbyak::Label l_table;
+
+    enum { OFFSETS, STEP, MULT_N, MULT_COUNTER, MANTISSA_MASK, ONE, TABLE_SIZE };
+
+    Xbyak::Address table_val(int index) {
+        return ptr[reg_table + index * vlen];
+    }
+
+    void xor_vmm(const Vmm& vmm, const Xbyak::Operand& op) {
+        if (isa == avx512_common)
+            vpxord(vmm, vmm, op);
+        else
+            vpxor(vmm, vmm, op);
+    }
+
+    void store(const Vmm& vmm, int offset) {
+        if (jcp_.to_float) {
+            // [1, 2) by the mantissa bits, then the same operations as the reference: (x - 1) * range + min
+            if (isa == avx512_common) {
+                vpandd(vmm, vmm, table_val(MANTISSA_MASK));
+                vpord(vmm, vmm, table_val(ONE));
+            } else {
+                vpand(vmm, vmm, table_val(MANTISSA_MASK));
+                vpor(vmm, vmm, table_val(ONE));
+            }
+            vsubps(vmm, vmm, table_val(ONE));
+            vmulps(vmm, vmm, vmm_range);
+            vaddps(vmm, vmm, vmm_min);
+        }
+        uni_vmovdqu(ptr[reg_dst + offset], vmm);
+    }
+
+    void prepare_table() {
+        auto broadcast_qword = [&](uint64_t value) {
+            for (int i = 0; i < lanes; i++)
+                dq(value);
+        };
+        auto broadcast_dword = [&](uint32_t value) {
+            for (int i = 0; i < 2 * lanes; i++)
+                dd(value);
+        };
+
+        align(64);
+        L(l_table);
+
+        // the even lanes take the groups of the first half of the iteration, the odd ones take the second half
+        for (int i = 0; i < lanes; i++)
+            dq(i % 2 == 0 ? i / 2 : lanes / 2 + i / 2);
+        broadcast_qword(lanes);
+        broadcast_qword(statistic_maximizing_multiplier_n);
+        broadcast_qword(statistic_maximizing_multiplier_counter);
+        broadcast_dword(0x7fffffu);
+        broadcast_dword(0x3f800000u);
+    }
+};
+
+bool MKLDNNRandomUniformNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        ngraph::element::Type sequenceType;
+        if (const auto randomUniform = ngraph::as_type_ptr<const ngraph::opset8::RandomUniform>(op)) {
+            sequenceType = randomUniform->get_out_type();
+        } else if (const auto randomUniform = ngraph::as_type_ptr<const RandomUniformNode>(op)) {
+            sequenceType = randomUniform->get_sequence_type();
+        } else {
+            errorMessage = "Node is not an instance of the RandomUniform operation from opset8.";
+            return false;
+        }
+        if (op->get_output_partial_shape(0).is_dynamic()) {
+            errorMessage = "Doesn't support the output shape defined at runtime.";
+            return false;
+        }
+        if (!MKLDNNPlugin::one_of(sequenceType, ngraph::element::f32, ngraph::element::f16, ngraph::element::bf16,
+                    ngraph::element::f64, ngraph::element::i32, ngraph::element::i64)) {
+            errorMessage = "Doesn't support the output type: " + sequenceType.get_type_name();
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNRandomUniformNode::MKLDNNRandomUniformNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                 MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "RandomUniform node with name '" + getName() + "'";
+
+    // the plugin converts the output precision by the CPU operation, it keeps the type of the sequence
+    if (const auto randomUniform = ngraph::as_type_ptr<const ngraph::opset8::RandomUniform>(op)) {
+        globalSeed = randomUniform->get_global_seed();
+        opSeed = randomUniform->get_op_seed();
+        sequenceType = randomUniform->get_out_type();
+    } else {
+        const auto cpuRandomUniform = ngraph::as_type_ptr<const RandomUniformNode>(op);
+        globalSeed = cpuRandomUniform->get_global_seed();
+        opSeed = cpuRandomUniform->get_op_seed();
+        sequenceType = cpuRandomUniform->get_sequence_type();
+    }
+    step = sequenceType.size() > 4 ? 2 : 4;
+
+    // The node generates a new sequence for each inference, so it is not a constant even if all its inputs are
+    constant = ConstantType::NoConst;
+}
+
+void MKLDNNRandomUniformNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (!MKLDNNPlugin::one_of(outputPrecision, Precision::FP32, Precision::BF16, Precision::I32))
+        outputPrecision = sequenceType.is_real() ? Precision::FP32 : Precision::I32;
+    if (outputPrecision == Precision::BF16 && !mayiuse(avx512_core))
+        outputPrecision = Precision::FP32;
+    const auto boundsPrecision = sequenceType.is_real() ? Precision::FP32 : Precision::I32;
+
+    impl_desc_type implType = impl_desc_type::ref_any;
+    if (mayiuse(avx512_common))
+        implType = impl_desc_type::jit_avx512;
+    else if (mayiuse(avx2))
+        implType = impl_desc_type::jit_avx2;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::I32},
+                          {LayoutType::ncsp, boundsPrecision},
+                          {LayoutType::ncsp, boundsPrecision}},
+                         {{LayoutType::ncsp, outputPrecision}},
+                         implType);
+}
+
+void MKLDNNRandomUniformNode::createPrimitive() {
+    const auto& dims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    elementsCount = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+    jit_random_uniform_config_params jcp;
+    jcp.to_float = false;
+    jit_random_uniform_config_params jcpToFloat;
+    jcpToFloat.to_float = true;
+    const bool toFloat = sequenceType == ngraph::element::f32 && outputPrecision == Precision::FP32;
+
+    if (mayiuse(avx512_common)) {
+        kernel.reset(new jit_uni_random_uniform_kernel_f32<avx512_common>(jcp));
+        if (toFloat)
+            kernelToFloat.reset(new jit_uni_random_uniform_kernel_f32<avx512_common>(jcpToFloat));
+        kernelLanes = cpu_isa_traits<avx512_common>::vlen / sizeof(uint64_t);
+    } else if (mayiuse(avx2)) {
+        kernel.reset(new jit_uni_random_uniform_kernel_f32<avx2>(jcp));
+        if (toFloat)
+            kernelToFloat.reset(new jit_uni_random_uniform_kernel_f32<avx2>(jcpToFloat));
+        kernelLanes = cpu_isa_traits<avx2>::vlen / sizeof(uint64_t);
+    }
+
+    if (kernel)
+        kernel->create_ker();
+    if (kernelToFloat)
+        kernelToFloat->create_ker();
+}
+
+bool MKLDNNRandomUniformNode::created() const {
+    return getType() == RandomUniform;
+}
+
+void MKLDNNRandomUniformNode::generate(uint32_t* dst, uint64_t n, uint64_t counter, size_t groups, bool convertToFloat,
+                                       float min, float range) const {
+    size_t done = 0;
+    const auto& ker = convertToFloat ? kernelToFloat : kernel;
+    if (ker && groups >= kernelLanes) {
+        jit_random_uniform_call_args args;
+        args.dst = dst;
+        args.keys = kernelKeys.data();
+        args.n = n;
+        args.counter = counter;
+        args.work_amount = groups - groups % kernelLanes;
+        args.min = min;
+        args.range = range;
+        (*ker)(&args);
+        done = args.work_amount;
+    }
+
+    for (size_t g = done; g < groups; g++) {
+        uint32_t* res = dst + 4 * g;
+        philox(keys.data(), n + g, counter, res);
+        if (convertToFloat) {
+            for (size_t i = 0; i < 4; i++) {
+                const float value = toFloat(res[i]) * range + min;
+                std::memcpy(res + i, &value, sizeof(value));
+            }
+        }
+    }
+}
+
+template <typename T>
+void MKLDNNRandomUniformNode::convert(const uint32_t* raw, size_t begin, size_t end, uint8_t* dst, T min, T max) const {
+    const RandomValue<T> randomValue;
+    for (size_t i = begin; i < end; i++)
+        storeValue(randomValue(raw, i - begin, min, max), outputPrecision, dst, i);
+}
+
+void MKLDNNRandomUniformNode::convertChunk(const uint32_t* raw, size_t begin, size_t end, uint8_t* dst) const {
+    switch (sequenceType) {
+        case ngraph::element::Type_t::f32:
+            convert<float>(raw, begin, end, dst, static_cast<float>(minValue), static_cast<float>(maxValue));
+            break;
+        case ngraph::element::Type_t::f16:
+            convert<ngraph::float16>(raw, begin, end, dst, ngraph::float16(static_cast<float>(minValue)),
+                                     ngraph::float16(static_cast<float>(maxValue)));
+            break;
+        case ngraph::element::Type_t::bf16:
+            convert<ngraph::bfloat16>(raw, begin, end, dst, ngraph::bfloat16(static_cast<float>(minValue)),
+                                      ngraph::bfloat16(static_cast<float>(maxValue)));
+            break;
+        case ngraph::element::Type_t::f64:
+            convert<double>(raw, begin, end, dst, minValue, maxValue);
+            break;
+        case ngraph::element::Type_t::i32:
+            convert<int32_t>(raw, begin, end, dst, static_cast<int32_t>(minInt), static_cast<int32_t>(maxInt));
+            break;
+        case ngraph::element::Type_t::i64:
+            convert<int64_t>(raw, begin, end, dst, minInt, maxInt);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported output type: " << sequenceType;
+    }
+}
+
+void MKLDNNRandomUniformNode::execute(mkldnn::stream strm) {
+    uint8_t* dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    if (sequenceType.is_real()) {
+        minValue = reinterpret_cast<const float*>(getParentEdgeAt(RU_MIN)->getMemoryPtr()->GetPtr())[0];
+        maxValue = reinterpret_cast<const float*>(getParentEdgeAt(RU_MAX)->getMemoryPtr()->GetPtr())[0];
+    } else {
+        minInt = reinterpret_cast<const int32_t*>(getParentEdgeAt(RU_MIN)->getMemoryPtr()->GetPtr())[0];
+        maxInt = reinterpret_cast<const int32_t*>(getParentEdgeAt(RU_MAX)->getMemoryPtr()->GetPtr())[0];
+    }
+
+    // When both seeds are zero the sequence is not deterministic, the same way as in the reference.
+    uint64_t key = globalSeed;
+    if (globalSeed == 0 && opSeed == 0)
+        key = std::random_device{}();
+
+    // the key is raised after each round
+    keys.resize(2 * rounds_number);
+    uint32_t keyLow = static_cast<uint32_t>(key);
+    uint32_t keyHigh = static_cast<uint32_t>(key >> 32);
+    for (size_t r = 0; r < rounds_number; r++) {
+        keys[2 * r] = keyLow;
+        keys[2 * r + 1] = keyHigh;
+        keyLow += crush_resistance_const_lower_value;
+        keyHigh += crush_resistance_const_upper_value;
+    }
+    kernelKeys.resize(2 * rounds_number * kernelLanes);
+    for (size_t i = 0; i < 2 * rounds_number; i++)
+        std::fill_n(kernelKeys.begin() + i * kernelLanes, kernelLanes, static_cast<uint64_t>(keys[i]));
+
+    const uint64_t nStart = state.first;
+    const uint64_t counterStart = state.second > 0 ? state.second : opSeed;
+    const size_t groups = MKLDNNPlugin::div_up(elementsCount, step);
+
+    // FP32 values are written by the generator straight to the output
+    const bool toFloat = sequenceType == ngraph::element::f32 && outputPrecision == Precision::FP32;
+    const float minFloat = static_cast<float>(minValue);
+    const float range = static_cast<float>(maxValue) - minFloat;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(groups, nthr, ithr, start, end);
+
+        std::vector<uint32_t> buffer;
+        for (size_t g = start; g < end;) {
+            size_t count = std::min(end - g, chunkGroups);
+            // the counter of a group is increased when its n wraps around, so a chunk does not cross it
+            const uint64_t n = nStart + g;
+            const uint64_t counter = counterStart + (n < nStart ? 1 : 0);
+            if (n != 0 && 0 - n < count)
+                count = 0 - n;
+
+            const size_t begin = g * step;
+            const size_t chunkEnd = std::min((g + count) * step, elementsCount);
+            if (toFloat && chunkEnd == (g + count) * step) {
+                generate(reinterpret_cast<uint32_t*>(dst) + begin, n, counter, count, true, minFloat, range);
+            } else {
+                buffer.resize(4 * chunkGroups);
+                generate(buffer.data(), n, counter, count, toFloat, minFloat, range);
+                if (toFloat)
+                    std::memcpy(dst + begin * sizeof(float), buffer.data(), (chunkEnd - begin) * sizeof(float));
+                else
+                    convertChunk(buffer.data(), begin, chunkEnd, dst);
+            }
+            g += count;
+        }
+    });
+
+    // the counter of the next inference is skipped the same way as the state of the operation
+    const uint64_t skipCount = elementsCount * skip_const;
+    state.first += skipCount;
+    if (state.first < skipCount)
+        state.second++;
+}
@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <ngraph/type/element_type.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_random_uniform_config_params {
+    bool to_float;          // the values are converted to FP32 in [min, min + range), the raw UINT32 ones are stored otherwise
+};
+
+struct jit_random_uniform_call_args {
+    void *dst;              // [work_amount][4] values
+    const uint64_t *keys;   // [rounds][2][lanes] low and high parts of the key of each round broadcasted to the lanes
+    uint64_t n;             // the low half of the Philox counter of the first group, it does not wrap around in a call
+    uint64_t counter;       // the high half of the Philox counter
+    size_t work_amount;     // number of the groups of 4 values, multiple of the lanes
+    float min;
+    float range;
+};
+
+struct jit_uni_random_uniform_kernel {
+    void (*ker_)(const jit_random_uniform_call_args *);
+
+    void operator()(const jit_random_uniform_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_random_uniform_kernel(jit_random_uniform_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_random_uniform_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_random_uniform_config_params jcp_;
+};
+
+/**
+ * RandomUniform generated by the counter-based Philox4x32-10, so any group of 4 values is computed from its index and
+ * the groups are split among the threads. The sequence is the same as the one of the ngraph reference implementation:
+ * the values are converted the same way for the type of the operation, including the types which the plugin converts
+ * to FP32 and I32, and the counter of the node is advanced between the inferences the same way as the state of the
+ * operation is.
+ */
+class MKLDNNRandomUniformNode : public MKLDNNNode {
+public:
+    MKLDNNRandomUniformNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    enum { RU_SHAPE, RU_MIN, RU_MAX };
+
+    void generate(uint32_t* dst, uint64_t n, uint64_t counter, size_t groups, bool convertToFloat, float min, float range) const;
+    template <typename T>
+    void convert(const uint32_t* raw, size_t begin, size_t end, uint8_t* dst, T min, T max) const;
+    void convertChunk(const uint32_t* raw, size_t begin, size_t end, uint8_t* dst) const;
+
+    ngraph::element::Type sequenceType;
+    InferenceEngine::Precision outputPrecision;
+    uint64_t globalSeed = 0;
+    uint64_t opSeed = 0;
+    // the first and the second halves of the Philox counter used by the next inference
+    std::pair<uint64_t, uint64_t> state {0, 0};
+    size_t elementsCount = 0;
+    // the number of the values of a single type made of a group of 4 values: 2 for 64 bits types and 4 otherwise
+    size_t step = 4;
+
+    // the keys of the rounds for the scalar code and the ones broadcasted for the kernel
+    std::vector<uint32_t> keys;
+    std::vector<uint64_t> kernelKeys;
+
+    // min and max read by the current inference
+    double minValue = 0.0;
+    double maxValue = 0.0;
+    int64_t minInt = 0;
+    int64_t maxInt = 0;
+
+    std::unique_ptr<jit_uni_random_uniform_kernel> kernel;
+    std::unique_ptr<jit_uni_random_uniform_kernel> kernelToFloat;
+    size_t kernelLanes = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
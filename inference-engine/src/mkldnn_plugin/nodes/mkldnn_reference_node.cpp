@@ -4,16 +4,33 @@
 
 #include "mkldnn_reference_node.h"
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include <mkldnn_extension_utils.h>
-#include "openvino/runtime/tensor.hpp"
 #include "common/blocked_desc_creator.h"
 #include <ngraph/opsets/opset1.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <numeric>
+
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+// the outer dimension is split when each thread gets at least 4096 elements
+constexpr size_t partMinSize = 4096;
+
+bool evaluate(const std::shared_ptr<ngraph::Node>& op, const ngraph::HostTensorVector& outputs, const ngraph::HostTensorVector& inputs) {
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    return op->evaluate(outputs, inputs);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+}
+}  // namespace
+
 MKLDNNReferenceNode::MKLDNNReferenceNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache,
                                          const std::string& errorMessage) :
         MKLDNNNode(op, eng, cache), ngraphOp(op), additionalErrorMessage(errorMessage) {
@@ -29,6 +46,11 @@ MKLDNNReferenceNode::MKLDNNReferenceNode(const std::shared_ptr<ngraph::Node>& op
     if (ov::is_type<ngraph::op::v8::RandomUniform>(ngraphOp)) {
         constant = ConstantType::NoConst;
     }
+
+    isSeparable = ov::is_type<ngraph::op::util::UnaryElementwiseArithmetic>(ngraphOp) ||
+                  ov::is_type<ngraph::op::util::BinaryElementwiseArithmetic>(ngraphOp) ||
+                  ov::is_type<ngraph::op::util::BinaryElementwiseComparison>(ngraphOp) ||
+                  ov::is_type<ngraph::op::util::BinaryElementwiseLogical>(ngraphOp);
 }
 
 void MKLDNNReferenceNode::getSupportedDescriptors() {}
@@ -54,26 +76,130 @@ void MKLDNNReferenceNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNReferenceNode::createPrimitive() {}
 
-void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
-    ov::runtime::TensorVector inputs;
-    for (size_t i = 0; i < inputShapes.size(); i++) {
-        void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
-        inputs.push_back(ov::runtime::Tensor(ngraphOp->get_input_element_type(i),
-                                             getParentEdgesAtPort(i)[0]->getMemory().getStaticDims(), srcDataPtr));
+bool MKLDNNReferenceNode::isBound() const {
+    if (boundPtrs.empty())
+        return false;
+    size_t port = 0;
+    for (size_t i = 0; i < inputShapes.size(); i++, port++) {
+        const auto& mem = getParentEdgesAtPort(i)[0]->getMemory();
+        if (boundPtrs[port] != mem.GetPtr() || boundDims[port] != mem.getStaticDims())
+            return false;
+    }
+    for (size_t i = 0; i < outputShapes.size(); i++, port++) {
+        const auto& mem = getChildEdgesAtPort(i)[0]->getMemory();
+        if (boundPtrs[port] != mem.GetPtr() || boundDims[port] != mem.getStaticDims())
+            return false;
     }
+    return true;
+}
 
-    ov::runtime::TensorVector outputs;
+void MKLDNNReferenceNode::bind() {
+    inputTensors.clear();
+    outputTensors.clear();
+    boundPtrs.clear();
+    boundDims.clear();
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        const auto& mem = getParentEdgesAtPort(i)[0]->getMemory();
+        inputTensors.push_back(std::make_shared<ngraph::runtime::HostTensor>(ngraphOp->get_input_element_type(i), mem.getStaticDims(), mem.GetPtr()));
+        boundPtrs.push_back(mem.GetPtr());
+        boundDims.push_back(mem.getStaticDims());
+    }
     for (size_t i = 0; i < outputShapes.size(); i++) {
-        void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
-        outputs.push_back(ov::runtime::Tensor(ngraphOp->get_output_element_type(i),
-                                              getChildEdgesAtPort(i)[0]->getMemory().getStaticDims(), dstDataPtr));
+        const auto& mem = getChildEdgesAtPort(i)[0]->getMemory();
+        outputTensors.push_back(std::make_shared<ngraph::runtime::HostTensor>(ngraphOp->get_output_element_type(i), mem.getStaticDims(), mem.GetPtr()));
+        boundPtrs.push_back(mem.GetPtr());
+        boundDims.push_back(mem.getStaticDims());
     }
+    bindParts();
+}
+
+void MKLDNNReferenceNode::bindParts() {
+    parts.clear();
+    if (!isSeparable)
+        return;
 
-    if (!ngraphOp->evaluate(outputs, inputs)) {
+    // all ports have the same shape, so the elementwise operation is evaluated by the parts of the outer dimension
+    const auto& dims = boundDims.front();
+    if (dims.empty() || std::any_of(boundDims.begin(), boundDims.end(), [&](const VectorDims& portDims) { return portDims != dims; }))
+        return;
+    auto isByteAligned = [](const ngraph::element::Type& type) { return type.bitwidth() % 8 == 0; };
+    for (size_t i = 0; i < ngraphOp->get_input_size(); i++) {
+        if (!isByteAligned(ngraphOp->get_input_element_type(i)))
+            return;
+    }
+    for (size_t i = 0; i < ngraphOp->get_output_size(); i++) {
+        if (!isByteAligned(ngraphOp->get_output_element_type(i)))
+            return;
+    }
+
+    const size_t innerSize = std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t partsNum = std::min<size_t>({static_cast<size_t>(parallel_get_max_threads()), dims[0], dims[0] * innerSize / partMinSize});
+    if (partsNum < 2)
+        return;
+
+    // the parts differ by one row at most, so there are two clones of the operation at most
+    std::map<size_t, std::shared_ptr<ngraph::Node>> clones;
+    for (size_t p = 0; p < partsNum; p++) {
+        size_t start = 0, end = 0;
+        splitter(dims[0], partsNum, p, start, end);
+        ngraph::Shape partShape(dims.begin(), dims.end());
+        partShape[0] = end - start;
+
+        auto& clone = clones[partShape[0]];
+        if (!clone) {
+            ngraph::OutputVector partInputs;
+            for (size_t i = 0; i < ngraphOp->get_input_size(); i++)
+                partInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(ngraphOp->get_input_element_type(i), partShape));
+            clone = ngraphOp->clone_with_new_inputs(partInputs);
+        }
+
+        Part part;
+        part.op = clone;
+        for (size_t i = 0; i < inputTensors.size(); i++) {
+            const auto& type = ngraphOp->get_input_element_type(i);
+            auto data = static_cast<uint8_t*>(inputTensors[i]->get_data_ptr()) + start * innerSize * type.size();
+            part.inputs.push_back(std::make_shared<ngraph::runtime::HostTensor>(type, partShape, data));
+        }
+        for (size_t i = 0; i < outputTensors.size(); i++) {
+            const auto& type = ngraphOp->get_output_element_type(i);
+            auto data = static_cast<uint8_t*>(outputTensors[i]->get_data_ptr()) + start * innerSize * type.size();
+            part.outputs.push_back(std::make_shared<ngraph::runtime::HostTensor>(type, partShape, data));
+        }
+        parts.push_back(part);
+    }
+}
+
+void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
+    if (!isBound())
+        bind();
+
+    bool evaluated = true;
+    if (parts.empty()) {
+        evaluated = evaluate(ngraphOp, outputTensors, inputTensors);
+    } else {
+        std::atomic<bool> partsEvaluated(true);
+        parallel_for(parts.size(), [&](size_t p) {
+            if (!evaluate(parts[p].op, parts[p].outputs, parts[p].inputs))
+                partsEvaluated = false;
+        });
+        evaluated = partsEvaluated;
+    }
+
+    if (!evaluated) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
     }
 }
 
+std::string MKLDNNReferenceNode::getFallbackInfo() const {
+    const auto& typeInfo = ngraphOp->get_type_info();
+    std::string info = std::string("fallback:") + typeInfo.name;
+    if (typeInfo.version_id)
+        info += std::string("-") + typeInfo.version_id;
+    if (!parts.empty())
+        info += ":parallel";
+    return info;
+}
+
 // TODO [DS]: rewrite after new shape infer will be added
 std::vector<VectorDims> MKLDNNReferenceNode::shapeInfer() const {
     ngraph::OutputVector inputsForShapeInfer;
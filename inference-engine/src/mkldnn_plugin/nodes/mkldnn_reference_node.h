@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_node.h>
+#include <ngraph/runtime/host_tensor.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -23,9 +24,35 @@ public:
     bool needPrepareParams() const override { return false; }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
+    // The flag of the performance counters: the type of the operation which falls back on the ngraph reference
+    // implementation and whether it is evaluated by the parts of the outer dimension in parallel
+    std::string getFallbackInfo() const;
+
 private:
+    // the part of the outer dimension evaluated by the clone of the operation with the shapes of the part
+    struct Part {
+        std::shared_ptr<ngraph::Node> op;
+        ngraph::HostTensorVector inputs;
+        ngraph::HostTensorVector outputs;
+    };
+
+    bool isBound() const;
+    void bind();
+    void bindParts();
+
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+
+    // The host tensors are bound to the memory of the edges once and are rebound only when the memory or the shapes
+    // change, so the evaluation does not allocate the tensors and the operation is called directly
+    ngraph::HostTensorVector inputTensors;
+    ngraph::HostTensorVector outputTensors;
+    std::vector<const void*> boundPtrs;
+    std::vector<VectorDims> boundDims;
+
+    // elementwise operations are independent along the outer dimension
+    bool isSeparable = false;
+    std::vector<Part> parts;
 };
 
 }  // namespace MKLDNNPlugin
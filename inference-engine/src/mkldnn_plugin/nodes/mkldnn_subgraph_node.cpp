@@ -0,0 +1,328 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_subgraph_node.h"
+
+#include <mkldnn.hpp>
+#include <mkldnn_extension_utils.h>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include "emitters/cpu_generator.hpp"
+#include "emitters/jit_snippets_emitters.hpp"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <numeric>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+namespace {
+
+using snippet_kernel_t = void (*)(const jit_snippets_call_args*);
+
+VectorDims padLeft(const VectorDims& dims, size_t rank) {
+    VectorDims padded(rank, 1);
+    std::copy(dims.begin(), dims.end(), padded.begin() + (rank - dims.size()));
+    return padded;
+}
+
+}  // namespace
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<const ngraph::snippets::op::Subgraph>(op)) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (!mayiuse(avx2)) {
+            errorMessage = "Snippets code generation requires AVX2 support";
+            return false;
+        }
+        if (op->is_dynamic()) {
+            errorMessage = "Doesn't support dynamic shapes";
+            return false;
+        }
+        if (op->get_input_size() + op->get_output_size() > SNIPPETS_MAX_ARGS) {
+            errorMessage = "Doesn't support more than " + std::to_string(SNIPPETS_MAX_ARGS) + " inputs and outputs in total";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 inputs";
+                return false;
+            }
+        }
+        const auto& outShape = op->get_output_shape(0);
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 outputs";
+                return false;
+            }
+            if (output.get_shape() != outShape) {
+                errorMessage = "Supports only outputs of the same shape";
+                return false;
+            }
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_shape().size() > outShape.size()) {
+                errorMessage = "Doesn't support inputs of the rank greater than the output rank";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+bool MKLDNNSnippetNode::isLowerable(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) noexcept {
+    std::string errorMessage;
+    if (!isSupportedOperation(subgraph, errorMessage))
+        return false;
+
+    // the code is checked for the planar layout, the other layouts selected by the node differ by the strides only
+    auto toPlanarShape = [](const ngraph::Shape& shape) -> ngraph::snippets::op::Subgraph::BlockedShape {
+        ngraph::AxisVector order(shape.size());
+        std::iota(order.begin(), order.end(), 0);
+        return std::make_tuple(shape, order, ngraph::element::f32);
+    };
+    try {
+        ngraph::snippets::op::Subgraph::BlockedShapeVector inBlockedShapes, outBlockedShapes;
+        for (const auto& input : subgraph->inputs())
+            inBlockedShapes.push_back(toPlanarShape(input.get_shape()));
+        for (const auto& output : subgraph->outputs())
+            outBlockedShapes.push_back(toPlanarShape(output.get_shape()));
+
+        auto snippet = subgraph->make_canonical_from_this();
+        snippet->set_generator(std::make_shared<CPUGenerator>(mayiuse(avx512_common) ? avx512_common : avx2));
+        return snippet->generate(outBlockedShapes, inBlockedShapes).ptr != nullptr;
+    } catch (...) {
+        return false;
+    }
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Subgraph node with name '" + getName() + "'";
+    original = ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    hasBroadcasting = false;
+    for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
+        if (getInputShapeAtPort(i).getStaticDims() != outDims)
+            hasBroadcasting = true;
+    }
+
+    const impl_desc_type implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+
+    auto addDesc = [&](LayoutType layout) {
+        std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {layout, Precision::FP32});
+        std::vector<PortConfigurator> outConfs(getOriginalOutputsNumber(), {layout, Precision::FP32});
+        addSupportedPrimDesc(inConfs, outConfs, implType);
+    };
+
+    addDesc(LayoutType::ncsp);
+    // the channels last layout is processed as a flat array, so it's applicable only when there is no broadcasting;
+    // the innermost dimension must not be equal to 1 since the kernel doesn't advance the pointers over such dimension
+    if (!hasBroadcasting && one_of(outDims.size(), 4u, 5u) && outDims[1] != 1) {
+        addDesc(LayoutType::nspc);
+    }
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    for (size_t i = 0; i < getOriginalOutputsNumber(); i++) {
+        auto &dstMemPtr = getChildEdgesAtPort(i)[0]->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << " has not allocated destination memory";
+    }
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto &srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << " has not allocated input memory";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    isa = mayiuse(avx512_common) ? avx512_common : avx2;
+
+    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    totalSize = std::accumulate(outDims.begin(), outDims.end(), size_t(1), std::multiplies<size_t>());
+
+    // the shapes are passed in the layout of the memory, so the code is generated for the actual innermost dimension
+    auto toBlockedShape = [](const BlockedMemoryDesc& desc) -> ngraph::snippets::op::Subgraph::BlockedShape {
+        const auto& blockDims = desc.getBlockDims();
+        const auto& order = desc.getOrder();
+        return std::make_tuple(ngraph::Shape(blockDims.begin(), blockDims.end()),
+                               ngraph::AxisVector(order.begin(), order.end()),
+                               ngraph::element::f32);
+    };
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inBlockedShapes, outBlockedShapes;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        inBlockedShapes.push_back(toBlockedShape(*getParentEdgeAt(i)->getMemory().GetDescWithType<BlockedMemoryDesc>()));
+    for (size_t i = 0; i < getOriginalOutputsNumber(); i++)
+        outBlockedShapes.push_back(toBlockedShape(*getChildEdgesAtPort(i)[0]->getMemory().GetDescWithType<BlockedMemoryDesc>()));
+
+    const bool isPlanar = getChildEdgesAtPort(0)[0]->getMemory().getDesc().hasLayoutType(LayoutType::ncsp);
+    isFlat = !hasBroadcasting && (!isPlanar || (!outDims.empty() && outDims.back() != 1));
+    if (!isFlat)
+        prepareRows();
+
+    snippet = original->make_canonical_from_this();
+    snippet->set_generator(std::make_shared<CPUGenerator>(isa));
+    try {
+        schedule = snippet->generate(outBlockedShapes, inBlockedShapes);
+    } catch (const ngraph::ngraph_error& ex) {
+        IE_THROW() << errorPrefix << " failed to generate code: " << ex.what();
+    }
+    if (!schedule.ptr)
+        IE_THROW() << errorPrefix << " failed to generate code";
+}
+
+void MKLDNNSnippetNode::prepareRows() {
+    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    const size_t rank = outDims.size();
+
+    std::vector<VectorDims> inDims;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        inDims.push_back(padLeft(getInputShapeAtPort(i).getStaticDims(), rank));
+
+    // The kernel loads the input vector by vector if its innermost dimension is not 1 and broadcasts the first element
+    // otherwise. So the outer dimension is collapsed into the innermost one only if each input either is contiguous
+    // over it or is broadcasted over it as well.
+    size_t collapsed = rank == 0 ? 0 : 1;
+    innerSize = rank == 0 ? 1 : outDims.back();
+    while (collapsed < rank) {
+        const size_t k = rank - 1 - collapsed;
+        bool canCollapse = true;
+        for (const auto& dims : inDims) {
+            const bool isContiguous = dims.back() != 1;
+            if ((isContiguous && dims[k] != outDims[k]) || (!isContiguous && dims[k] != 1)) {
+                canCollapse = false;
+                break;
+            }
+        }
+        if (!canCollapse)
+            break;
+        innerSize *= outDims[k];
+        collapsed++;
+    }
+
+    const size_t outerRank = rank - collapsed;
+    outerDims.assign(outDims.begin(), outDims.begin() + outerRank);
+
+    auto denseStrides = [rank](const VectorDims& dims) {
+        VectorDims strides(rank, 1);
+        for (int i = static_cast<int>(rank) - 2; i >= 0; i--)
+            strides[i] = strides[i + 1] * dims[i + 1];
+        return strides;
+    };
+
+    inStrides.clear();
+    for (const auto& dims : inDims) {
+        auto strides = denseStrides(dims);
+        std::vector<size_t> outer(outerRank);
+        for (size_t d = 0; d < outerRank; d++)
+            outer[d] = dims[d] == 1 ? 0 : strides[d];
+        inStrides.push_back(outer);
+    }
+    const auto strides = denseStrides(outDims);
+    outStrides.assign(strides.begin(), strides.begin() + outerRank);
+}
+
+void MKLDNNSnippetNode::executeFlat(const std::vector<const uint8_t*>& srcPtrs, const std::vector<uint8_t*>& dstPtrs) {
+    const auto kernel = schedule.get_callable<snippet_kernel_t>();
+    const size_t lanes = (isa == avx512_common ? cpu_isa_traits<avx512_common>::vlen : cpu_isa_traits<avx2>::vlen) / sizeof(float);
+    const size_t blocks = div_up(totalSize, lanes);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        start *= lanes;
+        end = std::min(end * lanes, totalSize);
+        if (start >= end)
+            return;
+
+        jit_snippets_call_args args;
+        size_t arg = 0;
+        for (auto ptr : srcPtrs)
+            args.ptrs[arg++] = ptr + start * sizeof(float);
+        for (auto ptr : dstPtrs)
+            args.ptrs[arg++] = ptr + start * sizeof(float);
+        args.work_amount = end - start;
+        kernel(&args);
+    });
+}
+
+void MKLDNNSnippetNode::executeRows(const std::vector<const uint8_t*>& srcPtrs, const std::vector<uint8_t*>& dstPtrs) {
+    const auto kernel = schedule.get_callable<snippet_kernel_t>();
+    const size_t outerRank = outerDims.size();
+    const size_t rows = std::accumulate(outerDims.begin(), outerDims.end(), size_t(1), std::multiplies<size_t>());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(rows, nthr, ithr, start, end);
+
+        jit_snippets_call_args args;
+        for (size_t row = start; row < end; row++) {
+            size_t inOffsets[SNIPPETS_MAX_ARGS] = {};
+            size_t outOffset = 0;
+            size_t idx = row;
+            for (int d = static_cast<int>(outerRank) - 1; d >= 0; d--) {
+                const size_t coord = idx % outerDims[d];
+                idx /= outerDims[d];
+                for (size_t i = 0; i < srcPtrs.size(); i++)
+                    inOffsets[i] += coord * inStrides[i][d];
+                outOffset += coord * outStrides[d];
+            }
+
+            size_t arg = 0;
+            for (size_t i = 0; i < srcPtrs.size(); i++)
+                args.ptrs[arg++] = srcPtrs[i] + inOffsets[i] * sizeof(float);
+            for (auto ptr : dstPtrs)
+                args.ptrs[arg++] = ptr + outOffset * sizeof(float);
+            args.work_amount = innerSize;
+            kernel(&args);
+        }
+    });
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    std::vector<const uint8_t*> srcPtrs;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        srcPtrs.push_back(reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr()));
+    std::vector<uint8_t*> dstPtrs;
+    for (size_t i = 0; i < getOriginalOutputsNumber(); i++)
+        dstPtrs.push_back(reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr()));
+
+    if (isFlat) {
+        executeFlat(srcPtrs, dstPtrs);
+    } else {
+        executeRows(srcPtrs, dstPtrs);
+    }
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_node.h>
+#include <ie_common.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <snippets/op/subgraph.hpp>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes the eltwise subgraph tokenized by the snippets transformations with a kernel generated by the snippets generator.
+ * The generated kernel processes the innermost (collapsed) dimension of the tensors, the node schedules the outer dimensions.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+    /**
+     * Checks that the node takes the subgraph and the code is generated for it, the subgraphs which fail the check are
+     * expanded back to the original operations before the graph is created.
+     */
+    static bool isLowerable(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) noexcept;
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    void prepareRows();
+    void executeFlat(const std::vector<const uint8_t*>& srcPtrs, const std::vector<uint8_t*>& dstPtrs);
+    void executeRows(const std::vector<const uint8_t*>& srcPtrs, const std::vector<uint8_t*>& dstPtrs);
+
+    // the original subgraph is kept intact, the code is generated for its canonical copy
+    std::shared_ptr<ngraph::snippets::op::Subgraph> original;
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    ngraph::snippets::Schedule schedule;
+
+    mkldnn::impl::cpu::x64::cpu_isa_t isa = mkldnn::impl::cpu::x64::isa_any;
+    // some input is broadcasted to the output shape, only the planar layout is supported then
+    bool hasBroadcasting = false;
+    // all the tensors are processed as flat arrays by a single kernel call per thread
+    bool isFlat = false;
+
+    // outer dimensions scheduled by the node and the element strides of every argument over them
+    std::vector<size_t> outerDims;
+    std::vector<std::vector<size_t>> inStrides;
+    std::vector<size_t> outStrides;
+    size_t innerSize = 0;
+    size_t totalSize = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -308,6 +308,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         IE_THROW() << "Can't cast TensorIterator node with name: " << getName() << " to ngraph::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ngraph::Function> body = tiOp->get_function();
+    sub_graph.setRuntimeCache(getRuntimeCache());
     sub_graph.CreateGraph(body, ext_mng, weightCache);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
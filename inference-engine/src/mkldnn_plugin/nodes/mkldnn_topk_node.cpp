@@ -3,6 +3,10 @@
 //
 
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -10,6 +14,9 @@
 #include "ie_parallel.hpp"
 #include "mkldnn_topk_node.h"
 #include "utils/general_utils.h"
+#include "utils/bfloat16.hpp"
+#include "cache/hash_utils.h"
+#include <cpu/x64/jit_generator.hpp>
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -17,6 +24,331 @@
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_topk_call_args, field)
+
+namespace {
+
+// Compare-exchanges of the bitonic network which sorts `size` elements, the better element of a pair goes first
+std::vector<std::pair<int, int>> bitonic_sort_network(int size) {
+    std::vector<std::pair<int, int>> network;
+    for (int k = 2; k <= size; k <<= 1) {
+        for (int j = k >> 1; j > 0; j >>= 1) {
+            for (int i = 0; i < size; i++) {
+                const int l = i ^ j;
+                if (l > i)
+                    network.emplace_back((i & k) == 0 ? std::make_pair(i, l) : std::make_pair(l, i));
+            }
+        }
+    }
+    return network;
+}
+
+// Compare-exchanges which sort a bitonic sequence of `size` elements
+std::vector<std::pair<int, int>> bitonic_merge_network(int size) {
+    std::vector<std::pair<int, int>> network;
+    for (int j = size >> 1; j > 0; j >>= 1) {
+        for (int i = 0; i < size; i++) {
+            const int l = i ^ j;
+            if (l > i)
+                network.emplace_back(i, l);
+        }
+    }
+    return network;
+}
+
+template <typename T>
+struct topk_key {
+    using type = float;
+};
+
+template <>
+struct topk_key<int32_t> {
+    using type = int32_t;
+};
+
+// The value which loses to any value of the data, the padding of the sequences
+template <typename T>
+T topk_worst_value(bool mode_max) {
+    if (std::numeric_limits<T>::has_infinity)
+        return mode_max ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    return mode_max ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+}
+
+// Stores the best values sorted by value, they are reordered by index if the values are not sorted
+template <typename T, typename K>
+void topk_store(std::vector<std::pair<K, int>>& result, bool sort_value, T* dst_data, int* dst_idx,
+                size_t offset, size_t stride) {
+    if (!sort_value) {
+        std::sort(result.begin(), result.end(), [](const std::pair<K, int>& a, const std::pair<K, int>& b) {
+            return a.second < b.second;
+        });
+    }
+    for (size_t i = 0; i < result.size(); i++) {
+        if (dst_data)
+            dst_data[offset + i * stride] = static_cast<T>(result[i].first);
+        if (dst_idx)
+            dst_idx[offset + i * stride] = result[i].second;
+    }
+}
+
+// The kernels depend on the configuration only, so they are shared by the nodes and by the values of K through
+// the runtime cache
+struct TopKKey {
+    jit_topk_config_params jcp;
+
+    size_t hash() const {
+        size_t seed = 0;
+        seed = hash_combine(seed, jcp.mode_max);
+        seed = hash_combine(seed, jcp.is_int);
+        seed = hash_combine(seed, jcp.top_k);
+        seed = hash_combine(seed, jcp.sort_size);
+        return seed;
+    }
+
+    bool operator==(const TopKKey& rhs) const {
+        return jcp.mode_max == rhs.jcp.mode_max && jcp.is_int == rhs.jcp.is_int && jcp.top_k == rhs.jcp.top_k &&
+               jcp.sort_size == rhs.jcp.sort_size;
+    }
+};
+
+}  // namespace
+
+// Selects the best K values of `lanes` independent sequences at once, the sequences are packed by the node
+// to [length][lanes] layout. The best values are kept sorted by the bitonic network, each following chunk of
+// `sort_size` values is sorted by the same network and merged with them. The chunks which have no value better
+// than the K-th best one in any of the lanes are skipped after a single comparison per value.
+// Equal values are ordered by their indices, the same way as the reference implementation does.
+template <cpu_isa_t isa>
+struct jit_uni_topk_kernel_f32 : public jit_uni_topk_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_topk_kernel_f32)
+
+    explicit jit_uni_topk_kernel_f32(jit_topk_config_params jcp) : jit_uni_topk_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const int sort_size = jcp_.sort_size;
+        const auto sort_network = bitonic_sort_network(sort_size);
+        const auto merge_network = bitonic_merge_network(sort_size);
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_src_idx, ptr[reg_params + GET_OFF(src_idx)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_dst_idx, ptr[reg_params + GET_OFF(dst_idx)]);
+        mov(reg_chunks, ptr[reg_params + GET_OFF(chunks)]);
+
+        mov(reg_tmp.cvt32(), 1);
+        broadcast_int(vmm_one, reg_tmp.cvt32());
+        xor_(reg_index, reg_index);
+
+        // the first chunk initializes the best values
+        for (int i = 0; i < sort_size; i++) {
+            uni_vmovups(vmm_a, ptr[reg_src + i * vlen]);
+            uni_vmovups(ptr[reg_dst + i * vlen], vmm_a);
+        }
+        store_indices(reg_dst_idx);
+        apply_network(reg_dst, reg_dst_idx, sort_network);
+        next_chunk();
+
+        Xbyak::Label chunk_loop_label;
+        Xbyak::Label chunk_skip_label;
+        Xbyak::Label exit_label;
+
+        L(chunk_loop_label); {
+            cmp(reg_chunks, 0);
+            je(exit_label, T_NEAR);
+
+            test_chunk();
+            jz(chunk_skip_label, T_NEAR);
+
+            store_indices(reg_src_idx);
+            apply_network(reg_src, reg_src_idx, sort_network);
+            // the best values and the reversed sorted chunk form the bitonic sequence of the best values of both
+            for (int i = 0; i < sort_size; i++)
+                select_better(i, sort_size - 1 - i);
+            apply_network(reg_dst, reg_dst_idx, merge_network);
+
+            L(chunk_skip_label);
+            next_chunk();
+            jmp(chunk_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_src_idx = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_dst_idx = r11;
+    Xbyak::Reg64 reg_chunks = r12;
+    Xbyak::Reg64 reg_index = r13;
+    Xbyak::Reg64 reg_tmp = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_a = Vmm(0);
+    Vmm vmm_b = Vmm(1);
+    Vmm vmm_a_idx = Vmm(2);
+    Vmm vmm_b_idx = Vmm(3);
+    Vmm vmm_tmp = Vmm(4);
+    Vmm vmm_mask = Vmm(5);
+    Vmm vmm_eq = Vmm(6);
+    Vmm vmm_idx_gt = Vmm(7);
+    Vmm vmm_one = Vmm(8);
+    Vmm vmm_index = Vmm(9);
+    Vmm vmm_thr = Vmm(10);
+    Vmm vmm_any = Vmm(11);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_eq = Xbyak::Opmask(2);
+    const Xbyak::Opmask k_idx_gt = Xbyak::Opmask(3);
+    const Xbyak::Opmask k_any = Xbyak::Opmask(4);
+
+    void broadcast_int(const Vmm& vmm, const Xbyak::Reg32& reg) {
+        if (isa == avx512_common) {
+            vpbroadcastd(vmm, reg);
+        } else {
+            Xbyak::Xmm xmm = Xbyak::Xmm(vmm.getIdx());
+            vmovd(xmm, reg);
+            vpbroadcastd(vmm, xmm);
+        }
+    }
+
+    void next_chunk() {
+        add(reg_src, jcp_.sort_size * vlen);
+        add(reg_index, jcp_.sort_size);
+        sub(reg_chunks, 1);
+    }
+
+    // the indices of the current chunk
+    void store_indices(const Xbyak::Reg64& reg_idx) {
+        broadcast_int(vmm_index, reg_index.cvt32());
+        for (int i = 0; i < jcp_.sort_size; i++) {
+            uni_vmovups(ptr[reg_idx + i * vlen], vmm_index);
+            uni_vpaddd(vmm_index, vmm_index, vmm_one);
+        }
+    }
+
+    // sets the mask of the lanes where x is strictly better than y
+    void compare_values(const Vmm& x, const Vmm& y) {
+        const Vmm& better = jcp_.mode_max ? x : y;
+        const Vmm& worse = jcp_.mode_max ? y : x;
+        if (isa == avx512_common) {
+            if (jcp_.is_int)
+                vpcmpgtd(k_mask, better, worse);
+            else
+                vcmpps(k_mask, worse, better, _cmp_lt_os);
+        } else {
+            if (jcp_.is_int)
+                vpcmpgtd(vmm_mask, better, worse);
+            else
+                vcmpps(vmm_mask, worse, better, _cmp_lt_os);
+        }
+    }
+
+    // sets the mask of the lanes where x goes before y: its value is better or equal with the lesser index
+    void compare(const Vmm& x, const Vmm& x_idx, const Vmm& y, const Vmm& y_idx) {
+        compare_values(x, y);
+        if (isa == avx512_common) {
+            if (jcp_.is_int)
+                vpcmpeqd(k_eq, x, y);
+            else
+                vcmpps(k_eq, x, y, _cmp_eq_oq);
+            vpcmpgtd(k_idx_gt, y_idx, x_idx);
+            kandw(k_eq, k_eq, k_idx_gt);
+            korw(k_mask, k_mask, k_eq);
+        } else {
+            if (jcp_.is_int)
+                vpcmpeqd(vmm_eq, x, y);
+            else
+                vcmpps(vmm_eq, x, y, _cmp_eq_oq);
+            vpcmpgtd(vmm_idx_gt, y_idx, x_idx);
+            vandps(vmm_eq, vmm_eq, vmm_idx_gt);
+            vorps(vmm_mask, vmm_mask, vmm_eq);
+        }
+    }
+
+    // dst = mask ? y : x
+    void blend(const Vmm& dst, const Vmm& x, const Vmm& y) {
+        if (isa == avx512_common)
+            vblendmps(dst | k_mask, x, y);
+        else
+            vblendvps(dst, x, y, vmm_mask);
+    }
+
+    void apply_network(const Xbyak::Reg64& reg_val, const Xbyak::Reg64& reg_idx,
+                       const std::vector<std::pair<int, int>>& network) {
+        for (const auto& pair : network) {
+            const int first = pair.first * vlen;
+            const int second = pair.second * vlen;
+            uni_vmovups(vmm_a, ptr[reg_val + first]);
+            uni_vmovups(vmm_b, ptr[reg_val + second]);
+            uni_vmovups(vmm_a_idx, ptr[reg_idx + first]);
+            uni_vmovups(vmm_b_idx, ptr[reg_idx + second]);
+
+            compare(vmm_b, vmm_b_idx, vmm_a, vmm_a_idx);
+            blend(vmm_tmp, vmm_a, vmm_b);
+            blend(vmm_b, vmm_b, vmm_a);
+            uni_vmovups(ptr[reg_val + first], vmm_tmp);
+            uni_vmovups(ptr[reg_val + second], vmm_b);
+
+            blend(vmm_tmp, vmm_a_idx, vmm_b_idx);
+            blend(vmm_b_idx, vmm_b_idx, vmm_a_idx);
+            uni_vmovups(ptr[reg_idx + first], vmm_tmp);
+            uni_vmovups(ptr[reg_idx + second], vmm_b_idx);
+        }
+    }
+
+    // the i-th best value is replaced by the j-th value of the chunk if the latter is better
+    void select_better(int i, int j) {
+        uni_vmovups(vmm_a, ptr[reg_dst + i * vlen]);
+        uni_vmovups(vmm_b, ptr[reg_src + j * vlen]);
+        uni_vmovups(vmm_a_idx, ptr[reg_dst_idx + i * vlen]);
+        uni_vmovups(vmm_b_idx, ptr[reg_src_idx + j * vlen]);
+
+        compare(vmm_b, vmm_b_idx, vmm_a, vmm_a_idx);
+        blend(vmm_a, vmm_a, vmm_b);
+        blend(vmm_a_idx, vmm_a_idx, vmm_b_idx);
+        uni_vmovups(ptr[reg_dst + i * vlen], vmm_a);
+        uni_vmovups(ptr[reg_dst_idx + i * vlen], vmm_a_idx);
+    }
+
+    // sets ZF if no value of the chunk is better than the K-th best value in any lane,
+    // the values of the chunk follow the best ones, so the equal values are not better
+    void test_chunk() {
+        uni_vmovups(vmm_thr, ptr[reg_dst + (jcp_.top_k - 1) * vlen]);
+        if (isa == avx512_common)
+            kxorw(k_any, k_any, k_any);
+        else
+            uni_vpxor(vmm_any, vmm_any, vmm_any);
+        for (int i = 0; i < jcp_.sort_size; i++) {
+            uni_vmovups(vmm_a, ptr[reg_src + i * vlen]);
+            compare_values(vmm_a, vmm_thr);
+            if (isa == avx512_common)
+                korw(k_any, k_any, k_mask);
+            else
+                vorps(vmm_any, vmm_any, vmm_mask);
+        }
+        if (isa == avx512_common)
+            kortestw(k_any, k_any);
+        else
+            vptest(vmm_any, vmm_any);
+    }
+};
 
 bool MKLDNNTopKNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -59,27 +391,89 @@ void MKLDNNTopKNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    data_prec = getOriginalInputPrecisionAtPort(TOPK_DATA);
+    if (!MKLDNNPlugin::one_of(data_prec, Precision::FP32, Precision::BF16, Precision::I32))
+        data_prec = Precision::FP32;
+    if (data_prec == Precision::BF16 && !mayiuse(avx512_core))
+        data_prec = Precision::FP32;
+
+    impl_desc_type impl_type = impl_desc_type::ref_any;
+    if (mayiuse(avx512_common))
+        impl_type = impl_desc_type::jit_avx512;
+    else if (mayiuse(avx2))
+        impl_type = impl_desc_type::jit_avx2;
+
     std::vector<PortConfigurator> outDataConf;
     outDataConf.reserve(outputShapes.size());
-    outDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+    outDataConf.emplace_back(LayoutType::ncsp, data_prec);
     for (int i = 1; i < outputShapes.size(); ++i)
         outDataConf.emplace_back(LayoutType::ncsp, Precision::I32);
 
-    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32},
+    addSupportedPrimDesc({{LayoutType::ncsp, data_prec},
                           {LayoutType::ncsp, Precision::I32}},
                          outDataConf,
-                         impl_desc_type::ref_any);
+                         impl_type);
+}
+
+void MKLDNNTopKNode::prepareParams() {
+    const auto& in_dims = getParentEdgeAt(TOPK_DATA)->getMemory().getStaticDims();
+    const auto& out_dims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    prepared_k = static_cast<int>(out_dims[axis]);
+    const int top_k = std::min(prepared_k, static_cast<int>(in_dims[axis]));
+
+    topk_kernel.reset();
+    // K == 1 of FP32 data is selected by the intrinsics
+    if (top_k < 1 || top_k > topk_bitonic_max_k || (top_k == 1 && data_prec == Precision::FP32))
+        return;
+
+    if (mayiuse(avx512_common))
+        topk_lanes = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+    else if (mayiuse(avx2))
+        topk_lanes = cpu_isa_traits<avx2>::vlen / sizeof(float);
+    else
+        return;
+
+    TopKKey key;
+    key.jcp.mode_max = mode_max;
+    key.jcp.is_int = data_prec == Precision::I32;
+    key.jcp.top_k = top_k;
+    key.jcp.sort_size = 1;
+    while (key.jcp.sort_size < top_k)
+        key.jcp.sort_size <<= 1;
+
+    auto builder = [](const TopKKey& key) -> std::shared_ptr<jit_uni_topk_kernel> {
+        std::shared_ptr<jit_uni_topk_kernel> kernel;
+        if (mayiuse(avx512_common))
+            kernel.reset(new jit_uni_topk_kernel_f32<avx512_common>(key.jcp));
+        else if (mayiuse(avx2))
+            kernel.reset(new jit_uni_topk_kernel_f32<avx2>(key.jcp));
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+
+    auto result = getRuntimeCache()->getOrCreate(key, builder);
+    topk_kernel = result.first;
+}
+
+bool MKLDNNTopKNode::useBitonicKernel(size_t seq_num) const {
+    // the sequences are packed by the node, the packing buffer is bounded by the length of the axis
+    if (!topk_kernel || topk_kernel->jcp_.top_k != src_k || dim > topk_bitonic_max_length)
+        return false;
+    // a few long sequences are processed faster by the partitioning, their axis is split among the threads
+    const size_t blocks = MKLDNNPlugin::div_up(seq_num, static_cast<size_t>(topk_lanes));
+    return blocks >= static_cast<size_t>(parallel_get_max_threads()) || dim < 2 * topk_min_part_size;
 }
 
 void MKLDNNTopKNode::execute(mkldnn::stream strm) {
-    const float *src = reinterpret_cast<const float *>(getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->GetPtr());
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->GetPtr());
     src_k = reinterpret_cast<int *>(getParentEdgeAt(TOPK_K)->getMemoryPtr()->GetPtr())[0];
-    float* dst_data = nullptr;
+    uint8_t* dst_data = nullptr;
     int* dst_idx = nullptr;
 
     if (outputShapes.size() == 1) {
-        if (getOriginalOutputPrecisionAtPort(0) == Precision::FP32) {
-            dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+        if (MKLDNNPlugin::one_of(getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16)) {
+            dst_data = reinterpret_cast<uint8_t *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
         } else {
             dst_idx = reinterpret_cast<int *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
         }
@@ -90,7 +484,7 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
             IE_THROW() << errorMsg;
         }
     } else if (outputShapes.size() == 2) {
-        dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(TOPK_VALUE)[0]->getMemoryPtr()->GetPtr());
+        dst_data = reinterpret_cast<uint8_t *>(getChildEdgesAtPort(TOPK_VALUE)[0]->getMemoryPtr()->GetPtr());
         const VectorDims& dst_data_dims = getChildEdgesAtPort(TOPK_VALUE)[0]->getMemory().getStaticDims();
 
         dst_idx = reinterpret_cast<int *>(getChildEdgesAtPort(TOPK_INDEX)[0]->getMemoryPtr()->GetPtr());
@@ -122,39 +516,57 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
     dim = static_cast<int>(in_dims[axis]);
     before_num = count(in_dims, 0, axis);
 
-    if (src_k == 1) {
-        if (is_last_dim) {
-            if (mode_max)
-                top1<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
-    } else {
+    if (src_k == 0)
+        return;
+
+    if (src_k == 1 && data_prec == Precision::FP32) {
+        const float* src_f = reinterpret_cast<const float*>(src);
+        float* dst_f = reinterpret_cast<float*>(dst_data);
         if (is_last_dim) {
             if (mode_max)
-                topk<std::greater>(src, dst_data, dst_idx, in_dims);
+                top1<std::greater>(src_f, dst_f, dst_idx, in_dims);
             else
-                topk<std::less>(src, dst_data, dst_idx, in_dims);
+                top1<std::less>(src_f, dst_f, dst_idx, in_dims);
         } else {
             if (mode_max)
-                topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+                top1_axis<cmpgt_ps, std::greater>(src_f, dst_f, dst_idx, in_dims);
             else
-                topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+                top1_axis<cmplt_ps, std::less>(src_f, dst_f, dst_idx, in_dims);
         }
+        return;
+    }
+
+    const bool bitonic = useBitonicKernel(static_cast<size_t>(before_num) * count(in_dims, axis + 1));
+    switch (data_prec) {
+        case Precision::FP32:
+            topk_impl(bitonic, reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst_data), dst_idx, in_dims);
+            break;
+        case Precision::BF16:
+            topk_impl(bitonic, reinterpret_cast<const bfloat16_t*>(src), reinterpret_cast<bfloat16_t*>(dst_data), dst_idx, in_dims);
+            break;
+        case Precision::I32:
+            topk_impl(bitonic, reinterpret_cast<const int32_t*>(src), reinterpret_cast<int32_t*>(dst_data), dst_idx, in_dims);
+            break;
+        default:
+            IE_THROW() << errorPrefix << "has unsupported precision: " << data_prec.name();
     }
 }
 
+template <typename T>
+void MKLDNNTopKNode::topk_impl(bool bitonic, const T* src_data, T* dst_data, int* dst_idx, VectorDims in_dims) {
+    if (bitonic)
+        topk_bitonic(src_data, dst_data, dst_idx, in_dims);
+    else
+        topk_partition(src_data, dst_data, dst_idx, in_dims);
+}
+
 bool MKLDNNTopKNode::created() const {
     return getType() == TopK;
 }
 
 bool MKLDNNTopKNode::needPrepareParams() const {
-    return false;
+    // the kernel is compiled for the value of K, which is the size of the outputs along the axis
+    return static_cast<int>(getChildEdgesAtPort(0)[0]->getMemory().getStaticDims()[axis]) != prepared_k;
 }
 
 void MKLDNNTopKNode::executeDynamicImpl(mkldnn::stream strm) {
@@ -163,6 +575,9 @@ void MKLDNNTopKNode::executeDynamicImpl(mkldnn::stream strm) {
 
 void MKLDNNTopKNode::createPrimitive() {
     if (inputShapesDefined()) {
+        // the outputs of the dynamic node are defined by the value of K on the inference
+        if (!isDynamicNode() && needPrepareParams())
+            prepareParams();
         updateLastInputDims();
     }
 }
@@ -265,233 +680,138 @@ void MKLDNNTopKNode::top1(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
-template <class Compare1, template <typename> class Compare2>
-void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_idx, VectorDims in_dims) {
-    int after_num = count(in_dims, axis + 1, in_dims.size());
-    int first_index = 0;
-
-#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-    if (src_k < count_vec) {
-            parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
-#if defined(HAVE_AVX512F)
-                const int N = 32;
-                vec_type_f vmax_values[N];
-                vec_type_i vmax_indexes[N];
-#else
-                const int N = 16;
-                vec_type_f vmax_values[N];
-                vec_type_i vmax_indexes[N];
-#endif
-                vec_type_f vtmp;
-                vec_type_i vtmp_indexes;
-                vmask_type vmask;
-                int s_index = i0 * dim * after_num + ib1 * block_size;
-
-                auto vswap_func = [&](int index1, int index2) {
-                    vtmp = vmax_values[index1];
-                    vmax_values[index1] = _mm_uni_blendv_ps(vmax_values[index1], vmax_values[index2], vmask);
-                    vmax_values[index2] = _mm_uni_blendv_ps(vmax_values[index2], vtmp, vmask);
-
-                    vtmp_indexes = vmax_indexes[index1];
-#if defined(HAVE_AVX512F)
-                    vmax_indexes[index1] = _mm512_mask_blend_epi32(vmask, vmax_indexes[index1], vmax_indexes[index2]);
-                    vmax_indexes[index2] = _mm512_mask_blend_epi32(vmask, vmax_indexes[index2], vtmp_indexes);
-#else
-                    vmax_indexes[index1] = _mm_uni_blendv_epi8(vmax_indexes[index1], vmax_indexes[index2], _mm_uni_castps_si(vmask));
-                    vmax_indexes[index2] = _mm_uni_blendv_epi8(vmax_indexes[index2], vtmp_indexes, _mm_uni_castps_si(vmask));
-#endif
-                };
-
-                for (int i2 = 0; i2 < src_k; i2++) {
-                    vmax_values[i2] = _mm_uni_loadu_ps(src_data + s_index);
-                    vmax_indexes[i2] = _mm_uni_set1_epi32(i2);
-                    s_index += after_num;
-                }
-                for (int i2 = 0; i2 < src_k - 1; i2++) {
-                    for (int i3 = src_k - 1; i3 > i2; i3--) {
-                        vmask = Compare1::cmp_ps(vmax_values[i3], vmax_values[i3 - 1]);
-#if defined(HAVE_AVX512F)
-                        if (vmask)
-                            vswap_func(i3, i3 - 1);
-#else
-                        int swap = _mm_uni_movemask_ps(vmask);
-                        if (swap)
-                            vswap_func(i3, i3 - 1);
-#endif
-                    }
-                }
-                for (int i2 = src_k; i2 < dim; i2++) {
-                    vmax_values[src_k] = _mm_uni_loadu_ps(src_data + s_index);
-                    vmax_indexes[src_k] = _mm_uni_set1_epi32(i2);
-                    for (int i3 = src_k; i3 > 0; i3--) {
-                        vmask = Compare1::cmp_ps(vmax_values[i3], vmax_values[i3 - 1]);
-#if defined(HAVE_AVX512F)
-                        if (vmask)
-                            vswap_func(i3, i3 - 1);
-                        else
-                            break;
-#else
-                        int swap = _mm_uni_movemask_ps(vmask);
-                        if (swap)
-                            vswap_func(i3, i3 - 1);
-                        else
-                            break;
-#endif
-                    }
-                    s_index += after_num;
-                }
-                if (!sort_value) {
-                    for (int i2 = 0; i2 < src_k - 1; i2++) {
-                        for (int i3 = src_k - 1; i3 > i2; i3--) {
-                            vmask = _mm_uni_cmpgt_i32(vmax_indexes[i3 - 1], vmax_indexes[i3]);
-#if defined(HAVE_AVX512F)
-                            if (vmask)
-                                vswap_func(i3, i3 - 1);
-                            else
-                                break;
-#else
-                            int swap = _mm_uni_movemask_ps(vmask);
-                            if (swap)
-                                vswap_func(i3, i3 - 1);
-                            else
-                                break;
-#endif
-                        }
-                    }
-                }
-                if (dst_data) {
-                    for (int i2 = 0; i2 < src_k; i2++)
-                        _mm_uni_storeu_ps(dst_data + (i0 * src_k + i2) * after_num + ib1 * block_size, vmax_values[i2]);
-                }
-                if (dst_idx) {
-                    for (int i2 = 0; i2 < src_k; i2++)
-                        _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + (i0 * src_k + i2) * after_num + ib1 * block_size), vmax_indexes[i2]);
-                }
-            });
-            first_index = after_num / block_size * block_size;
-        }
-#endif
-    int rest = after_num - first_index;
-    parallel_for2d(before_num, rest, [&](int i0, int i1) {
-        std::vector<float> max_values(src_k + 1);
-        std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
-        int tmp_index;
-        int s_index = i0 * dim * after_num + first_index + i1;
-
-        auto swap_func = [&](int index1, int index2) {
-            tmp_value = max_values[index1];
-            max_values[index1] = max_values[index2];
-            max_values[index2] = tmp_value;
-
-            tmp_index = max_indexes[index1];
-            max_indexes[index1] = max_indexes[index2];
-            max_indexes[index2] = tmp_index;
-        };
-
-        for (int i2 = 0; i2 < src_k; i2++) {
-            max_values[i2] = src_data[s_index];
-            max_indexes[i2] = i2;
-            s_index += after_num;
-        }
-        for (int i2 = 0; i2 < src_k - 1; i2++) {
-            for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare2<float>()(max_values[i3], max_values[i3 - 1])) {
-                    swap_func(i3, i3 - 1);
-                }
-            }
-        }
-        for (int i2 = src_k; i2 < dim; i2++) {
-            max_values[src_k] = src_data[s_index];
-            max_indexes[src_k] = i2;
-            for (int i3 = src_k; i3 > 0; i3--) {
-                if (Compare2<float>()(max_values[i3], max_values[i3 - 1]))
-                    swap_func(i3, i3 - 1);
-                else
-                    break;
+template <typename T>
+void MKLDNNTopKNode::topk_bitonic(const T* src_data, T* dst_data, int* dst_idx, VectorDims in_dims) {
+    using key_type = typename topk_key<T>::type;
+    const int after_num = count(in_dims, axis + 1, in_dims.size());
+    const size_t seq_num = static_cast<size_t>(before_num) * after_num;
+    const int lanes = topk_lanes;
+    const int sort_size = topk_kernel->jcp_.sort_size;
+    const size_t length = MKLDNNPlugin::div_up(static_cast<size_t>(dim), static_cast<size_t>(sort_size)) * sort_size;
+    const key_type worst = topk_worst_value<key_type>(mode_max);
+    const size_t blocks = MKLDNNPlugin::div_up(seq_num, static_cast<size_t>(lanes));
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<key_type> values(length * lanes);
+        std::vector<int> indices(sort_size * lanes);
+        std::vector<key_type> best_values(sort_size * lanes);
+        std::vector<int> best_indices(sort_size * lanes);
+        std::vector<std::pair<key_type, int>> result(src_k);
+
+        for (size_t b = start; b < end; b++) {
+            // the sequences are packed to the lanes, the lanes beyond the last sequence repeat it
+            for (int l = 0; l < lanes; l++) {
+                const size_t s = std::min(b * lanes + l, seq_num - 1);
+                const T* seq = src_data + (s / after_num) * dim * after_num + s % after_num;
+                for (int j = 0; j < dim; j++)
+                    values[j * lanes + l] = static_cast<key_type>(seq[j * after_num]);
+                for (size_t j = dim; j < length; j++)
+                    values[j * lanes + l] = worst;
             }
-            s_index += after_num;
-        }
-        if (!sort_value) {
-            for (int i2 = 0; i2 < src_k - 1; i2++) {
-                for (int i3 = src_k - 1; i3 > i2; i3--) {
-                    if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
-                        swap_func(i3, i3 - 1);
-                    }
-                }
+
+            jit_topk_call_args args;
+            args.src = values.data();
+            args.src_idx = indices.data();
+            args.dst = best_values.data();
+            args.dst_idx = best_indices.data();
+            args.chunks = length / sort_size;
+            (*topk_kernel)(&args);
+
+            for (int l = 0; l < lanes && b * lanes + l < seq_num; l++) {
+                const size_t s = b * lanes + l;
+                for (int i = 0; i < src_k; i++)
+                    result[i] = std::make_pair(best_values[i * lanes + l], best_indices[i * lanes + l]);
+                topk_store(result, sort_value, dst_data, dst_idx, (s / after_num) * src_k * after_num + s % after_num, after_num);
             }
         }
-        if (dst_data) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_data[i0 * src_k * after_num + i2 * after_num + first_index + i1] = max_values[i2];
-        }
-        if (dst_idx) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_idx[i0 * src_k * after_num + i2 * after_num + first_index + i1] = max_indexes[i2];
-        }
     });
 }
 
-template <template <typename> class Compare>
-void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx, VectorDims in_dims) {
-    parallel_for(before_num, [&](int i0) {
-        std::vector<float> max_values(src_k + 1);
-        std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
-        int tmp_index;
-        int s_index = i0 * dim;
-
-        auto swap_func = [&](int index1, int index2) {
-            tmp_value = max_values[index1];
-            max_values[index1] = max_values[index2];
-            max_values[index2] = tmp_value;
-
-            tmp_index = max_indexes[index1];
-            max_indexes[index1] = max_indexes[index2];
-            max_indexes[index2] = tmp_index;
-        };
-
-        for (int i2 = 0; i2 < src_k; i2++) {
-            max_values[i2] = src_data[s_index];
-            max_indexes[i2] = i2;
-            s_index++;
-        }
-        for (int i2 = 0; i2 < src_k - 1; i2++) {
-            for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1])) {
-                    swap_func(i3, i3 - 1);
-                }
+template <typename T>
+void MKLDNNTopKNode::topk_partition(const T* src_data, T* dst_data, int* dst_idx, VectorDims in_dims) {
+    using key_type = typename topk_key<T>::type;
+    using item_type = std::pair<key_type, int>;
+    const int after_num = count(in_dims, axis + 1, in_dims.size());
+    const size_t seq_num = static_cast<size_t>(before_num) * after_num;
+    const bool max = mode_max;
+    const int k = src_k;
+
+    auto better = [max](const item_type& a, const item_type& b) {
+        if (a.first != b.first)
+            return max ? a.first > b.first : a.first < b.first;
+        return a.second < b.second;
+    };
+    auto sequence = [&](size_t s) {
+        return src_data + (s / after_num) * dim * after_num + s % after_num;
+    };
+    // Selects the best K values of [begin, end) of the sequence. The candidates are collected until the buffer is
+    // full and partitioned then, the K-th best candidate becomes the threshold which rejects the most of the values
+    // by a single comparison. The values equal to the threshold are rejected as their indices are greater.
+    auto select = [&](const T* seq, int begin, int end, std::vector<item_type>& buffer) {
+        const size_t capacity = std::max(2 * k, k + 64);
+        buffer.clear();
+        buffer.reserve(capacity);
+        bool filtered = false;
+        key_type threshold = key_type();
+        for (int j = begin; j < end; j++) {
+            const key_type value = static_cast<key_type>(seq[j * after_num]);
+            if (filtered && !(max ? value > threshold : value < threshold))
+                continue;
+            buffer.emplace_back(value, j);
+            if (buffer.size() == capacity) {
+                std::nth_element(buffer.begin(), buffer.begin() + k - 1, buffer.end(), better);
+                buffer.resize(k);
+                threshold = buffer[k - 1].first;
+                filtered = true;
             }
         }
-        for (int i2 = src_k; i2 < dim; i2++) {
-            max_values[src_k] = src_data[s_index];
-            max_indexes[src_k] = i2;
-            for (int i3 = src_k; i3 > 0; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1]))
-                    swap_func(i3, i3 - 1);
-                else
-                    break;
-            }
-            s_index++;
+        if (buffer.size() > static_cast<size_t>(k)) {
+            std::nth_element(buffer.begin(), buffer.begin() + k - 1, buffer.end(), better);
+            buffer.resize(k);
         }
-        if (!sort_value) {
-            for (int i2 = 0; i2 < src_k - 1; i2++) {
-                for (int i3 = src_k - 1; i3 > i2; i3--) {
-                    if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
-                        swap_func(i3, i3 - 1);
-                    }
-                }
+    };
+    auto store = [&](size_t s, std::vector<item_type>& result) {
+        std::sort(result.begin(), result.end(), better);
+        topk_store(result, sort_value, dst_data, dst_idx, (s / after_num) * k * after_num + s % after_num, after_num);
+    };
+
+    const int threads_num = parallel_get_max_threads();
+    int parts = 1;
+    if (seq_num < static_cast<size_t>(threads_num))
+        parts = std::max(1, std::min(MKLDNNPlugin::div_up(threads_num, static_cast<int>(seq_num)), dim / topk_min_part_size));
+
+    if (parts == 1) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(seq_num, nthr, ithr, start, end);
+            std::vector<item_type> buffer;
+            for (size_t s = start; s < end; s++) {
+                select(sequence(s), 0, dim, buffer);
+                store(s, buffer);
             }
-        }
-        if (dst_data) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_data[i0 * src_k + i2] = max_values[i2];
-        }
-        if (dst_idx) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_idx[i0 * src_k + i2] = max_indexes[i2];
-        }
-    });
+        });
+    } else {
+        // the best values of each part of the axis are merged
+        std::vector<std::vector<item_type>> candidates(seq_num * parts);
+        parallel_for2d(seq_num, parts, [&](size_t s, int p) {
+            int begin = 0, end = 0;
+            splitter(dim, parts, p, begin, end);
+            select(sequence(s), begin, end, candidates[s * parts + p]);
+        });
+        parallel_for(seq_num, [&](size_t s) {
+            std::vector<item_type> merged;
+            for (int p = 0; p < parts; p++)
+                merged.insert(merged.end(), candidates[s * parts + p].begin(), candidates[s * parts + p].end());
+            std::nth_element(merged.begin(), merged.begin() + k - 1, merged.end(), better);
+            merged.resize(k);
+            store(s, merged);
+        });
+    }
 }
 
 inline int MKLDNNTopKNode::count(VectorDims dims, size_t start_ind, size_t end_ind) {
@@ -7,9 +7,42 @@
 #include "ie_common.h"
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <memory>
+#include <string>
 
 namespace MKLDNNPlugin {
 
+struct jit_topk_config_params {
+    bool mode_max;      // the greatest values are selected, the least ones otherwise
+    bool is_int;        // the values are compared as I32, as FP32 otherwise (BF16 data is converted by the node)
+    int top_k;          // K
+    int sort_size;      // size of the bitonic sorting network: K rounded up to the power of two
+};
+
+struct jit_topk_call_args {
+    void *src;          // [chunks * sort_size][lanes] values of the sequences, padded with the worst values
+    int *src_idx;       // [sort_size][lanes] scratch for the indices of a chunk
+    void *dst;          // [sort_size][lanes] the best values, the first K of them are the result
+    int *dst_idx;       // [sort_size][lanes] indices of the best values
+    size_t chunks;
+};
+
+struct jit_uni_topk_kernel {
+    void (*ker_)(const jit_topk_call_args *);
+
+    void operator()(const jit_topk_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_topk_kernel(jit_topk_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_topk_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_topk_config_params jcp_;
+};
+
 class MKLDNNTopKNode : public MKLDNNNode {
 public:
     MKLDNNTopKNode(const std::shared_ptr<ngraph::Node> &op, const mkldnn::engine &eng,
@@ -22,6 +55,7 @@ public:
     bool created() const override;
 
     bool needPrepareParams() const override;
+    void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
@@ -74,11 +108,11 @@ public:
     template<template<typename> class Compare>
     void top1(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
-    template<class Compare1, template<typename> class Compare2>
-    void topk_axis(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+    template<typename T>
+    void topk_bitonic(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
-    template<template<typename> class Compare>
-    void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+    template<typename T>
+    void topk_partition(const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
 private:
     const size_t TOPK_DATA = 0;
@@ -96,11 +130,23 @@ private:
 
     std::string errorPrefix;
 
-#if defined(HAVE_AVX512F)
-    const int count_vec = 32;
-#elif defined(HAVE_SSE) || defined(HAVE_AVX2)
-    const int count_vec = 16;
-#endif
+    InferenceEngine::Precision data_prec = InferenceEngine::Precision::FP32;
+
+    // the sorting networks of the JIT kernel grow as K * log^2(K), the larger K are selected by partitioning
+    static constexpr int topk_bitonic_max_k = 64;
+    static constexpr int topk_bitonic_max_length = 16384;
+    // the axis is split among the threads if there are not enough sequences, each part is not shorter than this
+    static constexpr int topk_min_part_size = 4096;
+
+    // the kernel is compiled in prepareParams for the size of the outputs along the axis
+    int prepared_k = -1;
+    int topk_lanes = 0;
+    std::shared_ptr<jit_uni_topk_kernel> topk_kernel;
+
+    bool useBitonicKernel(size_t seq_num) const;
+
+    template<typename T>
+    void topk_impl(bool bitonic, const T *src_data, T *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
     inline int count(InferenceEngine::SizeVector dims, size_t start_ind, size_t end_ind);
 
@@ -62,6 +62,75 @@ DECLARE_CONFIG_KEY(MULTI_WORK_MODE_AS_AUTO);
  */
 DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
 
+/**
+ * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type.
+ *        The cache is shared between all the streams of an executable network and is used to reuse primitives
+ *        compiled for already seen input shapes. Zero value disables the cache.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief Enables inter-operation parallelism in the CPU plugin: independent nodes of a static graph
+ *        are executed concurrently on the threads of the stream. Accepts YES/NO values, NO by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLELISM);
+
+/**
+ * @brief Defines how the CPU plugin identifies the weights prepared by the nodes in the weights cache shared between
+ *        the streams: by the source operation (YES) or by the hash of the weights content (NO, default).
+ *        The identity keys skip hashing of the weights, which may take noticeable time for the large models.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_IDENTITY_KEYS);
+
+/**
+ * @brief Enables per-stream lock-free task queues with work stealing in the CPU streams executor instead of the single
+ *        queue guarded by a mutex. Accepts YES/NO values, NO by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
+/**
+ * @brief Number of polling iterations an idle stream thread makes before it is parked. Is used only together with
+ *        the work stealing mode, 0 by default (the thread is parked immediately).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_SPIN_COUNT);
+
+/**
+ * @brief Enables tokenization of the eltwise subgraphs by the snippets transformations in the CPU plugin, the subgraphs
+ *        are executed by the kernels generated for them. Accepts YES/NO values, NO by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SNIPPETS);
+
+/**
+ * @brief Enables the graph-wide layout assignment in the CPU plugin: the memory formats of the nodes are selected to
+ *        minimize the estimated cost of the kernels and the reorders over the whole graph instead of node by node.
+ *        Accepts YES/NO values, NO by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_ASSIGNMENT);
+
+/**
+ * @brief Enables the weights decompression in the CPU plugin: the FP16, BF16 and INT8 weights of FullyConnected layers
+ *        stored with the decompression operations (Convert, optional Subtract of the zero points and Multiply by the
+ *        scales) are kept compressed in memory and are decompressed by the kernel instead of being folded to FP32.
+ *        Accepts YES/NO values, NO by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_DECOMPRESSION);
+
+/**
+ * @brief Density threshold of the constant FP32 weights of FullyConnected layers in the CPU plugin: the weights with
+ *        the fraction of the non-zero values below the threshold are packed to the block-CSR format and are executed
+ *        by the sparse kernel. Accepts the floating point values in the range [0, 1], 0 by default (disabled).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_DENSITY_THRESHOLD);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
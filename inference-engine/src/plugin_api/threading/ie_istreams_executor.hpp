@@ -103,6 +103,9 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< Use per-stream lock-free task queues with work stealing
+        int _spinCount = 0;          //!< Number of polling iterations of an idle stream thread before it is parked.
+                                     //!< Is used only in the work stealing mode
 
         /**
          * @brief      A constructor with arguments
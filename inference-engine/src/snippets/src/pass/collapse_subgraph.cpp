@@ -242,8 +242,12 @@ ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node) : Ma
                    (tokenize_by_node || !has_subgraph_as_input(n)) &&
                    has_multiple_output_edges(n);
         })),
-        [](ngraph::pattern::Matcher &m) -> bool {
+        [this](ngraph::pattern::Matcher &m) -> bool {
         auto node = m.get_match_root();
+        // the plugin may keep the node out of snippets, e.g. to fuse it into the preceding operation
+        if (transformation_callback(node)) {
+            return false;
+        }
 
         remark(1) << "Match root"
                   << node->get_friendly_name()
@@ -271,8 +275,11 @@ ngraph::snippets::pass::AttachToSubgraph::AttachToSubgraph(bool tokenize_by_node
 
     continuation_strategy strategy = continuation_strategy::abort;
 
-    ngraph::graph_rewrite_callback continuation_callback = [strategy](ngraph::pattern::Matcher &m) -> bool {
+    ngraph::graph_rewrite_callback continuation_callback = [this, strategy](ngraph::pattern::Matcher &m) -> bool {
         auto node = m.get_match_root();
+        if (transformation_callback(node)) {
+            return false;
+        }
 
         remark(1) << "Match root " << node->get_friendly_name() << " " << node << std::endl;
 
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+namespace internal {
+
+/**
+ * @brief MultiHeadAttention computes softmax(Q * K^T * scale + mask) * V * output_scale.
+ *
+ * Q, K and V are 4D tensors which become [batch, heads, length, head_size] after the transposition by the
+ * corresponding order (canonical[i] = input[order[i]]), so the head split transposes are not executed separately.
+ * The optional mask is numpy-broadcastable to the [batch, heads, query length, key length] scores.
+ * The output is the canonical [batch, heads, query length, head_size] result transposed by the output order.
+ */
+class TRANSFORMATIONS_API MultiHeadAttention : public Op {
+public:
+    OPENVINO_OP("MultiHeadAttention", "util");
+    BWDCMP_RTTI_DECLARATION;
+
+    MultiHeadAttention() = default;
+
+    MultiHeadAttention(const Output<Node>& q,
+                       const Output<Node>& k,
+                       const Output<Node>& v,
+                       float scale,
+                       const std::vector<int64_t>& q_order,
+                       const std::vector<int64_t>& k_order,
+                       const std::vector<int64_t>& v_order,
+                       const std::vector<int64_t>& out_order,
+                       float output_scale = 1.f,
+                       const ngraph::element::Type& output_type = ngraph::element::undefined);
+
+    MultiHeadAttention(const Output<Node>& q,
+                       const Output<Node>& k,
+                       const Output<Node>& v,
+                       const Output<Node>& mask,
+                       float scale,
+                       const std::vector<int64_t>& q_order,
+                       const std::vector<int64_t>& k_order,
+                       const std::vector<int64_t>& v_order,
+                       const std::vector<int64_t>& out_order,
+                       float output_scale = 1.f,
+                       const ngraph::element::Type& output_type = ngraph::element::undefined);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    float get_output_scale() const { return m_output_scale; }
+    const std::vector<int64_t>& get_q_order() const { return m_q_order; }
+    const std::vector<int64_t>& get_k_order() const { return m_k_order; }
+    const std::vector<int64_t>& get_v_order() const { return m_v_order; }
+    const std::vector<int64_t>& get_out_order() const { return m_out_order; }
+    const ngraph::element::Type& get_output_type() const { return m_output_type; }
+
+private:
+    float m_scale = 1.f;
+    std::vector<int64_t> m_q_order;
+    std::vector<int64_t> m_k_order;
+    std::vector<int64_t> m_v_order;
+    std::vector<int64_t> m_out_order;
+    float m_output_scale = 1.f;
+    ngraph::element::Type m_output_type;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ngraph
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API MHAFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MHAFusion transformation replaces the scaled dot product attention subgraph:
+ *
+ *       Q       K
+ *        \     /
+ *         MatMul
+ *           |
+ *    Multiply/Divide (optional scalar scale)
+ *           |
+ *          Add (optional mask)
+ *           |
+ *        Softmax      V
+ *            \       /
+ *             MatMul
+ *               |
+ *           Transpose (optional)
+ *
+ * with a single internal MultiHeadAttention operation.
+ *
+ * The Transpose operations with constant orders on Q, K and V (head split done by the ONNX and TF frontends)
+ * and on the output (heads merge) are folded into the operation orders, the transpose_a/transpose_b MatMul
+ * attributes too. Scalar Multiply/Divide on Q, K and V are folded into the scales and the Convert from i8/u8
+ * in front of them is skipped, so the operation consumes the quantized Q, K and V directly.
+ *
+ * The 3D attention over the [B * H, L, D] inputs is fused too when the heads are merged into the batch by a Reshape
+ * of the [B, H, L, D] tensors, the Reshape is folded into the operation and the output is reshaped back to 3D.
+ *
+ * Restrictions:
+ *   - Q, K and V are 4D or 3D with the Reshape merging the heads, Softmax is performed over the last axis
+ *   - the mask does not broadcast the scores
+ *   - all the fused intermediate operations have a single consumer
+ *
+ * The transformation callback gets the MultiHeadAttention operation to be inserted, so the plugin may reject it,
+ * e.g. by the precisions of its inputs. The transformation is not a part of CommonOptimizations, the plugins
+ * supporting MultiHeadAttention register it.
+ */
+
+class ngraph::pass::MHAFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MHAFusion();
+};
@@ -27,6 +27,9 @@ class TRANSFORMATIONS_API MVNFusionWithConstantsInside;
  * @ingroup ie_transformation_common_api
  * @brief MVNFusion transformation replaces group of
  * operations: (x - ReduceMean(x, axes)) / (Sqrt(ReduceMean((x - ReduceMean(x, axes)) ^ 2)) + eps) to MVN op.
+ * The square may be a Multiply of the difference by itself and the division may be a multiplication by
+ * (ReduceMean(...) + eps) ^ -0.5, the axes of the reductions are compared after normalization of the negative values,
+ * so the LayerNorm decompositions exported from ONNX are also fused.
  */
 class ngraph::pass::MVNFusionWithoutConstants : public ngraph::pass::MatcherPass {
 public:
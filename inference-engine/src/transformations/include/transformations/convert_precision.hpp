@@ -92,3 +92,31 @@ private:
     precisions_array m_precisions;
     type_to_fuse_map m_additional_type_to_fuse_map;
 };
+
+namespace ov {
+
+NGRAPH_API void enable_keep_const_precision(const std::shared_ptr<Node>& node);
+
+NGRAPH_API void disable_keep_const_precision(const std::shared_ptr<Node>& node);
+
+NGRAPH_API bool is_keep_const_precision(const std::shared_ptr<const Node>& node);
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief KeepConstPrecision class represents runtime info attribute that marks Constant which precision is not
+ * changed by ConvertPrecision transformation, e.g. the compressed weights converted by the plugin at runtime.
+ */
+class NGRAPH_API KeepConstPrecision : public VariantImpl<bool> {
+public:
+    OPENVINO_RTTI("keep_const_precision", "0");
+
+    KeepConstPrecision() = default;
+
+    KeepConstPrecision(const value_type& value) : VariantImpl<value_type>(value) {}
+
+    bool is_copyable() const override {
+        return false;
+    }
+};
+
+}  // namespace ov
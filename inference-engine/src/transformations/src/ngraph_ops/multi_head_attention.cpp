@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "ngraph_ops/multi_head_attention.hpp"
+#include "itt.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+BWDCMP_RTTI_DEFINITION(op::internal::MultiHeadAttention);
+
+op::internal::MultiHeadAttention::MultiHeadAttention(const Output<Node>& q,
+                                                     const Output<Node>& k,
+                                                     const Output<Node>& v,
+                                                     float scale,
+                                                     const std::vector<int64_t>& q_order,
+                                                     const std::vector<int64_t>& k_order,
+                                                     const std::vector<int64_t>& v_order,
+                                                     const std::vector<int64_t>& out_order,
+                                                     float output_scale,
+                                                     const ngraph::element::Type& output_type)
+        : Op({q, k, v}), m_scale(scale), m_q_order(q_order), m_k_order(k_order), m_v_order(v_order), m_out_order(out_order),
+          m_output_scale(output_scale), m_output_type(output_type) {
+    constructor_validate_and_infer_types();
+}
+
+op::internal::MultiHeadAttention::MultiHeadAttention(const Output<Node>& q,
+                                                     const Output<Node>& k,
+                                                     const Output<Node>& v,
+                                                     const Output<Node>& mask,
+                                                     float scale,
+                                                     const std::vector<int64_t>& q_order,
+                                                     const std::vector<int64_t>& k_order,
+                                                     const std::vector<int64_t>& v_order,
+                                                     const std::vector<int64_t>& out_order,
+                                                     float output_scale,
+                                                     const ngraph::element::Type& output_type)
+        : Op({q, k, v, mask}), m_scale(scale), m_q_order(q_order), m_k_order(k_order), m_v_order(v_order), m_out_order(out_order),
+          m_output_scale(output_scale), m_output_type(output_type) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> op::internal::MultiHeadAttention::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_clone_with_new_inputs);
+    if (new_args.size() == 3) {
+        return make_shared<MultiHeadAttention>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale,
+                                               m_q_order, m_k_order, m_v_order, m_out_order, m_output_scale, m_output_type);
+    } else if (new_args.size() == 4) {
+        return make_shared<MultiHeadAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale,
+                                               m_q_order, m_k_order, m_v_order, m_out_order, m_output_scale, m_output_type);
+    }
+    throw ngraph::ngraph_error("Unsupported number of inputs: " + std::to_string(new_args.size()));
+}
+
+bool op::internal::MultiHeadAttention::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("q_order", m_q_order);
+    visitor.on_attribute("k_order", m_k_order);
+    visitor.on_attribute("v_order", m_v_order);
+    visitor.on_attribute("out_order", m_out_order);
+    visitor.on_attribute("output_scale", m_output_scale);
+    visitor.on_attribute("output_type", m_output_type);
+    return true;
+}
+
+namespace {
+
+constexpr size_t attention_rank = 4;
+
+bool is_permutation(const std::vector<int64_t>& order) {
+    if (order.size() != attention_rank)
+        return false;
+    std::vector<bool> used(attention_rank, false);
+    for (auto axis : order) {
+        if (axis < 0 || axis >= static_cast<int64_t>(attention_rank) || used[axis])
+            return false;
+        used[axis] = true;
+    }
+    return true;
+}
+
+PartialShape permute(const PartialShape& shape, const std::vector<int64_t>& order) {
+    if (shape.rank().is_dynamic())
+        return PartialShape::dynamic(attention_rank);
+    PartialShape result(std::vector<Dimension>(attention_rank));
+    for (size_t i = 0; i < attention_rank; i++)
+        result[i] = shape[order[i]];
+    return result;
+}
+
+}  // namespace
+
+void op::internal::MultiHeadAttention::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_validate_and_infer_types);
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this, input_size == 3 || input_size == 4,
+                          "Number of inputs is incorrect. Current value is: ", input_size, ", expected: 3 or 4.");
+
+    for (const auto& order : {m_q_order, m_k_order, m_v_order, m_out_order}) {
+        NODE_VALIDATION_CHECK(this, is_permutation(order), "Orders must be permutations of ", attention_rank, " axes.");
+    }
+    for (size_t i = 0; i < 3; i++) {
+        const auto& rank = get_input_partial_shape(i).rank();
+        NODE_VALIDATION_CHECK(this, rank.is_dynamic() || rank.get_length() == attention_rank,
+                              "Q, K and V must be ", attention_rank, "D tensors.");
+    }
+
+    // canonical shapes: [B, H, L, D]
+    const auto q = permute(get_input_partial_shape(0), m_q_order);
+    const auto k = permute(get_input_partial_shape(1), m_k_order);
+    const auto v = permute(get_input_partial_shape(2), m_v_order);
+
+    Dimension batch = q[0], heads = q[1], head_size = q[3], kv_length = k[2];
+    NODE_VALIDATION_CHECK(this,
+                          Dimension::merge(batch, batch, k[0]) && Dimension::merge(batch, batch, v[0]) &&
+                          Dimension::merge(heads, heads, k[1]) && Dimension::merge(heads, heads, v[1]),
+                          "Batch and heads dimensions of Q, K and V are not compatible.");
+    NODE_VALIDATION_CHECK(this, Dimension::merge(head_size, head_size, k[3]),
+                          "Head size of Q and K is not compatible.");
+    NODE_VALIDATION_CHECK(this, Dimension::merge(kv_length, kv_length, v[2]),
+                          "Length of K and V is not compatible.");
+
+    if (input_size == 4) {
+        const auto& mask_rank = get_input_partial_shape(3).rank();
+        NODE_VALIDATION_CHECK(this, mask_rank.is_dynamic() || mask_rank.get_length() <= attention_rank,
+                              "Mask rank must not be greater than ", attention_rank, ".");
+    }
+
+    const PartialShape output{batch, heads, q[2], v[3]};
+    auto output_type = m_output_type;
+    if (output_type == element::undefined)
+        output_type = get_input_element_type(0).is_real() ? get_input_element_type(0) : element::f32;
+    set_output_type(0, output_type, permute(output, m_out_order));
+}
@@ -0,0 +1,300 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/mha_fusion.hpp"
+#include "ngraph_ops/multi_head_attention.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::MHAFusion, "MHAFusion", 0);
+
+namespace {
+
+using Order = std::vector<int64_t>;
+
+const Order identity_order{0, 1, 2, 3};
+const Order transposed_order{0, 1, 3, 2};
+
+bool has_single_consumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool get_scalar(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// Skips the scalar Multiply/Divide feeding the output accumulating the factors into the scale,
+// returns the data input of the first operation which is not a scalar multiplication.
+ngraph::Output<ngraph::Node> skip_scalar_multiply(ngraph::Output<ngraph::Node> output, float& scale, ngraph::NodeVector& fused) {
+    while (has_single_consumer(output)) {
+        const auto node = output.get_node_shared_ptr();
+        const bool is_divide = ngraph::is_type<ngraph::opset1::Divide>(node);
+        if (!is_divide && !ngraph::is_type<ngraph::opset1::Multiply>(node))
+            break;
+
+        float value = 0.f;
+        size_t data_port = 0;
+        if (get_scalar(node->input_value(1), value)) {
+            data_port = 0;
+        } else if (!is_divide && get_scalar(node->input_value(0), value)) {
+            data_port = 1;
+        } else {
+            break;
+        }
+        // the scalar must not change the shape of the data
+        if (node->get_input_partial_shape(data_port) != node->get_output_partial_shape(0))
+            break;
+        if (is_divide) {
+            if (value == 0.f)
+                break;
+            value = 1.f / value;
+        }
+
+        scale *= value;
+        fused.push_back(node);
+        output = node->input_value(data_port);
+    }
+    return output;
+}
+
+// Skips the Transpose operations with constant orders, scalar Multiply/Divide and Convert from i8/u8 feeding
+// the attention input. The transpose orders are composed with the order of the input. Below the Convert only the
+// transposes of the quantized data are skipped, as LPT leaves them after moving the dequantization down.
+ngraph::Output<ngraph::Node> skip_input_operations(ngraph::Output<ngraph::Node> output, Order& order, float& scale,
+                                                   ngraph::NodeVector& fused, bool& quantized) {
+    while (has_single_consumer(output)) {
+        if (!quantized) {
+            output = skip_scalar_multiply(output, scale, fused);
+            if (!has_single_consumer(output))
+                break;
+        }
+
+        const auto node = output.get_node_shared_ptr();
+        if (ngraph::is_type<ngraph::opset1::Transpose>(node)) {
+            auto transpose_order = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+            if (!transpose_order)
+                break;
+            const auto values = transpose_order->cast_vector<int64_t>();
+            if (values.size() != order.size())
+                break;
+
+            // canonical[i] = transposed[order[i]] = input[values[order[i]]]
+            Order composed(order.size());
+            for (size_t i = 0; i < order.size(); i++)
+                composed[i] = values[order[i]];
+            order = composed;
+        } else if (!quantized && ngraph::is_type<ngraph::opset1::Convert>(node)) {
+            const auto& type = node->get_input_element_type(0);
+            if (type != ngraph::element::i8 && type != ngraph::element::u8)
+                break;
+            quantized = true;
+        } else {
+            break;
+        }
+
+        fused.push_back(node);
+        output = node->input_value(0);
+    }
+    return output;
+}
+
+// Returns Q*K^T MatMul producing the attention scores through the optional scalar scale.
+std::shared_ptr<ngraph::opset1::MatMul> get_qk_matmul(const ngraph::Output<ngraph::Node>& scores, float& scale, ngraph::NodeVector& fused) {
+    const auto output = skip_scalar_multiply(scores, scale, fused);
+    auto matmul = ngraph::as_type_ptr<ngraph::opset1::MatMul>(output.get_node_shared_ptr());
+    if (!matmul || !has_single_consumer(output))
+        return nullptr;
+    return matmul;
+}
+
+// The attention is either 4D [B, H, L, D] or 3D [B * H, L, D] with the batch and heads merged
+bool have_same_batch(const ngraph::Output<ngraph::Node>& a, const ngraph::Output<ngraph::Node>& b, size_t rank) {
+    const auto& a_shape = a.get_partial_shape();
+    const auto& b_shape = b.get_partial_shape();
+    if (a_shape.rank().is_dynamic() || b_shape.rank().is_dynamic() || a_shape.size() != rank || b_shape.size() != rank)
+        return false;
+    return a_shape[0] == b_shape[0] && (rank == 3 || a_shape[1] == b_shape[1]);
+}
+
+// Skips the Reshape merging the batch and heads of the [B, H, L, D] tensor into the [B * H, L, D] input of the 3D
+// attention, the way the ONNX and TF models split the heads for the batched MatMul. The order of the 3D input is
+// lifted to the 4D one, the merged axis must stay the outer one.
+bool skip_heads_merge(ngraph::Output<ngraph::Node>& output, Order& order, ngraph::NodeVector& fused) {
+    auto reshape = ngraph::as_type_ptr<ngraph::opset1::Reshape>(output.get_node_shared_ptr());
+    if (!reshape || !has_single_consumer(output) || order.size() != 3 || order[0] != 0)
+        return false;
+    const auto& in_shape = reshape->get_input_partial_shape(0);
+    const auto& out_shape = reshape->get_output_partial_shape(0);
+    if (in_shape.is_dynamic() || out_shape.is_dynamic() || in_shape.size() != 4)
+        return false;
+    const auto in_dims = in_shape.to_shape();
+    const auto out_dims = out_shape.to_shape();
+    if (in_dims[0] * in_dims[1] != out_dims[0] || in_dims[2] != out_dims[1] || in_dims[3] != out_dims[2])
+        return false;
+
+    order = {0, 1, order[1] + 1, order[2] + 1};
+    fused.push_back(reshape);
+    output = reshape->input_value(0);
+    return true;
+}
+
+// Returns the 4D [B, H, L, D] input of the attention skipping the operations folded into the operation.
+bool get_attention_input(ngraph::Output<ngraph::Node>& output, Order& order, float& scale, ngraph::NodeVector& fused) {
+    bool quantized = false;
+    output = skip_input_operations(output, order, scale, fused, quantized);
+    if (order.size() == 3) {
+        if (!skip_heads_merge(output, order, fused))
+            return false;
+        output = skip_input_operations(output, order, scale, fused, quantized);
+    }
+    return true;
+}
+
+}  // namespace
+
+ngraph::pass::MHAFusion::MHAFusion() {
+    MATCHER_SCOPE(MHAFusion);
+    auto softmax_pattern = ngraph::pattern::wrap_type<opset1::Softmax>(pattern::consumers_count(1));
+    auto v_pattern = ngraph::pattern::any_input(pattern::has_static_rank());
+    auto matmul_pattern = ngraph::pattern::wrap_type<opset1::MatMul>({softmax_pattern, v_pattern});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto matmul_sv = as_type_ptr<opset1::MatMul>(pattern_map.at(matmul_pattern).get_node_shared_ptr());
+        auto softmax = as_type_ptr<opset1::Softmax>(pattern_map.at(softmax_pattern).get_node_shared_ptr());
+        if (!matmul_sv || !softmax)
+            return false;
+
+        const auto& scores_shape = softmax->get_output_partial_shape(0);
+        if (matmul_sv->get_transpose_a() || scores_shape.rank().is_dynamic())
+            return false;
+        const size_t rank = scores_shape.size();
+        if ((rank != 3 && rank != 4) || softmax->get_axis() != rank - 1)
+            return false;
+        if (!have_same_batch(softmax->output(0), matmul_sv->input_value(1), rank))
+            return false;
+
+        NodeVector fused{matmul_sv, softmax};
+        float scale = 1.f;
+        Output<Node> mask;
+        bool has_mask = false;
+        std::shared_ptr<opset1::MatMul> matmul_qk;
+        auto scores = softmax->input_value(0);
+        if (auto add = as_type_ptr<opset1::Add>(scores.get_node_shared_ptr())) {
+            if (!has_single_consumer(scores))
+                return false;
+            for (size_t port = 0; port < 2 && !matmul_qk; port++) {
+                NodeVector fused_scale;
+                float port_scale = 1.f;
+                matmul_qk = get_qk_matmul(add->input_value(port), port_scale, fused_scale);
+                if (!matmul_qk)
+                    continue;
+                // the mask must not broadcast the scores
+                mask = add->input_value(1 - port);
+                if (add->get_input_partial_shape(port) != scores_shape || mask.get_partial_shape().rank().is_dynamic() ||
+                    mask.get_partial_shape().size() > rank || mask.get_element_type() != scores.get_element_type())
+                    return false;
+                scale = port_scale;
+                fused.push_back(add);
+                fused.insert(fused.end(), fused_scale.begin(), fused_scale.end());
+                has_mask = true;
+            }
+        } else {
+            matmul_qk = get_qk_matmul(scores, scale, fused);
+        }
+        if (!matmul_qk || !have_same_batch(matmul_qk->input_value(0), matmul_qk->input_value(1), rank))
+            return false;
+        fused.push_back(matmul_qk);
+
+        // the MatMul transposes are the first ones applied to the canonical [B, H, L, D] inputs
+        const Order& identity = rank == 3 ? Order{0, 1, 2} : identity_order;
+        const Order& transposed = rank == 3 ? Order{0, 2, 1} : transposed_order;
+        Order q_order = matmul_qk->get_transpose_a() ? transposed : identity;
+        Order k_order = matmul_qk->get_transpose_b() ? identity : transposed;
+        Order v_order = matmul_sv->get_transpose_b() ? transposed : identity;
+        float output_scale = 1.f;
+        auto q = matmul_qk->input_value(0);
+        auto k = matmul_qk->input_value(1);
+        auto v = matmul_sv->input_value(1);
+        if (!get_attention_input(q, q_order, scale, fused) || !get_attention_input(k, k_order, scale, fused) ||
+            !get_attention_input(v, v_order, output_scale, fused))
+            return false;
+
+        NodeVector new_ops;
+        Order out_order = identity_order;
+        std::shared_ptr<Node> last = matmul_sv;
+        if (rank == 3) {
+            // the heads of the 3D attention are merged back by the Reshape of the output
+            const auto q_shape = q.get_partial_shape();
+            if (q_shape.is_dynamic() || matmul_sv->get_output_partial_shape(0).is_dynamic() ||
+                !have_same_batch(q, k, 4) || !have_same_batch(q, v, 4))
+                return false;
+            // the mask merging the batch and heads is split as the scores are
+            const auto& mask_shape = mask.get_partial_shape();
+            if (has_mask && mask_shape.size() == 3 && !(mask_shape[0].is_static() && mask_shape[0].get_length() == 1)) {
+                if (mask_shape.is_dynamic())
+                    return false;
+                const auto mask_dims = mask_shape.to_shape();
+                const auto dims = q_shape.to_shape();
+                if (mask_dims[0] != dims[0] * dims[1])
+                    return false;
+                auto shape = opset1::Constant::create(element::i64, Shape{4}, {dims[0], dims[1], mask_dims[1], mask_dims[2]});
+                mask = std::make_shared<opset1::Reshape>(mask, shape, false);
+                new_ops.push_back(mask.get_node_shared_ptr());
+            }
+        } else {
+            // heads merge
+            const auto consumers = matmul_sv->get_output_target_inputs(0);
+            if (consumers.size() == 1) {
+                const auto consumer = consumers.begin()->get_node()->shared_from_this();
+                if (is_type<opset1::Transpose>(consumer)) {
+                    auto transpose_order = as_type_ptr<opset1::Constant>(consumer->get_input_node_shared_ptr(1));
+                    if (transpose_order && transpose_order->get_shape() == Shape{4}) {
+                        out_order = transpose_order->cast_vector<int64_t>();
+                        last = consumer;
+                        fused.push_back(consumer);
+                    }
+                }
+            }
+        }
+
+        std::shared_ptr<Node> mha;
+        if (has_mask) {
+            mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, mask, scale, q_order, k_order, v_order, out_order,
+                                                                     output_scale);
+        } else {
+            mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, scale, q_order, k_order, v_order, out_order,
+                                                                     output_scale);
+        }
+        // the plugins check the operation as it is created, e.g. the precisions of the inputs it gets
+        if (transformation_callback(mha))
+            return false;
+        new_ops.push_back(mha);
+
+        std::shared_ptr<Node> result = mha;
+        if (rank == 3) {
+            const auto out_shape = matmul_sv->get_output_shape(0);
+            auto shape = opset1::Constant::create(element::i64, Shape{out_shape.size()}, out_shape);
+            result = std::make_shared<opset1::Reshape>(mha, shape, false);
+            new_ops.push_back(result);
+        }
+        result->set_friendly_name(last->get_friendly_name());
+        copy_runtime_info(fused, new_ops);
+        replace_node(last, result);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_pattern, matcher_name);
+    this->register_matcher(m, callback);
+}
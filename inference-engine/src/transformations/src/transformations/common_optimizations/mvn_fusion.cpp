@@ -6,6 +6,7 @@
 #include "transformations/common_optimizations/mvn_fusion.hpp"
 #include "transformations/utils/utils.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,34 @@ std::function<bool(ngraph::Output<ngraph::Node>)> value_is_equal_to(const std::v
     };
 }
 
+namespace {
+
+// Returns the sorted reduction axes with the negative values normalized by the rank of the reduced tensor,
+// so that e.g. [-1] and [2] are considered the same axes of a 3D tensor
+std::vector<int64_t> get_reduction_axes(const std::shared_ptr<ngraph::opset6::Constant>& axes_node, const ngraph::Rank& rank) {
+    auto axes = axes_node->cast_vector<int64_t>();
+    if (rank.is_static()) {
+        for (auto& axis : axes) {
+            if (axis < 0)
+                axis += rank.get_length();
+        }
+    }
+    std::sort(axes.begin(), axes.end());
+    return axes;
+}
+
+// The mean is broadcasted back to the reduced tensor, so it must either keep the reduced dimensions
+// or consist of a single value
+bool is_broadcastable_mean(const ngraph::Output<ngraph::Node>& output) {
+    auto reduce = std::dynamic_pointer_cast<ngraph::opset6::ReduceMean>(output.get_node_shared_ptr());
+    if (!reduce)
+        return false;
+    const auto& shape = output.get_partial_shape();
+    return reduce->get_keep_dims() || (shape.is_static() && ngraph::shape_size(shape.to_shape()) == 1);
+}
+
+}  // namespace
+
 NGRAPH_RTTI_DEFINITION(ngraph::pass::MVNFusionWithoutConstants, "MVNFusionWithoutConstants", 0);
 
 ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
@@ -62,11 +91,14 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
     //                 `---------------------power--'
     auto const_2 = pattern::wrap_type<opset6::Constant>(value_is_equal_to<float>({ 2.0 }));
     auto power = pattern::wrap_type<opset6::Power>({ hasConvertOrNot, const_2 });
+    // the square may be also expressed as (x - ReduceMean(x, axes)) * (x - ReduceMean(x, axes))
+    auto square = pattern::wrap_type<opset6::Multiply>({ hasConvertOrNot, hasConvertOrNot });
+    const auto powerOrSquare = std::make_shared<pattern::op::Or>(OutputVector{ power, square });
 
     // Sqrt(ReduceMean((x - ReduceMean(x, axes)) ^ 2))
     //     `---mean3--------------------------------'
     auto mean3_axes = pattern::wrap_type<opset6::Constant>();
-    auto mean3 = pattern::wrap_type<opset6::ReduceMean>({ power, mean3_axes });
+    auto mean3 = pattern::wrap_type<opset6::ReduceMean>({ powerOrSquare, mean3_axes });
 
     auto const_0_5 = pattern::wrap_type<ngraph::opset6::Constant>(value_is_equal_to<float>({0.5}));
     auto eps = pattern::wrap_type<opset6::Constant>();
@@ -102,7 +134,13 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
     auto div = pattern::wrap_type<opset6::Multiply>({ sub1, power_div });
 
     auto div_alt = pattern::wrap_type<opset6::Divide>({ sub1, outsideOrInside });
-    const auto powerMulOrDiv = std::make_shared<pattern::op::Or>(OutputVector{ div, div_alt });
+
+    // (x - ReduceMean(x, axes)) * (ReduceMean((x - ReduceMean(x, axes)) ^ 2) + eps) ^ -0.5
+    //                             `-----------------------------------------------rsqrt--'
+    auto const_neg_0_5 = pattern::wrap_type<opset6::Constant>(value_is_equal_to<float>({ -0.5 }));
+    auto rsqrt_is = pattern::wrap_type<opset6::Power>({ add_eps_is, const_neg_0_5 });
+    auto mul_rsqrt = pattern::wrap_type<opset6::Multiply>({ sub1, rsqrt_is });
+    const auto powerMulOrDiv = std::make_shared<pattern::op::Or>(OutputVector{ div, div_alt, mul_rsqrt });
 
     ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher& m) {
         auto& pattern_to_output = m.get_pattern_value_map();
@@ -121,18 +159,23 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
             return false;
         }
 
-        auto axes_1_value = axes_1_node->cast_vector<int64_t>();
-        auto axes_3_value = axes_3_node->cast_vector<int64_t>();
+        if (!is_broadcastable_mean(pattern_to_output.at(mean1)) || !is_broadcastable_mean(pattern_to_output.at(mean3))) {
+            return false;
+        }
+
+        const auto rank = exp_input.get_partial_shape().rank();
+        auto axes_1_value = get_reduction_axes(axes_1_node, rank);
+        auto axes_3_value = get_reduction_axes(axes_3_node, rank);
 
         if (axes_1_value != axes_3_value) {
             return false;
         }
         if (pattern_to_output.count(mean2_axes)) {
             auto axes_2_node = std::dynamic_pointer_cast<ngraph::opset6::Constant>(pattern_to_output.at(mean2_axes).get_node_shared_ptr());
-            if (!axes_2_node) {
+            if (!axes_2_node || !is_broadcastable_mean(pattern_to_output.at(mean2))) {
                 return false;
             }
-            auto axes_2_value = axes_2_node->cast_vector<int64_t>();
+            auto axes_2_value = get_reduction_axes(axes_2_node, rank);
             if (axes_1_value != axes_2_value) {
                 return false;
             }
@@ -140,9 +183,19 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
 
         ngraph::NodeVector nodes_to_copy_info({ pattern_to_output.at(mean1).get_node_shared_ptr(),
                                                 pattern_to_output.at(sub1).get_node_shared_ptr(),
-                                                pattern_to_output.at(power).get_node_shared_ptr(),
                                                 pattern_to_output.at(mean3).get_node_shared_ptr() });
 
+        if (pattern_to_output.count(square)) {
+            // both inputs of the Multiply are the same difference
+            auto square_node = pattern_to_output.at(square).get_node_shared_ptr();
+            if (square_node->input_value(0) != square_node->input_value(1)) {
+                return false;
+            }
+            nodes_to_copy_info.push_back(square_node);
+        } else {
+            nodes_to_copy_info.push_back(pattern_to_output.at(power).get_node_shared_ptr());
+        }
+
         op::MVNEpsMode mode;
         if (pattern_to_output.count(add_eps_os)) {
             mode = op::MVNEpsMode::OUTSIDE_SQRT;
@@ -160,6 +213,11 @@ ngraph::pass::MVNFusionWithoutConstants::MVNFusionWithoutConstants() {
             } else if (pattern_to_output.count(sqrt_is)) {
                 nodes_to_copy_info.push_back(pattern_to_output.at(sqrt_is).get_node_shared_ptr());
             }
+        } else if (pattern_to_output.count(rsqrt_is)) {
+            mode = op::MVNEpsMode::INSIDE_SQRT;
+            nodes_to_copy_info.push_back(pattern_to_output.at(add_eps_is).get_node_shared_ptr());
+            nodes_to_copy_info.push_back(pattern_to_output.at(rsqrt_is).get_node_shared_ptr());
+            nodes_to_copy_info.push_back(pattern_to_output.at(mul_rsqrt).get_node_shared_ptr());
         } else {
             return false;
         }
@@ -271,8 +329,9 @@ ngraph::pass::MVNFusionWithConstantsInside::MVNFusionWithConstantsInside() {
             return false;
         }
 
-        auto axes_1_value = axes_1_node->cast_vector<int64_t>();
-        auto axes_2_value = axes_2_node->cast_vector<int64_t>();
+        const auto rank = x_output.get_partial_shape().rank();
+        auto axes_1_value = get_reduction_axes(axes_1_node, rank);
+        auto axes_2_value = get_reduction_axes(axes_2_node, rank);
         if (axes_1_value != axes_2_value) {
             return false;
         }
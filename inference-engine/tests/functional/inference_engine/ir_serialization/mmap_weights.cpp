@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <common_test_utils/file_utils.hpp>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "transformations/serialize.hpp"
+#include <openvino/opsets/opset8.hpp>
+#include "manager.hpp"
+
+// The IR frontend maps the weights file to the memory, Constants reference the mapping through SharedBuffer
+class MmapWeightsTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    const std::vector<float> m_weights_f32 = {1.5f, -2.f, 3.25f, 0.f, 7.f, -0.5f};
+    const std::vector<int64_t> m_weights_i64 = {1, 3, 2};
+
+    void SetUp() override {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3, 2});
+        auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 3, 2}, m_weights_f32);
+        auto add = std::make_shared<ov::opset8::Add>(data, weights);
+        auto order = ov::opset8::Constant::create(ov::element::i64, ov::Shape{3}, m_weights_i64);
+        auto transpose = std::make_shared<ov::opset8::Transpose>(add, order);
+        auto function = std::make_shared<ngraph::Function>(ngraph::OutputVector{transpose}, ngraph::ParameterVector{data});
+
+        ngraph::pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_function(function);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(m_out_xml_path, m_out_bin_path);
+    }
+
+    std::shared_ptr<ngraph::Function> getWithIRFrontend(const ov::VariantVector& params) {
+        ov::frontend::FrontEnd::Ptr FE;
+        ov::frontend::InputModel::Ptr inputModel;
+
+        FE = manager.load_by_model(params);
+        if (FE)
+            inputModel = FE->load(params);
+
+        if (inputModel)
+            return FE->convert(inputModel);
+
+        return nullptr;
+    }
+
+    std::string readFile(const std::string& path) {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream << content;
+    }
+
+    static std::vector<std::shared_ptr<ov::opset8::Constant>> getConstants(const std::shared_ptr<ngraph::Function>& function) {
+        std::vector<std::shared_ptr<ov::opset8::Constant>> constants;
+        for (const auto& op : function->get_ordered_ops()) {
+            if (auto constant = ov::as_type_ptr<ov::opset8::Constant>(op))
+                constants.push_back(constant);
+        }
+        return constants;
+    }
+
+    void checkConstants(const std::vector<std::shared_ptr<ov::opset8::Constant>>& constants) {
+        ASSERT_EQ(constants.size(), 2);
+        for (const auto& constant : constants) {
+            if (constant->get_element_type() == ov::element::f32)
+                ASSERT_EQ(constant->cast_vector<float>(), m_weights_f32);
+            else
+                ASSERT_EQ(constant->cast_vector<int64_t>(), m_weights_i64);
+        }
+    }
+
+private:
+    ov::frontend::FrontEndManager manager;
+};
+
+TEST_F(MmapWeightsTest, same_constants_as_read_weights) {
+    auto mapped = getWithIRFrontend({ov::make_variant(m_out_xml_path), ov::make_variant(m_out_bin_path)});
+    ASSERT_NE(mapped, nullptr);
+    checkConstants(getConstants(mapped));
+
+    // the weights read from the file to the memory, as the frontend does if the file cannot be mapped
+    const auto bin = readFile(m_out_bin_path);
+    auto weights = std::make_shared<ngraph::runtime::AlignedBuffer>(bin.size());
+    std::memcpy(weights->get_ptr(), bin.data(), bin.size());
+    std::istringstream model(readFile(m_out_xml_path));
+    auto read = getWithIRFrontend({ov::make_variant(&model), ov::make_variant(weights)});
+    ASSERT_NE(read, nullptr);
+
+    const auto mappedConstants = getConstants(mapped);
+    const auto readConstants = getConstants(read);
+    ASSERT_EQ(mappedConstants.size(), readConstants.size());
+    for (size_t i = 0; i < mappedConstants.size(); i++) {
+        ASSERT_EQ(mappedConstants[i]->get_byte_size(), readConstants[i]->get_byte_size());
+        ASSERT_EQ(std::memcmp(mappedConstants[i]->get_data_ptr(), readConstants[i]->get_data_ptr(),
+                              mappedConstants[i]->get_byte_size()), 0);
+    }
+
+    const auto res = compare_functions(mapped, read, true, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST_F(MmapWeightsTest, truncated_weights_file) {
+    // the last constant is out of the mapped file
+    const auto bin = readFile(m_out_bin_path);
+    writeFile(m_out_bin_path, bin.substr(0, bin.size() - 1));
+
+    ASSERT_ANY_THROW(getWithIRFrontend({ov::make_variant(m_out_xml_path), ov::make_variant(m_out_bin_path)}));
+}
+
+TEST_F(MmapWeightsTest, offset_out_of_weights_file) {
+    const auto bin = readFile(m_out_bin_path);
+    auto xml = readFile(m_out_xml_path);
+    const std::string attr = "offset=\"0\"";
+    const auto pos = xml.find(attr);
+    ASSERT_NE(pos, std::string::npos);
+    xml.replace(pos, attr.size(), "offset=\"" + std::to_string(bin.size()) + "\"");
+    writeFile(m_out_xml_path, xml);
+
+    ASSERT_ANY_THROW(getWithIRFrontend({ov::make_variant(m_out_xml_path), ov::make_variant(m_out_bin_path)}));
+}
+
+TEST_F(MmapWeightsTest, empty_weights_file) {
+    // an empty file cannot be mapped, it is read and the constants are out of it
+    writeFile(m_out_bin_path, "");
+
+    ASSERT_ANY_THROW(getWithIRFrontend({ov::make_variant(m_out_xml_path), ov::make_variant(m_out_bin_path)}));
+}
+
+TEST_F(MmapWeightsTest, constants_outlive_frontend) {
+    std::vector<std::shared_ptr<ov::opset8::Constant>> constants;
+    {
+        auto function = getWithIRFrontend({ov::make_variant(m_out_xml_path), ov::make_variant(m_out_bin_path)});
+        ASSERT_NE(function, nullptr);
+        constants = getConstants(function);
+    }
+#ifndef _WIN32
+    // the mapping keeps the content of the removed file
+    CommonTestUtils::removeIRFiles(m_out_xml_path, m_out_bin_path);
+#endif
+
+    // the frontend, the input model and the function are destroyed, the constants hold the mapping
+    checkConstants(constants);
+}
@@ -2,13 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
+#include <iomanip>
+#include <iostream>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_system_conf.h>
 
 using namespace ::testing;
@@ -198,6 +202,78 @@ TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     }
 }
 
+TEST_F(StreamsExecutorConfigTest, workStealingConfig) {
+    IStreamsExecutor::Config config;
+    ASSERT_EQ(CONFIG_VALUE(NO), config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)).as<std::string>());
+    ASSERT_NO_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), CONFIG_VALUE(YES)));
+    ASSERT_NO_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_COUNT), "1000"));
+    ASSERT_TRUE(config._workStealing);
+    ASSERT_EQ(1000, config._spinCount);
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), "ON"), Exception);
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_COUNT), "-1"), Exception);
+}
+
+// Micro-benchmark of the streams executor task queues: reports the average enqueue-to-start latency
+// and the throughput of empty tasks submitted from several threads versus the number of streams.
+// Is disabled by default, run with --gtest_also_run_disabled_tests
+TEST_F(StreamsExecutorConfigTest, DISABLED_queueLatencyAndThroughputBenchmark) {
+    using Clock = std::chrono::steady_clock;
+    constexpr int latencySamples = 10000;
+    constexpr int throughputTasks = 200000;
+    constexpr int producersNum = 4;
+
+    struct Mode {
+        const char* name;
+        bool workStealing;
+        int spinCount;
+    };
+    const Mode modes[] = {{"single queue", false, 0}, {"work stealing", true, 0}, {"work stealing + spin", true, 1000}};
+
+    std::cout << std::left << std::setw(24) << "mode" << std::setw(10) << "streams"
+              << std::setw(16) << "latency, us" << "throughput, tasks/s" << std::endl;
+    const int maxStreams = getNumberOfLogicalCPUCores();
+    for (const auto& mode : modes) {
+        for (int streams = 1; streams <= maxStreams; streams *= 2) {
+            IStreamsExecutor::Config config{"BenchmarkCPUStreamsExecutor", streams, 1};
+            config._workStealing = mode.workStealing;
+            config._spinCount = mode.spinCount;
+            auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+            // enqueue-to-start latency of the tasks submitted one by one
+            double latencySum = 0;
+            for (int i = 0; i < latencySamples; i++) {
+                std::promise<Clock::time_point> started;
+                auto future = started.get_future();
+                const auto enqueued = Clock::now();
+                executor->run([&started] { started.set_value(Clock::now()); });
+                latencySum += std::chrono::duration<double, std::micro>(future.get() - enqueued).count();
+            }
+
+            // throughput of the tasks submitted concurrently
+            std::atomic_int executed = {0};
+            std::promise<void> allDone;
+            const auto start = Clock::now();
+            std::vector<std::thread> producers;
+            for (int p = 0; p < producersNum; p++) {
+                producers.emplace_back([&] {
+                    for (int i = 0; i < throughputTasks / producersNum; i++) {
+                        executor->run([&] {
+                            if (++executed == throughputTasks)
+                                allDone.set_value();
+                        });
+                    }
+                });
+            }
+            for (auto&& producer : producers) producer.join();
+            allDone.get_future().wait();
+            const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            std::cout << std::left << std::setw(24) << mode.name << std::setw(10) << streams
+                      << std::setw(16) << latencySum / latencySamples << throughputTasks / seconds << std::endl;
+        }
+    }
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -217,6 +293,23 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        config._spinCount = 100;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -242,6 +335,23 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        config._spinCount = 100;
+        return std::make_shared<CPUStreamsExecutor>(config);
     }
 );
 
@@ -220,6 +220,31 @@ TEST(TransformationTests, ConvertPrecision_Convert) {
     ASSERT_FALSE(has_type<ngraph::element::Type_t::i64>(f));
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 4});
+        auto weights = opset4::Constant::create(element::f16, Shape{4, 4}, std::vector<float>(16, 0.5f));
+        ov::enable_keep_const_precision(weights);
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto matmul = std::make_shared<opset4::MatMul>(input, convert);
+
+        f = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }});
+        manager.run_passes(f);
+    }
+
+    // the Constant and the Convert decompressing it are kept as is
+    ASSERT_EQ(count_ops_of_type<opset4::Convert>(f), 1);
+    for (const auto& node : f->get_ops()) {
+        if (ov::is_type<opset4::Constant>(node)) {
+            ASSERT_EQ(node->get_output_element_type(0), element::f16);
+        }
+    }
+}
+
 TEST(TransformationTests, ConvertPrecision_ConvertElimination) {
     std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
     {
@@ -0,0 +1,257 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_ops/multi_head_attention.hpp>
+#include <transformations/common_optimizations/mha_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+
+std::shared_ptr<Node> split_heads(const Output<Node>& input, const std::vector<int64_t>& order) {
+    auto shape = opset1::Constant::create(element::i64, Shape{4}, {0, 0, 4, 16});
+    auto reshape = std::make_shared<opset1::Reshape>(input, shape, true);
+    auto transpose_order = opset1::Constant::create(element::i64, Shape{4}, order);
+    return std::make_shared<opset1::Transpose>(reshape, transpose_order);
+}
+
+}  // namespace
+
+TEST(TransformationTests, MHAFusionHeadSplit) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    const Shape input_shape{2, 10, 64};
+    const Shape mask_shape{2, 1, 1, 10};
+    {
+        auto q_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto k_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, mask_shape);
+
+        auto q = split_heads(q_input, {0, 2, 1, 3});
+        auto k = split_heads(k_input, {0, 2, 3, 1});
+        auto v = split_heads(v_input, {0, 2, 1, 3});
+        auto qk = std::make_shared<opset1::MatMul>(q, k);
+        auto scale = opset1::Constant::create(element::f32, Shape{}, {4.f});
+        auto scaled = std::make_shared<opset1::Divide>(qk, scale);
+        auto masked = std::make_shared<opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<opset1::Softmax>(masked, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        auto out_order = opset1::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3});
+        auto transpose = std::make_shared<opset1::Transpose>(sv, out_order);
+        f = std::make_shared<Function>(NodeVector{transpose}, ParameterVector{q_input, k_input, v_input, mask});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto q_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto k_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, mask_shape);
+
+        auto shape = opset1::Constant::create(element::i64, Shape{4}, {0, 0, 4, 16});
+        auto q = std::make_shared<opset1::Reshape>(q_input, shape, true);
+        auto k = std::make_shared<opset1::Reshape>(k_input, shape, true);
+        auto v = std::make_shared<opset1::Reshape>(v_input, shape, true);
+        const std::vector<int64_t> order{0, 2, 1, 3};
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, mask, 0.25f, order, order, order, order);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q_input, k_input, v_input, mask});
+    }
+
+    auto fc = FunctionsComparator::with_default().enable(FunctionsComparator::ATTRIBUTES).enable(FunctionsComparator::CONST_VALUES);
+    auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(TransformationTests, MHAFusionMergedHeads) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    const Shape input_shape{2, 10, 64};
+    const Shape mask_shape{8, 1, 10};
+    {
+        auto q_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto k_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, mask_shape);
+
+        // the heads are merged into the batch of the 3D MatMuls
+        auto merged_shape = opset1::Constant::create(element::i64, Shape{3}, {8, 10, 16});
+        auto q = std::make_shared<opset1::Reshape>(split_heads(q_input, {0, 2, 1, 3}), merged_shape, false);
+        auto k = std::make_shared<opset1::Reshape>(split_heads(k_input, {0, 2, 1, 3}), merged_shape, false);
+        auto v = std::make_shared<opset1::Reshape>(split_heads(v_input, {0, 2, 1, 3}), merged_shape, false);
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto scale = opset1::Constant::create(element::f32, Shape{}, {4.f});
+        auto scaled = std::make_shared<opset1::Divide>(qk, scale);
+        auto masked = std::make_shared<opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<opset1::Softmax>(masked, 2);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q_input, k_input, v_input, mask});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto q_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto k_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::f32, input_shape);
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, mask_shape);
+
+        auto shape = opset1::Constant::create(element::i64, Shape{4}, {0, 0, 4, 16});
+        auto q = std::make_shared<opset1::Reshape>(q_input, shape, true);
+        auto k = std::make_shared<opset1::Reshape>(k_input, shape, true);
+        auto v = std::make_shared<opset1::Reshape>(v_input, shape, true);
+        auto mask_split = std::make_shared<opset1::Reshape>(mask, opset1::Constant::create(element::i64, Shape{4}, {2, 4, 1, 10}), false);
+        const std::vector<int64_t> order{0, 2, 1, 3};
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, mask_split, 0.25f, order, order, order,
+                                                                      std::vector<int64_t>{0, 1, 2, 3});
+        auto merged = std::make_shared<opset1::Reshape>(mha, opset1::Constant::create(element::i64, Shape{3}, {8, 10, 16}), false);
+        f_ref = std::make_shared<Function>(NodeVector{merged}, ParameterVector{q_input, k_input, v_input, mask});
+    }
+
+    auto fc = FunctionsComparator::with_default().enable(FunctionsComparator::ATTRIBUTES).enable(FunctionsComparator::CONST_VALUES);
+    auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(TransformationTests, MHAFusionRejectedByCallback) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        // the callback gets the operation to be inserted
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MHAFusion>();
+        m.get_pass_config()->set_callback<pass::MHAFusion>([](const std::shared_ptr<const Node>& node) -> bool {
+            return is_type<const op::internal::MultiHeadAttention>(node);
+        });
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    auto res = FunctionsComparator::with_default().compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(TransformationTests, MHAFusionDequantizedInputs) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    const Shape shape{1, 2, 8, 16};
+    {
+        auto q_input = std::make_shared<opset1::Parameter>(element::i8, shape);
+        auto k_input = std::make_shared<opset1::Parameter>(element::i8, shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::u8, shape);
+
+        auto dequantize = [](const Output<Node>& input, float scale) {
+            auto convert = std::make_shared<opset1::Convert>(input, element::f32);
+            return std::make_shared<opset1::Multiply>(convert, opset1::Constant::create(element::f32, Shape{1, 1, 1, 1}, {scale}));
+        };
+        auto qk = std::make_shared<opset1::MatMul>(dequantize(q_input, 0.5f), dequantize(k_input, 0.25f), false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, dequantize(v_input, 0.125f));
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q_input, k_input, v_input});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto q_input = std::make_shared<opset1::Parameter>(element::i8, shape);
+        auto k_input = std::make_shared<opset1::Parameter>(element::i8, shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::u8, shape);
+        const std::vector<int64_t> order{0, 1, 2, 3};
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q_input, k_input, v_input, 0.125f, order, order, order, order, 0.125f);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q_input, k_input, v_input});
+    }
+
+    auto fc = FunctionsComparator::with_default().enable(FunctionsComparator::ATTRIBUTES);
+    auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(TransformationTests, MHAFusionDequantizedTransposedInput) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    const Shape shape{1, 2, 8, 16};
+    const Shape v_shape{1, 8, 2, 16};
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::u8, v_shape);
+
+        // LPT moves the dequantization below the transpose of the quantized data
+        auto v_order = opset1::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3});
+        auto v_transpose = std::make_shared<opset1::Transpose>(v_input, v_order);
+        auto convert = std::make_shared<opset1::Convert>(v_transpose, element::f32);
+        auto v = std::make_shared<opset1::Multiply>(convert, opset1::Constant::create(element::f32, Shape{}, {0.125f}));
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v_input});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, shape);
+        auto v_input = std::make_shared<opset1::Parameter>(element::u8, v_shape);
+        const std::vector<int64_t> order{0, 1, 2, 3};
+        const std::vector<int64_t> v_order{0, 2, 1, 3};
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v_input, 1.f, order, order, v_order, order, 0.125f);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q, k, v_input});
+    }
+
+    auto fc = FunctionsComparator::with_default().enable(FunctionsComparator::ATTRIBUTES);
+    auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(TransformationTests, MHAFusionNegativeBroadcastedBatch) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 1, 8, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    auto res = FunctionsComparator::with_default().compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
@@ -377,3 +377,89 @@ TEST_F(TransformationTestsF, MVNFusionTestWithParametersInside) {
         function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input });
     }
 }
+
+TEST_F(TransformationTestsF, MVNFusionTestLayerNorm) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 64 });
+        auto mean1_axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { -1 });
+        auto mean1 = std::make_shared<ngraph::opset6::ReduceMean>(input, mean1_axes, true);
+        auto sub1 = std::make_shared<ngraph::opset6::Subtract>(input, mean1);
+        auto square = std::make_shared<ngraph::opset6::Multiply>(sub1, sub1);
+        auto mean3_axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 2 });
+        auto mean3 = std::make_shared<ngraph::opset6::ReduceMean>(square, mean3_axes, true);
+        auto eps = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 1e-12 });
+        auto add_eps = std::make_shared<ngraph::opset6::Add>(mean3, eps);
+        auto sqrt = std::make_shared<ngraph::opset6::Sqrt>(add_eps);
+        auto div = std::make_shared<ngraph::opset6::Divide>(sub1, sqrt);
+        auto gamma = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 64 }, { 0.5 });
+        auto mul_gamma = std::make_shared<ngraph::opset6::Multiply>(div, gamma);
+        auto beta = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 64 }, { 0.1 });
+        auto add_beta = std::make_shared<ngraph::opset6::Add>(mul_gamma, beta);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add_beta }, ngraph::ParameterVector{ input });
+
+        manager.register_pass<ngraph::pass::MVNFusion>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 64 });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { -1 });
+        auto mvn = std::make_shared<ngraph::opset6::MVN>(input, axes, true, 1e-12, ngraph::op::MVNEpsMode::INSIDE_SQRT);
+        auto gamma = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 64 }, { 0.5 });
+        auto mul_gamma = std::make_shared<ngraph::opset6::Multiply>(mvn, gamma);
+        auto beta = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 64 }, { 0.1 });
+        auto add_beta = std::make_shared<ngraph::opset6::Add>(mul_gamma, beta);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add_beta }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, MVNFusionTestRsqrtInsideSqrt) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 64 });
+        auto mean1_axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 2 });
+        auto mean1 = std::make_shared<ngraph::opset6::ReduceMean>(input, mean1_axes, true);
+        auto sub1 = std::make_shared<ngraph::opset6::Subtract>(input, mean1);
+        auto const_2 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 2 });
+        auto power_sqr = std::make_shared<ngraph::opset6::Power>(sub1, const_2);
+        auto mean3_axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { -1 });
+        auto mean3 = std::make_shared<ngraph::opset6::ReduceMean>(power_sqr, mean3_axes, true);
+        auto eps = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 1e-5 });
+        auto add_eps = std::make_shared<ngraph::opset6::Add>(mean3, eps);
+        auto const_neg_0_5 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { -0.5 });
+        auto rsqrt = std::make_shared<ngraph::opset6::Power>(add_eps, const_neg_0_5);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(sub1, rsqrt);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mul }, ngraph::ParameterVector{ input });
+
+        manager.register_pass<ngraph::pass::MVNFusion>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 64 });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 2 });
+        auto mvn = std::make_shared<ngraph::opset6::MVN>(input, axes, true, 1e-5, ngraph::op::MVNEpsMode::INSIDE_SQRT);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mvn }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, MVNFusionTestNegativeReducedDimsNotKept) {
+    // the mean of shape [2, 8] is broadcasted along the batch instead of the reduced axis
+    auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 8 });
+    auto mean1_axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 2 });
+    auto mean1 = std::make_shared<ngraph::opset6::ReduceMean>(input, mean1_axes, false);
+    auto sub1 = std::make_shared<ngraph::opset6::Subtract>(input, mean1);
+    auto const_2 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 2 });
+    auto power_sqr = std::make_shared<ngraph::opset6::Power>(sub1, const_2);
+    auto mean3_axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 2 });
+    auto mean3 = std::make_shared<ngraph::opset6::ReduceMean>(power_sqr, mean3_axes, false);
+    auto eps = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 1e-5 });
+    auto add_eps = std::make_shared<ngraph::opset6::Add>(mean3, eps);
+    auto sqrt = std::make_shared<ngraph::opset6::Sqrt>(add_eps);
+    auto div = std::make_shared<ngraph::opset6::Divide>(sub1, sqrt);
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ div }, ngraph::ParameterVector{ input });
+
+    manager.register_pass<ngraph::pass::MVNFusion>();
+}
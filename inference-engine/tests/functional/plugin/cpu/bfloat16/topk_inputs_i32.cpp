@@ -33,7 +33,7 @@ protected:
         //      Convolution1 (BF16)       Const (I32)
         //               |                |
         //               \                /
-        //                  TopK (FP32)
+        //                  TopK (BF16)
         //              (BF16)/        \ (I32)
         //                   |
         //         Convolution 2
@@ -135,7 +135,7 @@ protected:
         expectedPrecisions["Add_4"] = "ndef";
         expectedPrecisions["Convolution_1"] = "BF16";
         expectedPrecisions["Convolution_2"] = "BF16";
-        expectedPrecisions["TopK_1"] = "FP32";
+        expectedPrecisions["TopK_1"] = "BF16";
     }
 };
 
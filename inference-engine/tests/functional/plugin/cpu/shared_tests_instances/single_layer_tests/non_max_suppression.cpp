@@ -14,7 +14,9 @@ using namespace ngraph;
 const std::vector<InputShapeParams> inShapeParams = {
     InputShapeParams{3, 100, 5},
     InputShapeParams{1, 10, 50},
-    InputShapeParams{2, 50, 50}
+    InputShapeParams{2, 50, 50},
+    // a few classes of many boxes are selected by all threads
+    InputShapeParams{1, 1000, 2}
 };
 
 const std::vector<int32_t> maxOutBoxPerClass = {5, 20};
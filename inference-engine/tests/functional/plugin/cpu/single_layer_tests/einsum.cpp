@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset7.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+using EinsumParams = std::tuple<
+        std::string,                        // equation
+        std::vector<std::vector<size_t>>,   // input shapes
+        std::string                         // node type executing the contraction, empty if not checked
+>;
+
+class EinsumLayerCPUTest : public testing::WithParamInterface<EinsumParams>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EinsumParams> obj) {
+        std::string equation;
+        std::vector<std::vector<size_t>> inputShapes;
+        std::string expectedNodeType;
+        std::tie(equation, inputShapes, expectedNodeType) = obj.param;
+
+        // the equation is written by the letters only, the ellipsis is E
+        std::string name;
+        for (size_t i = 0; i < equation.size(); i++) {
+            if (equation.compare(i, 3, "...") == 0) {
+                name += 'E';
+                i += 2;
+            } else if (equation.compare(i, 2, "->") == 0) {
+                name += "_to_";
+                i++;
+            } else {
+                name += equation[i] == ',' ? '_' : equation[i];
+            }
+        }
+
+        std::ostringstream result;
+        result << "Eq=" << name << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShapes);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::string equation;
+        std::vector<std::vector<size_t>> inputShapes;
+        std::tie(equation, inputShapes, expectedNodeType) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+        auto einsum = std::make_shared<ngraph::opset7::Einsum>(ngraph::helpers::convert2OutputVector(
+                ngraph::helpers::castOps2Nodes<ngraph::opset7::Parameter>(params)), equation);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset7::Result>(einsum)};
+        function = std::make_shared<ngraph::Function>(results, params, "Einsum");
+    }
+
+    std::string expectedNodeType;
+};
+
+TEST_P(EinsumLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (expectedNodeType == "Einsum") {
+        // the ellipsis and the repeated labels are neither decomposed nor executed by the reference implementation
+        CheckNodeOfTypeCount(executableNetwork, "Einsum", 1);
+        CheckNodeOfTypeCount(executableNetwork, "MatMul", 0);
+        CheckNodeOfTypeCount(executableNetwork, "Transpose", 0);
+    } else {
+        // the rest is decomposed to MatMul/Transpose/ReduceSum
+        CheckNodeOfTypeCount(executableNetwork, "Einsum", 0);
+        if (expectedNodeType == "MatMul")
+            CheckNodeOfTypeCount(executableNetwork, "MatMul", 1);
+    }
+}
+
+namespace {
+
+const std::vector<EinsumParams> params = {
+        // the matrix products are decomposed to the oneDNN MatMul
+        {"ij,jk->ik", {{2, 3}, {3, 4}}, "MatMul"},
+        {"abcd,abed->abce", {{2, 3, 8, 16}, {2, 3, 10, 16}}, "MatMul"},
+        {"mk,nk->nm", {{70, 300}, {150, 300}}, "MatMul"},
+        {"abc,cd->ad", {{2, 3, 4}, {4, 5}}, "MatMul"},
+        {"abc->cb", {{2, 3, 4}}, ""},
+        {"ab,bc,cd->ad", {{10, 200}, {200, 3}, {3, 50}}, ""},
+        {"ab,cd,bc->", {{4, 5}, {6, 7}, {5, 6}}, ""},
+        // diagonals of the repeated labels
+        {"ii->i", {{5, 5}}, "Einsum"},
+        {"ii", {{5, 5}}, "Einsum"},
+        {"aab,bcc->ac", {{3, 3, 4}, {4, 5, 5}}, "Einsum"},
+        // several tiles of each of the M, N and K labels with the tails
+        {"mmk,nk->nm", {{70, 70, 300}, {150, 300}}, "Einsum"},
+        // the contraction order is chosen by FLOPs, the labels of a single input are reduced first
+        {"aab,bc,cd->ad", {{10, 10, 200}, {200, 3}, {3, 50}}, "Einsum"},
+        // ellipsis with the broadcasting
+        {"...ij,...jk->...ik", {{2, 1, 3, 4}, {5, 4, 6}}, "Einsum"},
+        {"a...->...", {{3, 2, 4}}, "Einsum"},
+        {"i...,...j->...ij", {{3, 1}, {4, 2}}, "Einsum"},
+        {"...,...->...", {{2, 3}, {1}}, "Einsum"},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Einsum_CPU, EinsumLayerCPUTest,
+                         ::testing::ValuesIn(params),
+                         EinsumLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
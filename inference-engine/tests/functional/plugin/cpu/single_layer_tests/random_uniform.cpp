@@ -0,0 +1,137 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <cstring>
+#include <sstream>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+using RandomUniformParams = std::tuple<
+        std::vector<int64_t>,       // output shape
+        ngraph::element::Type,      // output type
+        std::pair<double, double>,  // min and max
+        std::pair<uint64_t, uint64_t>  // global and operation seeds
+>;
+
+class RandomUniformLayerCPUTest : public testing::WithParamInterface<RandomUniformParams>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<RandomUniformParams> obj) {
+        std::vector<int64_t> outputShape;
+        ngraph::element::Type outputType;
+        std::pair<double, double> bounds;
+        std::pair<uint64_t, uint64_t> seeds;
+        std::tie(outputShape, outputType, bounds, seeds) = obj.param;
+
+        std::ostringstream result;
+        result << "OS=" << CommonTestUtils::vec2str(outputShape) << "_";
+        result << "Type=" << outputType << "_";
+        result << "Min=" << bounds.first << "_Max=" << bounds.second << "_";
+        result << "Seeds=" << seeds.first << "_" << seeds.second;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<int64_t> outputShape;
+        ngraph::element::Type outputType;
+        std::pair<double, double> bounds;
+        std::pair<uint64_t, uint64_t> seeds;
+        std::tie(outputShape, outputType, bounds, seeds) = this->GetParam();
+
+        // the random values are added to the input, so the network has a parameter
+        const std::vector<size_t> inputShape(outputShape.begin(), outputShape.end());
+        auto params = ngraph::builder::makeParams(outputType, {inputShape});
+        auto shape = ngraph::opset8::Constant::create(ngraph::element::i64, {outputShape.size()}, outputShape);
+        auto min = ngraph::opset8::Constant::create(outputType, {1}, {bounds.first});
+        auto max = ngraph::opset8::Constant::create(outputType, {1}, {bounds.second});
+        auto randomUniform = std::make_shared<ngraph::opset8::RandomUniform>(shape, min, max, outputType, seeds.first, seeds.second);
+        auto add = std::make_shared<ngraph::opset8::Add>(params[0], randomUniform);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, params, "RandomUniform");
+    }
+};
+
+TEST_P(RandomUniformLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the sequence of the node is the same as the one of the reference for the same seeds
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "RandomUniform", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Reference", 0);
+}
+
+TEST_P(RandomUniformLayerCPUTest, ExportImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    std::vector<std::vector<uint8_t>> outputs;
+    for (const auto& output : GetOutputs()) {
+        auto memory = as<MemoryBlob>(output)->rmap();
+        const auto data = memory.as<const uint8_t*>();
+        outputs.emplace_back(data, data + output->byteSize());
+    }
+
+    // the type of the sequence is an attribute of the exported operation, so the imported network generates
+    // the same values for the converted output precision
+    std::stringstream blob;
+    executableNetwork.Export(blob);
+    executableNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    Infer();
+    Validate();
+    const auto importedOutputs = GetOutputs();
+    ASSERT_EQ(importedOutputs.size(), outputs.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto memory = as<MemoryBlob>(importedOutputs[i])->rmap();
+        ASSERT_EQ(importedOutputs[i]->byteSize(), outputs[i].size());
+        ASSERT_EQ(std::memcmp(memory.as<const uint8_t*>(), outputs[i].data(), outputs[i].size()), 0);
+    }
+    CheckNodeOfTypeCount(executableNetwork, "RandomUniform", 1);
+}
+
+namespace {
+
+const std::vector<std::vector<int64_t>> outputShapes = {
+        {3},
+        {2, 3, 5},
+        // several chunks for each of the threads, the tails of the vector registers
+        {7, 1111, 13},
+};
+
+const std::vector<std::pair<uint64_t, uint64_t>> seeds = {
+        {150, 10},
+        {0, 1},
+        {1, 0},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_RandomUniform_Float_CPU, RandomUniformLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(outputShapes),
+                                 ::testing::Values(ngraph::element::f32, ngraph::element::f16),
+                                 ::testing::Values(std::pair<double, double>{-1.5, 2.5}),
+                                 ::testing::ValuesIn(seeds)),
+                         RandomUniformLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_RandomUniform_Int_CPU, RandomUniformLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(outputShapes),
+                                 ::testing::Values(ngraph::element::i32, ngraph::element::i64),
+                                 ::testing::Values(std::pair<double, double>{-100, 50}),
+                                 ::testing::ValuesIn(seeds)),
+                         RandomUniformLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -83,7 +83,11 @@ protected:
             targetStaticShapes.push_back({ inputShape.second[i], {} });
         }
 
-        selectedType = makeSelectedTypeStr("ref_any", inputPrecision);
+        // the selection is JIT compiled for AVX2 and AVX-512 only
+        std::string primitiveType = getPrimitiveType();
+        if (primitiveType != "jit_avx512" && primitiveType != "jit_avx2")
+            primitiveType = "ref_any";
+        selectedType = makeSelectedTypeStr(primitiveType, inputPrecision);
 
         auto params = ngraph::builder::makeDynamicParams(inputPrecision, { inputDynamicShapes[0] });
         auto k_param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, inputDynamicShapes[1]);
@@ -112,6 +116,7 @@ TEST_P(TopKLayerCPUTest, CompareWithRefs) {
 
 const ngraph::element::TypeVector inputPrecisions = {
     ngraph::element::f32,
+    ngraph::element::i32,
 };
 
 const std::vector<int64_t> axes = { 0, 1, 2 };
@@ -169,4 +174,30 @@ const auto testCases = ::testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, TopKLayerCPUTest, testCases, TopKLayerCPUTest::getTestCaseName);
 
+// K up to the length of the axis: the small K are selected by the sorting networks, the large ones by partitioning,
+// the long axis of a few sequences is split among the threads
+const std::vector<InputShape> inShapesLongAxis = {
+    InputShape{
+        // dynamic
+        {-1, -1},
+        // target
+        {
+            {64, 70},
+            {3, 20000},
+            {1, 50000},
+            {40, 1000}
+        }
+    },
+};
+
+const auto testCasesLongAxis = ::testing::Combine(
+    ::testing::ValuesIn(inputPrecisions),
+    ::testing::ValuesIn(inShapesLongAxis),
+    ::testing::Values(1),
+    ::testing::ValuesIn(modes),
+    ::testing::ValuesIn(sortTypes)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_LongAxis, TopKLayerCPUTest, testCasesLongAxis, TopKLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *   Conv 3x3
+ *       |
+ *     Relu
+ *       |
+ *     Result
+ *
+ * The network is compiled for the batch by the BATCH device. Any requests started together are executed by a single
+ * batched inference. When the timeout is out, the requests started so far form a partial batch while the single
+ * request is executed without the batch.
+ */
+
+class AutoBatchingTest : public testing::WithParamInterface<size_t>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<size_t> obj) {
+        std::ostringstream result;
+        result << "Batch=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = std::string("BATCH:") + CommonTestUtils::DEVICE_CPU + "(" + std::to_string(GetParam()) + ")";
+        configuration.insert({AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "10"});
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 8, 14, 14}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                     {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "AutoBatching");
+    }
+};
+
+TEST_P(AutoBatchingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the single request does not collect the batch
+    Run();
+
+    const size_t batch = GetParam();
+    auto batchedNetwork = core->LoadNetwork(cnnNetwork, targetDevice,
+                                            {{AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "60000"}});
+    auto cpuNetwork = core->LoadNetwork(cnnNetwork, CommonTestUtils::DEVICE_CPU);
+    const auto inputName = cnnNetwork.getInputsInfo().begin()->first;
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+
+    // the requests are not bound to the batched requests, so every second of the created ones forms the batch
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 2 * batch; i++) {
+        requests.push_back(batchedNetwork.CreateInferRequest());
+        auto blob = requests.back().GetBlob(inputName);
+        CommonTestUtils::fill_data_random<Precision::FP32>(blob, 10, 0, 1, static_cast<int>(i));
+    }
+    std::vector<InferRequest> startedRequests;
+    for (size_t i = 1; i < requests.size(); i += 2)
+        startedRequests.push_back(requests[i]);
+    for (auto&& request : startedRequests)
+        request.StartAsync();
+    for (auto&& request : startedRequests)
+        request.Wait(InferRequest::WaitMode::RESULT_READY);
+
+    for (auto&& request : startedRequests) {
+        auto cpuRequest = cpuNetwork.CreateInferRequest();
+        cpuRequest.SetBlob(inputName, request.GetBlob(inputName));
+        cpuRequest.Infer();
+        Compare(cpuRequest.GetBlob(outputName), request.GetBlob(outputName));
+    }
+
+    ASSERT_EQ(batchedNetwork.GetMetric(METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE)).as<float>(), static_cast<float>(batch));
+    ASSERT_EQ(batchedNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>() % batch, 0);
+    ASSERT_GE(batchedNetwork.GetMetric(METRIC_KEY(AUTO_BATCH_AVERAGE_COPY_TIME)).as<float>(), 0.f);
+}
+
+TEST_P(AutoBatchingTest, PartialBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t batch = GetParam();
+    auto batchedNetwork = core->LoadNetwork(cnnNetwork, targetDevice,
+                                            {{AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "100"}});
+    auto cpuNetwork = core->LoadNetwork(cnnNetwork, CommonTestUtils::DEVICE_CPU);
+    const auto inputName = cnnNetwork.getInputsInfo().begin()->first;
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+
+    // the requests started are one short of the batch, so they are executed together when the timeout is out
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < batch - 1; i++) {
+        requests.push_back(batchedNetwork.CreateInferRequest());
+        auto blob = requests.back().GetBlob(inputName);
+        CommonTestUtils::fill_data_random<Precision::FP32>(blob, 10, 0, 1, static_cast<int>(i));
+    }
+    for (auto&& request : requests)
+        request.StartAsync();
+    for (auto&& request : requests)
+        request.Wait(InferRequest::WaitMode::RESULT_READY);
+
+    for (auto&& request : requests) {
+        auto cpuRequest = cpuNetwork.CreateInferRequest();
+        cpuRequest.SetBlob(inputName, request.GetBlob(inputName));
+        cpuRequest.Infer();
+        Compare(cpuRequest.GetBlob(outputName), request.GetBlob(outputName));
+    }
+
+    ASSERT_EQ(batchedNetwork.GetMetric(METRIC_KEY(AUTO_BATCH_AVERAGE_BATCH_SIZE)).as<float>(), static_cast<float>(batch - 1));
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatchingTest,
+                         ::testing::Values(2, 4),
+                         AutoBatchingTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,131 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *        Parameter(s) u8
+ *              |
+ *     NV12toRGB / I420toBGR ...
+ *              |
+ *         Convert f32
+ *              |
+ *    Subtract [1, 1, 1, 3] mean
+ *              |
+ *    Multiply [1, 1, 1, 3] scale
+ *              |
+ *            Result
+ *
+ * The Convert and the normalization are expected to be fused into the ColorConvert node.
+ */
+
+using ColorConvertFusingParams = std::tuple<
+        bool,                  // NV12 or I420
+        bool,                  // RGB or BGR
+        bool,                  // single plane
+        std::vector<size_t>    // N, H, W of the output image
+>;
+
+class ColorConvertFusingTest : public testing::WithParamInterface<ColorConvertFusingParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ColorConvertFusingParams> obj) {
+        bool nv12, rgb, singlePlane;
+        std::vector<size_t> imageShape;
+        std::tie(nv12, rgb, singlePlane, imageShape) = obj.param;
+
+        std::ostringstream result;
+        result << (nv12 ? "NV12" : "I420") << "to" << (rgb ? "RGB" : "BGR") << "_";
+        result << (singlePlane ? "SinglePlane" : "MultiPlane") << "_";
+        result << "IS=" << CommonTestUtils::vec2str(imageShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        bool nv12, rgb, singlePlane;
+        std::vector<size_t> imageShape;
+        std::tie(nv12, rgb, singlePlane, imageShape) = this->GetParam();
+        const size_t N = imageShape[0], H = imageShape[1], W = imageShape[2];
+
+        std::vector<std::vector<size_t>> inputShapes;
+        if (singlePlane) {
+            inputShapes = {{N, H * 3 / 2, W, 1}};
+        } else if (nv12) {
+            inputShapes = {{N, H, W, 1}, {N, H / 2, W / 2, 2}};
+        } else {
+            inputShapes = {{N, H, W, 1}, {N, H / 2, W / 2, 1}, {N, H / 2, W / 2, 1}};
+        }
+        auto params = ngraph::builder::makeParams(ngraph::element::u8, inputShapes);
+        auto inputs = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+
+        std::shared_ptr<ngraph::Node> colorConvert;
+        if (nv12) {
+            if (rgb) {
+                colorConvert = singlePlane ? std::make_shared<ngraph::opset8::NV12toRGB>(inputs[0])
+                                           : std::make_shared<ngraph::opset8::NV12toRGB>(inputs[0], inputs[1]);
+            } else {
+                colorConvert = singlePlane ? std::make_shared<ngraph::opset8::NV12toBGR>(inputs[0])
+                                           : std::make_shared<ngraph::opset8::NV12toBGR>(inputs[0], inputs[1]);
+            }
+        } else {
+            if (rgb) {
+                colorConvert = singlePlane ? std::make_shared<ngraph::opset8::I420toRGB>(inputs[0])
+                                           : std::make_shared<ngraph::opset8::I420toRGB>(inputs[0], inputs[1], inputs[2]);
+            } else {
+                colorConvert = singlePlane ? std::make_shared<ngraph::opset8::I420toBGR>(inputs[0])
+                                           : std::make_shared<ngraph::opset8::I420toBGR>(inputs[0], inputs[1], inputs[2]);
+            }
+        }
+
+        auto convert = std::make_shared<ngraph::opset8::Convert>(colorConvert, ngraph::element::f32);
+        auto mean = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 1, 1, 3}, {123.675f, 116.28f, 103.53f});
+        auto subtract = std::make_shared<ngraph::opset8::Subtract>(convert, mean);
+        auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 1, 1, 3}, {0.0171f, 0.0175f, 0.0174f});
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(subtract, scale);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "ColorConvertFusing");
+    }
+};
+
+TEST_P(ColorConvertFusingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ColorConvert", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+// the widths cover the vector tails processing for both AVX2 and AVX-512 kernels
+const std::vector<std::vector<size_t>> imageShapes = {
+        {1, 4, 32},
+        {1, 10, 38},
+        {2, 6, 70}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertFusing_CPU, ColorConvertFusingTest,
+                         ::testing::Combine(
+                                 ::testing::Bool(),
+                                 ::testing::Bool(),
+                                 ::testing::Bool(),
+                                 ::testing::ValuesIn(imageShapes)),
+                         ColorConvertFusingTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <sstream>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *    Parameter   Constant[FP16]
+ *        |          |
+ *        |       Convert (constant folded, reordered to the blocked layout)
+ *         \        /
+ *        Convolution
+ *             |
+ *           Relu    Constant   Constant
+ *             |        \        /
+ *             |          Add (constant)
+ *              \        /
+ *               Multiply
+ *                  |
+ *                Result
+ *
+ * The constant subgraphs outputs are stored to the exported blob and are not computed again after the import.
+ */
+
+using ExportImportCompiledConstantsParams = std::string;  // number of streams
+
+class ExportImportCompiledConstantsTest : public testing::WithParamInterface<ExportImportCompiledConstantsParams>,
+                                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ExportImportCompiledConstantsParams> obj) {
+        std::ostringstream result;
+        result << "streams=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, GetParam()});
+
+        const std::vector<size_t> inputShape = {1, 16, 10, 10};
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+        std::vector<float> weightsValues(32 * 16 * 3 * 3);
+        FuncTestUtils::fillInputsBySinValues(weightsValues.data(), weightsValues.size());
+        auto weights = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f16, ngraph::Shape{32, 16, 3, 3}, weightsValues);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(inputParams[0], convert, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1});
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+
+        auto scale = std::make_shared<ngraph::opset1::Add>(ngraph::opset1::Constant::create(ngraph::element::f32, {1, 32, 1, 1}, {0.5f}),
+                                                           ngraph::opset1::Constant::create(ngraph::element::f32, {1, 32, 1, 1}, {1.5f}));
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(relu, scale);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(mul)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ExportImportCompiledConstants");
+    }
+};
+
+TEST_P(ExportImportCompiledConstantsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::stringstream blob;
+    executableNetwork.Export(blob);
+    executableNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    Infer();
+    Validate();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExportImportCompiledConstants_CPU, ExportImportCompiledConstantsTest,
+                         ::testing::Values("1", "2"),
+                         ExportImportCompiledConstantsTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <functional>
+#include <numeric>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      Parameter   Constant f32 (80% of zeros)
+ *            \       /
+ *             MatMul
+ *               |
+ *              Add    Constant (optional bias)
+ *               |
+ *             Result
+ *
+ * The density of the weights is below the threshold set by the config, so the FullyConnected node packs them to the
+ * block-CSR format and the sparse kernel is reported by the performance counters. The kernel vectorizes along the
+ * rows of the input, so with less rows than a vector the dense primitive is kept.
+ */
+
+using FCSparseWeightsParams = std::tuple<std::vector<size_t>,   // the input shape
+                                         bool,                  // transpose_b
+                                         bool>;                 // with bias
+
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsParams> obj) {
+        std::vector<size_t> inputShape;
+        bool transposeB, withBias;
+        std::tie(inputShape, transposeB, withBias) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_TransposeB=" << transposeB << "_Bias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DENSITY_THRESHOLD, "0.5"});
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+
+        std::vector<size_t> inputShape;
+        bool transposeB, withBias;
+        std::tie(inputShape, transposeB, withBias) = GetParam();
+        rows = std::accumulate(inputShape.begin(), inputShape.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+
+        // N is not multiple of the block of the channels, so the padded block is computed too
+        const size_t K = inputShape.back(), N = 18;
+        std::vector<float> weightsValues(K * N, 0.f);
+        for (size_t i = 0; i < weightsValues.size(); i += 5)
+            weightsValues[i] = 0.1f * static_cast<float>(static_cast<int>(i % 11) - 5);
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        const ngraph::Shape weightsShape = transposeB ? ngraph::Shape{N, K} : ngraph::Shape{K, N};
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, weightsShape, weightsValues);
+        std::shared_ptr<ngraph::Node> fc = std::make_shared<ngraph::opset1::MatMul>(params[0], weights, false, transposeB);
+        if (withBias) {
+            // the bias of the padded block of the channels is not added to the output
+            std::vector<float> biasValues(N);
+            for (size_t n = 0; n < N; n++)
+                biasValues[n] = 0.05f * static_cast<float>(n);
+            auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{N}, biasValues);
+            fc = std::make_shared<ngraph::opset1::Add>(fc, bias);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(fc)};
+        function = std::make_shared<ngraph::Function>(results, params, "FCSparseWeights");
+    }
+
+    size_t rows = 0;
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    if (!with_cpu_x86_avx2())
+        return;
+
+    const size_t lanes = with_cpu_x86_avx512f() ? 16 : 8;
+    const bool isSparseExpected = rows >= lanes;
+    bool isChecked = false;
+    for (const auto& counter : inferRequest.GetPerformanceCounts()) {
+        if (std::string(counter.second.layer_type) == "FullyConnected") {
+            const bool isSparse = std::string(counter.second.exec_type).find("sparse") != std::string::npos;
+            ASSERT_EQ(isSparse, isSparseExpected) << counter.second.exec_type;
+            isChecked = true;
+        }
+    }
+    ASSERT_TRUE(isChecked);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        // the rows of the input are less than a vector, the dense primitive is used
+        {1, 40},
+        {3, 40},
+        // a single vector of the rows
+        {16, 40},
+        // several strips of the vectors with the tail
+        {2, 37, 33},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCSparseWeights_CPU, FCSparseWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false)),
+                         FCSparseWeightsTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <ie_ngraph_utils.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                  Constant f16 / u8
+ *                        |
+ *                   Convert f32
+ *                        |
+ *      Parameter   [Subtract zero point]
+ *          \             |
+ *           \      [Multiply scale]
+ *            \          /
+ *               MatMul
+ *                 |
+ *               Result
+ *
+ * The weights are kept in the compressed precision by the FullyConnected node which decompresses them on the fly,
+ * so neither the Convert nor the Eltwise nodes are left and the runtime precision of the node is the one of the weights.
+ */
+
+using FCWeightsDecompressionParams = std::tuple<ngraph::element::Type,   // the precision of the weights
+                                                bool>;                   // transpose_b
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+        ngraph::element::Type weightsType;
+        bool transposeB;
+        std::tie(weightsType, transposeB) = obj.param;
+
+        std::ostringstream result;
+        result << "WeightsType=" << weightsType << "_TransposeB=" << transposeB;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION, PluginConfigParams::YES});
+
+        ngraph::element::Type weightsType;
+        bool transposeB;
+        std::tie(weightsType, transposeB) = GetParam();
+
+        // the sizes are not multiple of the blocks of the kernel, so the tails are computed too
+        const size_t K = 40, N = 18;
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{2, 3, K}});
+        const ngraph::Shape weightsShape = transposeB ? ngraph::Shape{N, K} : ngraph::Shape{K, N};
+        auto weights = ngraph::builder::makeConstant<float>(weightsType, weightsShape, {}, true);
+        std::shared_ptr<ngraph::Node> decompressed = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        if (weightsType.is_integral()) {
+            const ngraph::Shape channelShape = transposeB ? ngraph::Shape{N, 1} : ngraph::Shape{1, N};
+            auto zeroPoint = ngraph::builder::makeConstant<float>(ngraph::element::f32, channelShape, {}, true, 5.f, 1.f);
+            auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, channelShape, {}, true, 0.5f, 0.1f);
+            decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, zeroPoint);
+            decompressed = std::make_shared<ngraph::opset1::Multiply>(decompressed, scale);
+        }
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(params[0], decompressed, false, transposeB);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matMul)};
+        function = std::make_shared<ngraph::Function>(results, params, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the weights are decompressed by the AVX2 and AVX-512 kernels only, the other hosts convert them on the loading
+    if (!with_cpu_x86_avx2())
+        return;
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+
+    const auto expectedPrecision = InferenceEngine::details::convertPrecision(std::get<0>(GetParam()));
+    auto execFunction = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execFunction);
+    for (const auto &node : execFunction->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+            auto it = rtInfo.find(paramName);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+        if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "FullyConnected") {
+            ASSERT_EQ(getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION), expectedPrecision.name());
+        }
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_CPU, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::Values(ngraph::element::f16, ngraph::element::u8, ngraph::element::i8),
+                                            ::testing::Values(true, false)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
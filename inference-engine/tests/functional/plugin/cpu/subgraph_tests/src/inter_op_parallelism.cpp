@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                    Parameter
+ *           /       |        |       \
+ *   Conv 1x1    Conv 3x3    Relu    MaxPool 3x3
+ *           \       |        |       /
+ *                     Concat
+ *                       |
+ *                     Result
+ *
+ * The branches are independent, so they are executed simultaneously in the inter-op parallel mode.
+ */
+
+class InterOpParallelismTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "InterOpParallelism=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM, GetParam()});
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+
+        const std::vector<size_t> inputShape = {1, 16, 14, 14};
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+        auto conv1x1 = ngraph::builder::makeConvolution(inputParams[0], ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0},
+                                                        {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+        auto conv3x3 = ngraph::builder::makeConvolution(inputParams[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                        {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(inputParams[0]);
+        auto pool = ngraph::builder::makePooling(inputParams[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto concat = ngraph::builder::makeConcat({conv1x1, conv3x3, relu, pool}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "InterOpParallelism");
+    }
+};
+
+TEST_P(InterOpParallelismTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto perfCounts = inferRequest.GetPerformanceCounts();
+    const auto record = perfCounts.find("InterOpParallelism");
+    if (GetParam() == PluginConfigParams::YES) {
+        ASSERT_NE(record, perfCounts.end());
+        ASSERT_EQ(std::string(record->second.layer_type), "InterOpParallelism");
+    } else {
+        ASSERT_EQ(record, perfCounts.end());
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallelism_CPU, InterOpParallelismTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         InterOpParallelismTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (LayerNorm decomposition exported from ONNX):
+/*
+ *        Parameter
+ *        /       \
+ *       |     ReduceMean
+ *        \       /
+ *         Subtract
+ *        /       \
+ *       |       Power
+ *       |         |
+ *       |     ReduceMean
+ *       |         |
+ *       |        Add (eps)
+ *       |         |
+ *       |        Sqrt
+ *        \       /
+ *          Divide
+ *            |
+ *         Multiply (gamma)
+ *            |
+ *           Add (beta)
+ *            |
+ *          Result
+ *
+ * The normalization is fused into MVN node, gamma and beta are applied by its kernel.
+ */
+
+using LayerNormParams = std::tuple<
+        std::vector<size_t>,    // input shape, the innermost axis is normalized
+        bool                    // the axes of the reductions are negative
+>;
+
+class LayerNormTest : public testing::WithParamInterface<LayerNormParams>,
+                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LayerNormParams> obj) {
+        std::vector<size_t> inputShape;
+        bool negativeAxes;
+        std::tie(inputShape, negativeAxes) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "negativeAxes=" << negativeAxes;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        bool negativeAxes;
+        std::tie(inputShape, negativeAxes) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        const int64_t axis = negativeAxes ? -1 : static_cast<int64_t>(inputShape.size()) - 1;
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {axis});
+
+        auto mean = std::make_shared<ngraph::opset1::ReduceMean>(params[0], axes, true);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(params[0], mean);
+        auto power = std::make_shared<ngraph::opset1::Power>(sub, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f}));
+        auto variance = std::make_shared<ngraph::opset1::ReduceMean>(power, axes, true);
+        auto addEps = std::make_shared<ngraph::opset1::Add>(variance, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1e-12f}));
+        auto sqrt = std::make_shared<ngraph::opset1::Sqrt>(addEps);
+        auto div = std::make_shared<ngraph::opset1::Divide>(sub, sqrt);
+
+        const ngraph::Shape gammaBetaShape{inputShape.back()};
+        auto gamma = ngraph::builder::makeConstant<float>(ngraph::element::f32, gammaBetaShape, {}, true);
+        auto mulGamma = std::make_shared<ngraph::opset1::Multiply>(div, gamma);
+        auto beta = ngraph::builder::makeConstant<float>(ngraph::element::f32, gammaBetaShape, {}, true);
+        auto addBeta = std::make_shared<ngraph::opset1::Add>(mulGamma, beta);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(addBeta)};
+        function = std::make_shared<ngraph::Function>(results, params, "LayerNorm");
+    }
+};
+
+TEST_P(LayerNormTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "MVN", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<LayerNormParams> params = {
+        {{4, 64}, false},
+        {{2, 16, 768}, true},
+        // the innermost axis with a tail
+        {{1, 10, 70}, false},
+        // the outer dimensions are collapsed
+        {{2, 3, 5, 40}, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LayerNorm_CPU, LayerNormTest,
+                         ::testing::ValuesIn(params),
+                         LayerNormTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *         Parameter
+ *             |
+ *           Relu
+ *          /    \
+ *   Conv 3x3    Conv 3x3
+ *         |      |
+ *    Result      Result
+ *
+ * The greedy selection keeps the planar layout of the Parameter for Relu, so both the convolutions get a reorder to
+ * the blocked layout. The layouts selected for the whole graph move the reorder before Relu, so one reorder is avoided
+ * and the result must not differ from the reference.
+ */
+
+class LayoutAssignmentTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "LayoutAssignment=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT, GetParam()});
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+
+        const std::vector<size_t> inputShape = {1, 16, 14, 14};
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+        auto relu = std::make_shared<ngraph::opset1::Relu>(inputParams[0]);
+        auto conv1 = ngraph::builder::makeConvolution(relu, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                      {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                      {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv1),
+                                     std::make_shared<ngraph::opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "LayoutAssignment");
+    }
+};
+
+TEST_P(LayoutAssignmentTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto perfCounts = inferRequest.GetPerformanceCounts();
+    const auto record = perfCounts.find("LayoutAssignment");
+    if (GetParam() == PluginConfigParams::YES) {
+        ASSERT_NE(record, perfCounts.end());
+        ASSERT_EQ(std::string(record->second.layer_type), "LayoutAssignment");
+        // exec_type is "avoided:<number> changed:<number> reorders:<number>"
+        const std::string stat = record->second.exec_type;
+        ASSERT_EQ(stat.find("avoided:"), 0);
+        ASSERT_GT(std::stoll(stat.substr(std::string("avoided:").size())), 0);
+    } else {
+        ASSERT_EQ(record, perfCounts.end());
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_LayoutAssignment_CPU, LayoutAssignmentTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         LayoutAssignmentTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
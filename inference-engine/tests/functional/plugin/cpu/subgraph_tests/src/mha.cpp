@@ -0,0 +1,177 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ie_system_conf.h>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter     Parameter     Parameter
+ *       |             |             |
+ *    Reshape       Reshape       Reshape
+ *       |             |             |
+ *   Transpose     Transpose     Transpose
+ *        \           /              |
+ *          MatMul                   |
+ *            |                      |
+ *          Divide                   |
+ *            |                      |
+ *           Add  Parameter (mask)   |
+ *            |                      |
+ *         Softmax                   |
+ *             \                    /
+ *                    MatMul
+ *                      |
+ *                  Transpose
+ *                      |
+ *                   Reshape
+ *                      |
+ *                    Result
+ *
+ * The attention is fused into the MultiHeadAttention node, the transposes are folded into it as well.
+ * With the merged heads Q, K and V are reshaped to [B * H, L, D] after the transposes, the attention is 3D and
+ * its output is reshaped back to [B, H, L, D] before the output Transpose.
+ * The node is FP32 only and is used on AVX-512 platforms, the BF16 (enforced) and I8 (Q, K and V quantized by
+ * FakeQuantize before the Reshape) attention is executed by the MatMul nodes.
+ */
+
+using MHAParams = std::tuple<
+        size_t,                 // batch
+        size_t,                 // sequence length
+        size_t,                 // heads
+        size_t,                 // head size
+        bool,                   // K is transposed by the frontend (TF) or by the MatMul (ONNX)
+        bool,                   // the heads are merged into the batch of the 3D attention
+        Precision               // FP32, BF16 (enforced) or I8 (quantized Q, K and V)
+>;
+
+class MHATest : public testing::WithParamInterface<MHAParams>,
+                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MHAParams> obj) {
+        size_t batch, length, heads, headSize;
+        bool transposedK, mergedHeads;
+        Precision precision;
+        std::tie(batch, length, heads, headSize, transposedK, mergedHeads, precision) = obj.param;
+
+        std::ostringstream result;
+        result << "B=" << batch << "_L=" << length << "_H=" << heads << "_D=" << headSize << "_";
+        result << "transposedK=" << transposedK << "_";
+        result << "mergedHeads=" << mergedHeads << "_";
+        result << "Prc=" << precision.name();
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        size_t batch, length, heads, headSize;
+        bool transposedK, mergedHeads;
+        Precision precision;
+        std::tie(batch, length, heads, headSize, transposedK, mergedHeads, precision) = this->GetParam();
+        attentionFused = precision == Precision::FP32 && with_cpu_x86_avx512_core();
+        headsMerged = mergedHeads;
+
+        if (precision == Precision::BF16) {
+            configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES});
+            threshold = 0.05f;
+        } else {
+            configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        }
+
+        const std::vector<size_t> inputShape{batch, length, heads * headSize};
+        const std::vector<size_t> maskShape = mergedHeads ? std::vector<size_t>{batch * heads, 1, length} :
+                                                            std::vector<size_t>{batch, 1, 1, length};
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, inputShape, inputShape, maskShape});
+
+        auto makeShape = [](const std::vector<int64_t>& values) {
+            return ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{values.size()}, values);
+        };
+        const auto B = static_cast<int64_t>(batch), L = static_cast<int64_t>(length);
+        const auto H = static_cast<int64_t>(heads), D = static_cast<int64_t>(headSize);
+        auto splitHeads = [&](const ngraph::Output<ngraph::Node>& data, const std::vector<int64_t>& order) {
+            auto input = precision == Precision::I8 ?
+                    ngraph::builder::makeFakeQuantize(data, ngraph::element::f32, 256, {}, {-1.28f}, {1.27f}, {-1.28f}, {1.27f}) :
+                    data.get_node_shared_ptr();
+            auto shape = makeShape({0, 0, H, D});
+            auto reshape = std::make_shared<ngraph::opset1::Reshape>(input, shape, true);
+            auto transposeOrder = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, order);
+            std::shared_ptr<ngraph::Node> transpose = std::make_shared<ngraph::opset1::Transpose>(reshape, transposeOrder);
+            if (!mergedHeads)
+                return transpose;
+            // the transposed K is [B, H, D, L], so the 3D one is [B * H, D, L]
+            const bool transposed = order.back() == 1;
+            auto shape3D = transposed ? makeShape({B * H, D, L}) : makeShape({B * H, L, D});
+            return std::static_pointer_cast<ngraph::Node>(std::make_shared<ngraph::opset1::Reshape>(transpose, shape3D, false));
+        };
+
+        auto q = splitHeads(params[0], {0, 2, 1, 3});
+        auto k = splitHeads(params[1], transposedK ? std::vector<int64_t>{0, 2, 3, 1} : std::vector<int64_t>{0, 2, 1, 3});
+        auto v = splitHeads(params[2], {0, 2, 1, 3});
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k, false, !transposedK);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {std::sqrt(static_cast<float>(headSize))});
+        auto scaled = std::make_shared<ngraph::opset1::Divide>(qk, scale);
+        auto masked = std::make_shared<ngraph::opset1::Add>(scaled, params[3]);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(masked, mergedHeads ? 2 : 3);
+        std::shared_ptr<ngraph::Node> sv = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+        if (mergedHeads) {
+            sv = std::make_shared<ngraph::opset1::Reshape>(sv, makeShape({B, H, L, D}), false);
+        }
+        auto outOrder = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 2, 1, 3});
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(sv, outOrder);
+        auto outShape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{3}, std::vector<int64_t>{0, 0, -1});
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(transpose, outShape, true);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(reshape)};
+        function = std::make_shared<ngraph::Function>(results, params, "MHA");
+    }
+
+    bool attentionFused = false;
+    bool headsMerged = false;
+};
+
+TEST_P(MHATest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (!attentionFused) {
+        CheckNodeOfTypeCount(executableNetwork, "MultiHeadAttention", 0);
+        CheckNodeOfTypeCount(executableNetwork, "MatMul", 2);
+        return;
+    }
+    CheckNodeOfTypeCount(executableNetwork, "MultiHeadAttention", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+    CheckNodeOfTypeCount(executableNetwork, "MatMul", 0);
+    // the output of the 3D attention is reshaped, so the output Transpose is not folded
+    CheckNodeOfTypeCount(executableNetwork, "Transpose", headsMerged ? 1 : 0);
+}
+
+namespace {
+
+const std::vector<MHAParams> params = {
+        {1, 16, 4, 16, false, false, Precision::FP32},
+        {2, 10, 2, 8, true, false, Precision::FP32},
+        // several blocks of queries and keys with the tails
+        {1, 200, 2, 32, false, false, Precision::FP32},
+        {1, 16, 4, 16, false, true, Precision::FP32},
+        {2, 10, 2, 8, true, true, Precision::FP32},
+        // the node has no BF16 and INT8 kernels, the attention stays on the MatMuls
+        {1, 16, 4, 16, false, false, Precision::BF16},
+        {2, 10, 2, 8, true, false, Precision::I8},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_CPU, MHATest,
+                         ::testing::ValuesIn(params),
+                         MHATest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *         Parameter
+ *             |
+ *    Subtract [1, C, 1, 1] mean
+ *             |
+ *     Divide [1, C, 1, 1] scale
+ *             |
+ *   Conv 1x1 w/o padding / MatMul
+ *             |
+ *           Result
+ *
+ * The mean and the scale are folded to the weights and the bias of the first layer both for the operations in the
+ * network and for the mean values and the scales set by the PreProcessInfo of the input, so no Eltwise node is left.
+ */
+
+class PreprocessingFusionTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "FirstLayer=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const bool isConvolution = GetParam() == "Convolution";
+        const std::vector<size_t> inputShape = isConvolution ? std::vector<size_t>{1, 3, 20, 20} : std::vector<size_t>{2, 16};
+        const size_t channels = inputShape[1];
+        for (size_t c = 0; c < channels; c++) {
+            meanValues.push_back(0.5f + 0.1f * c);
+            stdScales.push_back(1.0f + 0.25f * c);
+        }
+
+        auto makeFunction = [&](bool withPreprocessing) {
+            auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+            ngraph::Output<ngraph::Node> input = params[0];
+            if (withPreprocessing) {
+                ngraph::Shape constShape(inputShape.size(), 1);
+                constShape[1] = channels;
+                auto mean = ngraph::opset1::Constant::create(ngraph::element::f32, constShape, meanValues);
+                auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, constShape, stdScales);
+                input = std::make_shared<ngraph::opset1::Divide>(std::make_shared<ngraph::opset1::Subtract>(input, mean), scale);
+            }
+
+            std::shared_ptr<ngraph::Node> layer;
+            if (isConvolution) {
+                layer = ngraph::builder::makeConvolution(input, ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0},
+                                                         {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+            } else {
+                auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {channels, 8}, {}, true);
+                layer = std::make_shared<ngraph::opset1::MatMul>(input, weights);
+            }
+
+            ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(layer)};
+            return std::make_shared<ngraph::Function>(results, params, "PreprocessingFusion");
+        };
+
+        // the weights are generated with the same seed, so both functions have the same first layer
+        function = makeFunction(true);
+        functionWithoutPreprocessing = makeFunction(false);
+    }
+
+    std::vector<float> meanValues;
+    std::vector<float> stdScales;
+    std::shared_ptr<ngraph::Function> functionWithoutPreprocessing;
+};
+
+TEST_P(PreprocessingFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+
+    // the same mean and scales set by the PreProcessInfo give the same result
+    CNNNetwork network(functionWithoutPreprocessing);
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(meanValues.size());
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        preProcess[c]->meanValue = meanValues[c];
+        preProcess[c]->stdScale = stdScales[c];
+    }
+    preProcess.setVariant(MEAN_VALUE);
+
+    auto preProcessingNetwork = core->LoadNetwork(network, targetDevice, configuration);
+    auto request = preProcessingNetwork.CreateInferRequest();
+    request.SetBlob(inputName, inferRequest.GetBlob(cnnNetwork.getInputsInfo().begin()->first));
+    request.Infer();
+
+    Compare(inferRequest.GetBlob(cnnNetwork.getOutputsInfo().begin()->first), request.GetBlob(outputName));
+    CheckNodeOfTypeCount(preProcessingNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessingFusion_CPU, PreprocessingFusionTest,
+                         ::testing::Values("Convolution", "MatMul"),
+                         PreprocessingFusionTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
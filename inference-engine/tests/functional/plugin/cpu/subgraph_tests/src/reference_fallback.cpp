@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <ie_parallel.hpp>
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter
+ *       |
+ *     Cube
+ *       |
+ *     Result
+ *
+ * Cube is an elementwise operation of the test, it has neither a CPU node nor a decomposition, so it falls back on
+ * its evaluate(). The fallback is flagged in the performance counters, the large tensors are evaluated by the parts
+ * of the outer dimension in parallel.
+ */
+
+class Cube : public ov::op::util::UnaryElementwiseArithmetic {
+public:
+    OPENVINO_OP("Cube", "test_opset", ov::op::util::UnaryElementwiseArithmetic);
+
+    Cube() = default;
+    explicit Cube(const ov::Output<ov::Node>& arg) : UnaryElementwiseArithmetic(arg) {
+        constructor_validate_and_infer_types();
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<Cube>(new_args.at(0));
+    }
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    bool evaluate(const ov::HostTensorVector& outputs, const ov::HostTensorVector& inputs) const override {
+        const auto src = inputs[0]->get_data_ptr<const float>();
+        auto dst = outputs[0]->get_data_ptr<float>();
+        for (size_t i = 0; i < ngraph::shape_size(inputs[0]->get_shape()); i++)
+            dst[i] = src[i] * src[i] * src[i];
+        return true;
+    }
+    OPENVINO_SUPPRESS_DEPRECATED_END
+
+    bool has_evaluate() const override {
+        return get_input_element_type(0) == ov::element::f32;
+    }
+};
+
+class ReferenceFallbackTest : public testing::WithParamInterface<std::vector<size_t>>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::vector<size_t>> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+        // the interpreter doesn't know the operation of the test, the constant folding evaluates it
+        SetRefMode(LayerTestsUtils::CONSTANT_FOLDING);
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {GetParam()});
+        auto cube = std::make_shared<Cube>(params[0]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(cube)};
+        function = std::make_shared<ngraph::Function>(results, params, "ReferenceFallback");
+    }
+};
+
+TEST_P(ReferenceFallbackTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the host tensors bound by the first inference are reused
+    Infer();
+    Validate();
+
+    const auto& shape = GetParam();
+    // the outer dimension is split when each thread gets at least 4096 elements
+    const size_t partsNum = std::min<size_t>({static_cast<size_t>(parallel_get_max_threads()), shape[0], ngraph::shape_size(shape) / 4096});
+    const bool parallel = partsNum > 1;
+    size_t fallbacks = 0;
+    for (const auto& record : inferRequest.GetPerformanceCounts()) {
+        if (std::string(record.second.layer_type) != "Reference")
+            continue;
+        fallbacks++;
+        const std::string execType = record.second.exec_type;
+        ASSERT_EQ(execType.find("fallback:Cube-test_opset"), 0) << execType;
+        ASSERT_EQ(execType.find(":parallel") != std::string::npos, parallel) << execType;
+    }
+    ASSERT_EQ(fallbacks, 1);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {2, 3},
+        {64, 3, 1024},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReferenceFallback_CPU, ReferenceFallbackTest,
+                         ::testing::ValuesIn(inputShapes),
+                         ReferenceFallbackTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,158 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <ie_system_conf.h>
+
+#include <sstream>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *    Parameter  Parameter
+ *          \     /
+ *            Add     Parameter
+ *           /   \   /
+ *   Subtract    Multiply
+ *    |              |
+ *    |  Parameter   |
+ *     \     |      /
+ *         Concat
+ *           |
+ *         Result
+ *
+ * Add, Subtract and Multiply are tokenized into a single snippet, the last parameter may be broadcasted.
+ */
+
+using SnippetsEltwiseParams = std::tuple<
+        std::vector<size_t>,    // shape of the inputs
+        std::vector<size_t>     // shape of the Multiply second input
+>;
+
+class SnippetsEltwiseTest : public testing::WithParamInterface<SnippetsEltwiseParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SnippetsEltwiseParams> obj) {
+        std::vector<size_t> inputShape, broadcastShape;
+        std::tie(inputShape, broadcastShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "BS=" << CommonTestUtils::vec2str(broadcastShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES});
+
+        std::vector<size_t> inputShape, broadcastShape;
+        std::tie(inputShape, broadcastShape) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, inputShape, inputShape, broadcastShape, inputShape});
+
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(add, params[2]);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, params[3]);
+        auto concat = ngraph::builder::makeConcat({subtract, multiply, params[4]}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "SnippetsEltwise");
+    }
+};
+
+TEST_P(SnippetsEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (with_cpu_x86_avx2()) {
+        CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    }
+}
+
+TEST_P(SnippetsEltwiseTest, ExportImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the subgraph is exported as the original operations and tokenized again on the import
+    std::stringstream blob;
+    executableNetwork.Export(blob);
+    executableNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+    inferRequest = executableNetwork.CreateInferRequest();
+
+    Infer();
+    Validate();
+    if (with_cpu_x86_avx2()) {
+        CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    }
+}
+
+// Subgraph:
+/*
+ *  Parameter  Parameter
+ *         \   /
+ *          Add    Parameter
+ *         /   \   /
+ *   Softmax  Multiply
+ *      |        |
+ *   Result   Softmax
+ *               |
+ *            Result
+ *
+ * Add and Multiply are tokenized into a snippet with the outputs of different shapes, which the Subgraph node doesn't
+ * support, so the snippet is expanded back to the eltwise operations.
+ */
+class SnippetsExpansionTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES});
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 16, 1, 1}, {1, 16, 1, 1}, {1, 16, 10, 10}});
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, params[2]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(std::make_shared<ngraph::opset1::Softmax>(add, 1)),
+                                     std::make_shared<ngraph::opset1::Result>(std::make_shared<ngraph::opset1::Softmax>(multiply, 1))};
+        function = std::make_shared<ngraph::Function>(results, params, "SnippetsExpansion");
+    }
+};
+
+TEST_F(SnippetsExpansionTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 0);
+}
+
+namespace {
+
+const std::vector<SnippetsEltwiseParams> shapes = {
+        // no broadcasting, the tensors are processed as flat arrays
+        {{1, 16, 10, 10}, {1, 16, 10, 10}},
+        // per channel broadcasting, the innermost dimension is processed by the kernel
+        {{1, 16, 10, 10}, {1, 16, 1, 1}},
+        {{2, 8, 5, 7}, {1, 8, 5, 1}},
+        {{1, 19, 13}, {1, 1, 13}},
+        // the innermost dimension is not vectorized
+        {{1, 16, 9, 1}, {1, 16, 9, 1}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsEltwise_CPU, SnippetsEltwiseTest,
+                         ::testing::ValuesIn(shapes),
+                         SnippetsEltwiseTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
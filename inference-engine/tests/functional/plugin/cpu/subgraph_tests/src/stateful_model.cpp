@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset3.hpp>
+#include <blob_factory.hpp>
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter   ReadValue(acc)        Parameter   ReadValue(prev)
+ *          \     /                        |             |
+ *            Add                      Multiply(2)       |
+ *          /     \                        |             |
+ *     Assign(acc) Result             Assign(prev)     Result
+ *
+ * The first state accumulates the inputs. The second one is written independently of its read,
+ * so it checks that the value read by an inference is the one committed by the previous inference.
+ */
+
+class StatefulModelTest : public testing::WithParamInterface<std::vector<size_t>>,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::vector<size_t>> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto& inputShape = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto init = ngraph::opset3::Constant::create(ngraph::element::f32, inputShape, std::vector<float>(ngraph::shape_size(inputShape), 0.f));
+
+        auto accRead = std::make_shared<ngraph::opset3::ReadValue>(init, "acc");
+        auto add = std::make_shared<ngraph::opset3::Add>(accRead, params[0]);
+        auto accWrite = std::make_shared<ngraph::opset3::Assign>(add, "acc");
+
+        auto prevRead = std::make_shared<ngraph::opset3::ReadValue>(init, "prev");
+        auto mul = std::make_shared<ngraph::opset3::Multiply>(params[0], ngraph::opset3::Constant::create(ngraph::element::f32, {}, {2.f}));
+        auto prevWrite = std::make_shared<ngraph::opset3::Assign>(mul, "prev");
+        auto prevCopy = std::make_shared<ngraph::opset3::Multiply>(prevRead, ngraph::opset3::Constant::create(ngraph::element::f32, {}, {1.f}));
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(add), std::make_shared<ngraph::opset3::Result>(prevCopy)};
+        function = std::make_shared<ngraph::Function>(results, ngraph::SinkVector{accWrite, prevWrite}, params, "StatefulModel");
+    }
+
+    static void checkBlob(const Blob::CPtr& blob, float expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ASSERT_FLOAT_EQ(expected, data[i]) << "at index " << i;
+    }
+};
+
+TEST_P(StatefulModelTest, StatesAreCommittedAfterInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    auto otherRequest = executableNetwork.CreateInferRequest();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    auto input = request.GetBlob(inputName);
+    std::vector<std::string> outputNames;
+    for (const auto& output : executableNetwork.GetOutputsInfo())
+        outputNames.push_back(output.first);
+
+    for (int i = 1; i <= 3; i++) {
+        auto data = input->buffer().as<float*>();
+        std::fill(data, data + input->size(), static_cast<float>(i));
+        request.Infer();
+
+        // acc = 1 + 2 + ... + i, prev is the doubled input of the previous inference
+        const float acc = static_cast<float>(i * (i + 1) / 2);
+        const float prev = static_cast<float>(2 * (i - 1));
+        std::vector<float> outputValues;
+        for (const auto& name : outputNames)
+            outputValues.push_back(request.GetBlob(name)->cbuffer().as<const float*>()[0]);
+        ASSERT_TRUE(std::find(outputValues.begin(), outputValues.end(), acc) != outputValues.end());
+        ASSERT_TRUE(std::find(outputValues.begin(), outputValues.end(), prev) != outputValues.end());
+
+        for (auto&& state : request.QueryState())
+            checkBlob(state.GetState(), state.GetName() == "acc" ? acc : static_cast<float>(2 * i));
+    }
+
+    // the states of the other request are not affected
+    for (auto&& state : otherRequest.QueryState())
+        checkBlob(state.GetState(), 0.f);
+
+    // the state set by the user is read by the next inference
+    for (auto&& state : request.QueryState()) {
+        if (state.GetName() != "acc")
+            continue;
+        auto blob = make_blob_with_precision(state.GetState()->getTensorDesc());
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), 100.f);
+        state.SetState(blob);
+    }
+    request.Infer();
+    for (auto&& state : request.QueryState()) {
+        if (state.GetName() == "acc")
+            checkBlob(state.GetState(), 103.f);
+        state.Reset();
+        checkBlob(state.GetState(), 0.f);
+    }
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 16},
+        {2, 3, 10},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulModel_CPU, StatefulModelTest,
+                         ::testing::ValuesIn(inputShapes),
+                         StatefulModelTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,262 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cache/multi_cache.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+struct IntKey {
+    size_t hash() const {
+        return std::hash<int>()(data);
+    }
+    bool operator==(const IntKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    int data;
+};
+
+struct StringKey {
+    size_t hash() const {
+        return std::hash<std::string>()(data);
+    }
+    bool operator==(const StringKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    std::string data;
+};
+}  // namespace
+
+TEST(LruCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+    ASSERT_NO_THROW(cache.evict(5));
+    ASSERT_NO_THROW(cache.evict(10));
+    int result = cache.get({10});
+    ASSERT_EQ(result, int());
+    ASSERT_NO_THROW(cache.evict(0));
+}
+
+TEST(LruCacheTests, Put) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+
+    ASSERT_EQ(cache.get({10}), 10);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(LruCacheTests, Get) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(LruCacheTests, LruPolicy) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(LruCacheTests, Empty) {
+    constexpr int capacity = 0;
+    constexpr int attempts = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(CacheEntryTests, GetOrCreate) {
+    using namespace MKLDNNPlugin;
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+
+    CacheEntry<IntKey, ValueType> entry(capacity);
+
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto stat = entry.getStatistics();
+    ASSERT_EQ(stat.hits, capacity);
+    ASSERT_EQ(stat.misses, capacity);
+    ASSERT_EQ(stat.size, capacity);
+}
+
+TEST(CacheEntryTests, NullValueIsNotStored) {
+    using ValueType = std::shared_ptr<int>;
+
+    CacheEntry<IntKey, ValueType> entry(10);
+
+    auto builder = [](const IntKey& key) {
+        return ValueType();
+    };
+
+    auto result = entry.getOrCreate({1}, builder);
+    ASSERT_EQ(result.first, ValueType());
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(entry.getStatistics().size, 0);
+}
+
+TEST(MultiCacheTests, GetOrCreate) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 10;
+
+    MultiCache cache(capacity);
+
+    auto intBuilder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    auto strBuilder = [](const StringKey& key) {
+        return std::make_shared<std::string>(key.data);
+    };
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(result.first, IntValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    for (int i = 0; i < capacity; ++i) {
+        auto key = std::string("key") + std::to_string(i);
+        auto result = cache.getOrCreate(StringKey{key}, strBuilder);
+        ASSERT_NE(result.first, StrValueType());
+        ASSERT_EQ(*result.first, key);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(result.first, IntValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+    for (int i = 0; i < capacity; ++i) {
+        auto key = std::string("key") + std::to_string(i);
+        auto result = cache.getOrCreate(StringKey{key}, strBuilder);
+        ASSERT_NE(result.first, StrValueType());
+        ASSERT_EQ(*result.first, key);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.hits, 2 * capacity);
+    ASSERT_EQ(stat.misses, 2 * capacity);
+    ASSERT_EQ(stat.size, 2 * capacity);
+}
+
+TEST(MultiCacheTests, Empty) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 0;
+    constexpr int attempts = 10;
+
+    MultiCache cache(capacity);
+
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    for (int i = 0; i < attempts; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    for (int i = 0; i < attempts; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, builder);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    ASSERT_EQ(cache.getStatistics().size, 0);
+}
+
+TEST(MultiCacheTests, ConcurrentAccess) {
+    constexpr int capacity = 100;
+    constexpr int threadsNum = 8;
+
+    MultiCache cache(capacity);
+
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 2 * capacity; ++i) {
+                auto result = cache.getOrCreate(IntKey{i % capacity}, builder);
+                ASSERT_EQ(*result.first, i % capacity);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.hits + stat.misses, 2 * capacity * threadsNum);
+    ASSERT_EQ(stat.size, capacity);
+}
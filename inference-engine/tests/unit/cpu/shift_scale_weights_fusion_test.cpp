@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/shift_scale_weights_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeShiftScaleConvolution(bool withRelu) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+    std::shared_ptr<ngraph::Node> data = input;
+    if (withRelu)
+        data = std::make_shared<ngraph::opset1::Relu>(data);
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 1 }, { 2.f, 3.f, 4.f });
+    auto mul = std::make_shared<ngraph::opset1::Multiply>(data, scale);
+    auto shift = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 1 }, { -1.f, -2.f, -3.f });
+    auto add = std::make_shared<ngraph::opset1::Add>(mul, shift);
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 8, 3, 1, 1 }, { 1.f });
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(add, weights, ngraph::Strides{ 1, 1 }, ngraph::CoordinateDiff{ 0, 0 },
+                                                              ngraph::CoordinateDiff{ 0, 0 }, ngraph::Strides{ 1, 1 });
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{ conv }, ngraph::ParameterVector{ input });
+}
+
+void runShiftScaleFusion(const std::shared_ptr<ngraph::Function>& f) {
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    auto fusion = m.register_pass<ngraph::pass::GraphRewrite>();
+    fusion->add_matcher<AddConvolutionFusion>();
+    fusion->add_matcher<AddMatMulFusion>();
+    fusion->add_matcher<MultiplyMatMulFusion>();
+    m.run_passes(f);
+}
+
+}  // namespace
+
+TEST(TransformationTests, ShiftScaleWeightsFusionParameter) {
+    auto f = makeShiftScaleConvolution(false);
+    runShiftScaleFusion(f);
+
+    // the scale is folded to the weights and the shift to the bias, so the convolution reads the Parameter
+    size_t convolutions = 0;
+    for (const auto& node : f->get_ordered_ops()) {
+        ASSERT_FALSE(ngraph::is_type<ngraph::opset1::Multiply>(node));
+        if (ngraph::is_type<ngraph::opset1::Convolution>(node)) {
+            ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Parameter>(node->get_input_node_ptr(0)));
+            ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1)));
+            convolutions++;
+        }
+    }
+    ASSERT_EQ(convolutions, 1);
+}
+
+TEST(TransformationTests, ShiftScaleWeightsFusionNotParameter) {
+    auto f = makeShiftScaleConvolution(true);
+    runShiftScaleFusion(f);
+
+    // the shift and the scale inside the network are kept for the eltwise fusing of the graph
+    auto f_ref = makeShiftScaleConvolution(true);
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+std::vector<unsigned char> generateData(size_t size) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<unsigned char> data(size);
+    for (auto& value : data)
+        value = static_cast<unsigned char>(distribution(generator));
+    return data;
+}
+}  // namespace
+
+TEST(SimpleDataHashTests, Deterministic) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    // the sizes cover the tails processing and the multichunk case
+    for (size_t size : {0ul, 1ul, 7ul, 31ul, 32ul, 1000ul, (1ul << 20) + 3, (3ul << 20) + 17}) {
+        const auto data = generateData(size);
+        const auto copy = data;
+        ASSERT_EQ(hashFunc.hash(data.data(), data.size()), hashFunc.hash(copy.data(), copy.size())) << "size: " << size;
+    }
+}
+
+TEST(SimpleDataHashTests, SensitiveToContent) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    for (size_t size : {1ul, 33ul, 1000ul, (3ul << 20) + 17}) {
+        auto data = generateData(size);
+        const auto reference = hashFunc.hash(data.data(), data.size());
+        for (size_t pos : {size_t(0), size / 2, size - 1}) {
+            data[pos] ^= 1;
+            ASSERT_NE(reference, hashFunc.hash(data.data(), data.size())) << "size: " << size << " pos: " << pos;
+            data[pos] ^= 1;
+        }
+    }
+}
+
+TEST(SimpleDataHashTests, SensitiveToSize) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    const std::vector<unsigned char> zeros((1ul << 20) + 64, 0);
+    ASSERT_NE(hashFunc.hash(zeros.data(), 64), hashFunc.hash(zeros.data(), 65));
+    ASSERT_NE(hashFunc.hash(zeros.data(), 1ul << 20), hashFunc.hash(zeros.data(), (1ul << 20) + 64));
+}
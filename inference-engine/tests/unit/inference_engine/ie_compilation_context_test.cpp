@@ -398,6 +398,78 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto createNetworkWithConstant = [](const std::vector<float>& values) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createNetworkWithConstant({1.f, 2.f, 3.f});
+    auto net2 = createNetworkWithConstant({1.f, 2.f, 3.f});
+    auto net3 = createNetworkWithConstant({1.f, 2.f, 4.f});
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+    // the cached fingerprints of the constants give the same hash
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithSwappedConstantWords) {
+    auto createNetworkWithConstant = [](const std::vector<int64_t>& values) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i64, ngraph::Shape{2});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{2}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    // the fingerprint depends on the data only, the same words in another order give another hash
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createNetworkWithConstant({1, 2}), {}),
+              NetworkCompilationContext::computeHash(createNetworkWithConstant({1, 2}), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createNetworkWithConstant({1, 2}), {}),
+              NetworkCompilationContext::computeHash(createNetworkWithConstant({2, 1}), {}));
+    ASSERT_EQ(ngraph::opset6::Constant::compute_data_hash(std::vector<int64_t>{1, 2}.data(), 2 * sizeof(int64_t)),
+              ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 2})->get_data_hash());
+}
+
+TEST(NetworkContext_CNNNetwork, HashReusesConstantFingerprint) {
+    auto createNetworkWithConstant = [](const std::shared_ptr<ngraph::opset6::Constant>& constant) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16});
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1}, {1.f, 2.f, 3.f});
+    auto net = createNetworkWithConstant(constant);
+    const auto hash = NetworkCompilationContext::computeHash(net, {});
+
+    // the data is changed behind the constant, so the second hash gives the old value only when the fingerprint
+    // cached by the first one survives the visit of the constant by the Hash pass
+    const_cast<float*>(constant->get_data_ptr<float>())[2] = 4.f;
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net, {}));
+    auto changedConstant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1}, {1.f, 2.f, 4.f});
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(createNetworkWithConstant(changedConstant), {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashIgnoresPadsWithAutoPad) {
+    auto createNetworkWithPads = [](const ngraph::CoordinateDiff& pads, ngraph::op::PadType autoPad) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+        auto weights = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 3, 3}, {1.f});
+        auto conv = std::make_shared<ngraph::opset6::Convolution>(data, weights, ngraph::Strides{1, 1}, pads, pads,
+                                                                  ngraph::Strides{1, 1}, autoPad);
+        auto res = std::make_shared<ngraph::opset6::Result>(conv);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    // the explicit pads are not used when they are calculated automatically, so they are not serialized
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createNetworkWithPads({0, 0}, ngraph::op::PadType::SAME_UPPER), {}),
+              NetworkCompilationContext::computeHash(createNetworkWithPads({1, 1}, ngraph::op::PadType::SAME_UPPER), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createNetworkWithPads({0, 0}, ngraph::op::PadType::EXPLICIT), {}),
+              NetworkCompilationContext::computeHash(createNetworkWithPads({1, 1}, ngraph::op::PadType::EXPLICIT), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
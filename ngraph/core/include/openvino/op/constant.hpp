@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 
@@ -376,6 +377,15 @@ public:
     }
     std::string convert_value_to_string(size_t index) const;
 
+    /// \brief Returns the fingerprint of the constant data
+    ///
+    /// The fingerprint is calculated on the first call and cached on the constant until the buffer
+    /// is reallocated, the copies of the constant sharing the buffer take the cached value.
+    uint64_t get_data_hash() const;
+
+    /// \brief Returns the fingerprint of the given data calculated the same way as get_data_hash()
+    static uint64_t compute_data_hash(const void* data, size_t size);
+
     /**
      * \brief Allows to avoid buffer allocation on the visit_attributes call
      */
@@ -711,6 +721,9 @@ private:
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_data;
     bool m_all_elements_bitwise_identical;
     bool m_alloc_buffer_on_visit_attributes = true;
+
+    // the fingerprint of the data, 0 until it is calculated
+    mutable std::atomic<uint64_t> m_data_hash{0};
 };
 }  // namespace v0
 }  // namespace op
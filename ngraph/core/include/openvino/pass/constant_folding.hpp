@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "openvino/core/variant.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -13,17 +16,47 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *
+ *        The nodes whose inputs are all constants are independent of each other, so they
+ *        are evaluated in parallel wave by wave, the next wave is formed by the consumers of
+ *        the new constants. The folded nodes are released right after their replacement, so
+ *        the intermediate constants do not outlive their consumers.
  */
 class OPENVINO_API ConstantFolding : public FunctionPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+
+    /// \brief The number of the folded nodes of a single type and the time spent on them
+    struct FoldStatistics {
+        size_t count = 0;
+        double milliseconds = 0.0;
+    };
+
+    /// \param threads_num The number of the threads evaluating the independent nodes,
+    ///                    0 stands for the number of the hardware threads
+    explicit ConstantFolding(size_t threads_num = 0);
+
     bool run_on_function(std::shared_ptr<ov::Function> f) override;
 
+    /// \brief Returns the fold statistics accumulated by the runs of the pass by the operation types
+    const std::map<std::string, FoldStatistics>& get_fold_statistics() const {
+        return m_fold_statistics;
+    }
+
 private:
     void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node, const Output<Node>& replacement);
+    bool fold_function(const std::shared_ptr<ov::Function>& f);
+    bool replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+    /// \brief Evaluates the nodes with the constant inputs in parallel until none is left.
+    bool fold_constant_subgraphs(const std::shared_ptr<ov::Function>& f, bool rewritten);
+    bool fold_ordered_ops(const std::shared_ptr<ov::Function>& f, bool rewritten);
+    void add_fold_time(const std::shared_ptr<Node>& node, double milliseconds);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Function>& f);
+
+    size_t m_threads_num;
+    std::map<std::string, FoldStatistics> m_fold_statistics;
 };
 
 OPENVINO_API void disable_constant_folding(const std::shared_ptr<Node>& node);
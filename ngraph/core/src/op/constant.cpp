@@ -4,6 +4,7 @@
 
 #include "ngraph/op/constant.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
@@ -197,6 +198,7 @@ ov::op::v0::Constant::Constant(const element::Type& type, const ov::Shape& shape
 void ov::op::v0::Constant::allocate_buffer() {
     m_data = make_shared<ngraph::runtime::AlignedBuffer>(mem_size(), host_alignment());
     std::memset(m_data->get_ptr(), 0, m_data->size());
+    m_data_hash = 0;
 }
 
 ov::op::v0::Constant::Constant(const element::Type& type, const ov::Shape& shape, const void* data)
@@ -211,6 +213,7 @@ ov::op::v0::Constant::Constant(const Constant& other) {
     m_shape = other.m_shape;
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    m_data_hash = other.m_data_hash.load();
     constructor_validate_and_infer_types();
 }
 
@@ -222,6 +225,7 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
     m_shape = new_shape;
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    m_data_hash = other.m_data_hash.load();
     constructor_validate_and_infer_types();
 }
 
@@ -531,6 +535,7 @@ bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
     NGRAPH_OP_SCOPE(v0_Constant_visit_attributes);
     ov::Shape prev_shape = m_shape;
     element::Type prev_type = m_element_type;
+    const auto prev_data = m_data;
     visitor.on_attribute("element_type", m_element_type);
     visitor.on_attribute("shape", m_shape);
 
@@ -541,9 +546,54 @@ bool ov::op::v0::Constant::visit_attributes(AttributeVisitor& visitor) {
     }
     visitor.on_attribute("value", m_data);
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    // the reading visitors keep the fingerprint, the ones which set a new buffer reset it
+    if (m_data != prev_data)
+        m_data_hash = 0;
     return true;
 }
 
+uint64_t ov::op::v0::Constant::get_data_hash() const {
+    uint64_t hash = m_data_hash.load(std::memory_order_acquire);
+    if (hash != 0)
+        return hash;
+    const void* data = get_data_ptr();
+    if (data == nullptr)
+        return 0;
+
+    // the threads racing here calculate the same value
+    hash = compute_data_hash(data, m_data->size());
+    if (hash == 0)
+        hash = 1;
+    m_data_hash.store(hash, std::memory_order_release);
+    return hash;
+}
+
+uint64_t ov::op::v0::Constant::compute_data_hash(const void* data, size_t size) {
+    // Four independent lanes let the multiplications of the neighbour words overlap
+    constexpr uint64_t prime = 0x9e3779b97f4a7c15ULL;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t lanes[4] = {size, size ^ prime, size + prime, size - prime};
+    size_t offset = 0;
+    for (; offset + 4 * sizeof(uint64_t) <= size; offset += 4 * sizeof(uint64_t)) {
+        for (size_t l = 0; l < 4; l++) {
+            uint64_t word;
+            std::memcpy(&word, bytes + offset + l * sizeof(uint64_t), sizeof(word));
+            lanes[l] = (lanes[l] ^ word) * prime;
+            lanes[l] ^= lanes[l] >> 29;
+        }
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, bytes + offset, std::min(size - offset, sizeof(tail)));
+    uint64_t seed = 0;
+    for (size_t l = 0; l < 4; l++)
+        seed ^= lanes[l] + prime + (seed << 6) + (seed >> 2);
+    // the remaining bytes after the first word of the tail
+    for (offset += sizeof(tail); offset < size; offset++)
+        tail = (tail ^ bytes[offset]) * prime;
+    seed ^= tail + prime + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
 bool ov::op::v0::Constant::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs) const {
     NGRAPH_OP_SCOPE(v0_Constant_evaluate);
     auto output = outputs[0];
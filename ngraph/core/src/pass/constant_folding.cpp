@@ -4,59 +4,253 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <mutex>
 #include <ngraph/op/constant.hpp>
+#include <thread>
+#include <unordered_set>
 
+#include "itt.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 #include "ngraph/validation_util.hpp"
+#include "openvino/op/sink.hpp"
+#include "openvino/op/util/variable_extension.hpp"
+#include "openvino/util/env_util.hpp"
 
 using namespace std;
 
+namespace {
+// the nodes with less output elements in total are evaluated by the calling thread
+constexpr size_t parallel_min_elements = 1 << 16;
+
+bool is_evaluated_in_parallel(const std::shared_ptr<ov::Node>& node) {
+    // the nodes without evaluate (e.g. ConvertLike) may build temporary nodes on top of the shared
+    // constants in their constant_fold, which is not safe to run concurrently
+    if (node->get_input_size() == 0 || !node->has_evaluate())
+        return false;
+    if (ov::pass::constant_folding_is_disabled(node))
+        return false;
+    // the nodes which are not folded by their nature or fold by their own means
+    if (ov::is_type<ngraph::op::Result>(node) || std::dynamic_pointer_cast<ov::op::Sink>(node) ||
+        std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node) ||
+        std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node))
+        return false;
+    for (const auto& input : node->input_values()) {
+        if (!ov::is_type<ngraph::op::Constant>(input.get_node()))
+            return false;
+    }
+    return true;
+}
+
+size_t get_output_elements(const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+    size_t elements = 0;
+    for (const auto& node : nodes) {
+        for (const auto& output : node->outputs()) {
+            if (output.get_partial_shape().is_dynamic())
+                return std::numeric_limits<size_t>::max();
+            elements += ov::shape_size(output.get_shape());
+        }
+    }
+    return elements;
+}
+
+// runs func for each index, the first exception is rethrown by the calling thread
+template <typename F>
+void parallel_for(size_t threads_num, size_t work_amount, const F& func) {
+    threads_num = std::min(threads_num, work_amount);
+    if (threads_num <= 1) {
+        for (size_t i = 0; i < work_amount; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&]() {
+        for (size_t i = next++; i < work_amount; i = next++) {
+            try {
+                func(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threads_num - 1);
+    for (size_t t = 1; t < threads_num; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+double get_milliseconds(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+ov::pass::ConstantFolding::ConstantFolding(size_t threads_num)
+    : m_threads_num(threads_num ? threads_num : std::max(1u, std::thread::hardware_concurrency())) {}
+
 bool ov::pass::ConstantFolding::run_on_function(std::shared_ptr<ov::Function> f) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::ConstantFolding::run_on_function");
+    static const bool profile_enabled = ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
+    bool rewritten = fold_function(f);
+
+    if (profile_enabled) {
+        for (const auto& statistics : m_fold_statistics) {
+            cout << setw(7) << statistics.second.milliseconds << "ms " << get_name() << " " << statistics.first << " x"
+                 << statistics.second.count << "\n";
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::fold_function(const std::shared_ptr<ov::Function>& f) {
     bool rewritten = pre_calculated_values_folding(f);
+    rewritten = fold_constant_subgraphs(f, rewritten);
+    return fold_ordered_ops(f, rewritten);
+}
 
+bool ov::pass::ConstantFolding::fold_constant_subgraphs(const std::shared_ptr<ov::Function>& f, bool rewritten) {
+    std::vector<std::shared_ptr<Node>> ready;
     for (const auto& node : f->get_ordered_ops()) {
+        if (is_evaluated_in_parallel(node))
+            ready.push_back(node);
+    }
+
+    while (!ready.empty()) {
+        if (rewritten) {
+            // validation may update the tensors of the inputs, so it is not a part of the parallel evaluation
+            for (const auto& node : ready)
+                node->validate_and_infer_types();
+        }
+
+        std::vector<OutputVector> replacements(ready.size());
+        std::vector<double> fold_times(ready.size(), 0.0);
+        const size_t threads_num = get_output_elements(ready) < parallel_min_elements ? 1 : m_threads_num;
+        parallel_for(threads_num, ready.size(), [&](size_t i) {
+            const auto& node = ready[i];
+            const auto start = std::chrono::steady_clock::now();
+
+            // the same entry point as the serial folding, so the nodes which refuse folding in their
+            // constant_fold (e.g. FakeQuantize, RandomUniform) are kept; the constant inputs are only read here
+            OutputVector outputs(node->get_output_size());
+            if (node->constant_fold(outputs, node->input_values())) {
+                NGRAPH_CHECK(outputs.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+                replacements[i] = std::move(outputs);
+                fold_times[i] = get_milliseconds(start);
+            }
+        });
+
+        // the consumers of the new constants form the next wave
+        std::vector<std::shared_ptr<Node>> consumers;
+        std::unordered_set<Node*> visited;
+        for (size_t i = 0; i < ready.size(); ++i) {
+            if (replacements[i].empty())
+                continue;
+            add_fold_time(ready[i], fold_times[i]);
+            if (!replace_outputs(ready[i], replacements[i]))
+                continue;
+            rewritten = true;
+            for (const auto& replacement : replacements[i]) {
+                for (const auto& input : replacement.get_target_inputs()) {
+                    if (visited.insert(input.get_node()).second)
+                        consumers.push_back(input.get_node()->shared_from_this());
+                }
+            }
+        }
+
+        // the folded nodes are released here together with the constants which have no other consumers
+        ready.clear();
+        replacements.clear();
+        for (const auto& consumer : consumers) {
+            if (is_evaluated_in_parallel(consumer))
+                ready.push_back(consumer);
+        }
+    }
+
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::fold_ordered_ops(const std::shared_ptr<ov::Function>& f, bool rewritten) {
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto& node : ordered_ops) {
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
         OutputVector replacements(node->get_output_size());
+        const auto start = std::chrono::steady_clock::now();
         if (node->constant_fold(replacements, node->input_values())) {
             NGRAPH_CHECK(replacements.size() == node->get_output_size(),
                          "constant_fold_default returned incorrect number of replacements for ",
                          node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            add_fold_time(node, get_milliseconds(start));
+            rewritten |= replace_outputs(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_function(sub_graph_node->get_function(sub_graph_ind));
+                    rewritten |= fold_function(sub_graph_node->get_function(sub_graph_ind));
                 }
             }
         }
+        // the folded node does not hold its inputs any longer
+        node.reset();
     }
 
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            if (replacements.size() == 1) {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            } else {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                     std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+void ov::pass::ConstantFolding::add_fold_time(const std::shared_ptr<Node>& node, double milliseconds) {
+    const auto& type_info = node->get_type_info();
+    std::string type_name = type_info.name;
+    if (type_info.version_id)
+        type_name += std::string("-") + type_info.version_id;
+    auto& statistics = m_fold_statistics[type_name];
+    statistics.count++;
+    statistics.milliseconds += milliseconds;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                        const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -124,7 +124,7 @@ bool convert_precision(pass::PassBase& pass,
                 // Function object
                 auto it = const_to_internal_output.find(node.get());
                 if (it != const_to_internal_output.end()) {
-                    return fuse_type_to_constant(node, to, it->second);
+                    return !ov::is_keep_const_precision(node) && fuse_type_to_constant(node, to, it->second);
                 }
 
                 // Check that node type exists in map and we can fuse type into node
@@ -245,6 +245,21 @@ precisions_set_t find_all_used_precisions(const std::shared_ptr<ngraph::Function
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertPrecision, "ConvertPrecision", 0);
 
+void ov::enable_keep_const_precision(const std::shared_ptr<Node>& node) {
+    auto& rt_info = node->get_rt_info();
+    rt_info[KeepConstPrecision::get_type_info_static()] = std::make_shared<KeepConstPrecision>(true);
+}
+
+void ov::disable_keep_const_precision(const std::shared_ptr<Node>& node) {
+    auto& rt_info = node->get_rt_info();
+    rt_info.erase(KeepConstPrecision::get_type_info_static());
+}
+
+bool ov::is_keep_const_precision(const std::shared_ptr<const Node>& node) {
+    const auto& rt_info = node->get_rt_info();
+    return rt_info.count(KeepConstPrecision::get_type_info_static());
+}
+
 bool ngraph::pass::ConvertPrecision::run_on_function(std::shared_ptr<ngraph::Function> f) {
     type_to_fuse_map type_to_fuse{
         {opset4::Parameter::get_type_info_static(), fuse_type_to_parameter},
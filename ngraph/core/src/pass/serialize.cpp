@@ -1230,46 +1230,313 @@ static uint64_t hash_combine(uint64_t seed, const T& a) {
     return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
 }
 
-class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
+template <typename T>
+static uint64_t hash_combine(uint64_t seed, const std::vector<T>& v) {
+    seed = hash_combine(seed, v.size());
+    for (const auto& e : v)
+        seed = hash_combine(seed, e);
+    return seed;
+}
 
-public:
-    uint64_t getResult() const {
-        return m_res;
+static uint64_t hash_combine(uint64_t seed, const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic())
+        return hash_combine(seed, std::string("dynamic_rank"));
+    seed = hash_combine(seed, shape.rank().get_length());
+    for (const auto& d : shape) {
+        seed = hash_combine(seed, d.get_min_length());
+        seed = hash_combine(seed, d.get_max_length());
     }
+    return seed;
+}
 
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
+// Hashes the attributes of a node the way XmlSerializer writes them to the IR, so the same set of
+// attribute types is supported and the values which are not serialized do not affect the hash.
+// Constant data is hashed by its cached fingerprint instead of being streamed.
+class AttributeHasher : public ngraph::AttributeVisitor {
+public:
+    using Attributes = std::vector<std::pair<std::string, uint64_t>>;
 
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+    AttributeHasher(const ngraph::Node* node,
+                    Attributes& attributes,
+                    uint64_t (*hash_function)(const ngraph::Function&))
+        : m_node(node),
+          m_attributes(attributes),
+          m_hash_function(hash_function) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        uint64_t seed = 0;
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& input : a->get()) {
+                seed = hash_combine(seed, input->get_type_info().name);
+                seed = hash_combine(seed, input->m_input_index);
+                seed = hash_combine(seed, input->m_body_parameter_index);
+                if (auto slice = ov::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(input)) {
+                    seed = hash_combine(seed, std::vector<int64_t>{slice->m_axis, slice->m_start, slice->m_end,
+                                                                   slice->m_stride, slice->m_part_size});
+                } else if (auto merged =
+                               ov::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(input)) {
+                    seed = hash_combine(seed, merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                       std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& output : a->get()) {
+                seed = hash_combine(seed, output->get_type_info().name);
+                seed = hash_combine(seed, output->m_output_index);
+                seed = hash_combine(seed, output->m_body_value_index);
+                if (auto concat = ov::as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(output)) {
+                    seed = hash_combine(seed, std::vector<int64_t>{concat->m_axis, concat->m_start, concat->m_end,
+                                                                   concat->m_stride, concat->m_part_size});
+                }
+            }
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            seed = hash_combine(seed, a->get().current_iteration_input_idx);
+            seed = hash_combine(seed, a->get().body_condition_output_idx);
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            seed = hash_combine(seed, a->get()->get_info().variable_id);
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                           &adapter)) {
+            if (name != "value")
+                return;
+            const auto& buffer = a->get();
+            if (auto constant = dynamic_cast<const ngraph::opset1::Constant*>(m_node)) {
+                seed = constant->get_data_hash();
+            } else if (buffer) {
+                // the buffer is not owned by a Constant, so there is no cached fingerprint and the data is read
+                seed = ngraph::opset1::Constant::compute_data_hash(buffer->get_ptr(), buffer->size());
+            }
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            seed = hash_combine(seed, attrs.get_type_name());
+            seed = hash_combine(seed, attrs.get_opset_name());
+            // the attributes are kept in the unordered map
+            std::vector<std::pair<std::string, std::string>> sorted(attrs.begin(), attrs.end());
+            std::sort(sorted.begin(), sorted.end());
+            for (const auto& attr : sorted) {
+                seed = hash_combine(seed, attr.first);
+                seed = hash_combine(seed, attr.second);
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            seed = hash_combine(seed, join(a->get()));
+        } else {
+            throw ngraph_error("Unsupported attribute type for serialization: " + name);
         }
-        return n;
+        add(name, seed);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        add(name, std::hash<bool>()(adapter.get()));
     }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        add(name, std::hash<std::string>()(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        add(name, std::hash<int64_t>()(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        add(name, std::hash<double>()(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        add(name, hash_combine(0, adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        add(name, hash_combine(0, adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        add(name, hash_combine(0, adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        add(name, hash_combine(0, adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        add(name, hash_combine(0, adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        NGRAPH_CHECK(name == "body" || name == "then_body" || name == "else_body" || name == "net",
+                     "Unsupported Function name.");
+        add(name, m_hash_function(*adapter.get()));
+    }
+
+private:
+    void add(const std::string& name, uint64_t value) {
+        m_attributes.emplace_back(name, value);
+    }
+
+    const ngraph::Node* m_node;
+    Attributes& m_attributes;
+    uint64_t (*m_hash_function)(const ngraph::Function&);
 };
-}  // namespace
 
-bool pass::Hash::run_on_function(std::shared_ptr<ov::Function> f) {
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
+// Hashes the rt info attributes the way RTInfoSerializer writes them
+class RTInfoHasher : public ngraph::AttributeVisitor {
+public:
+    explicit RTInfoHasher(uint64_t& seed) : m_seed(seed) {}
 
-    // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            combine(name, join(a->get()));
+        } else {
+            throw ngraph_error("Unsupported attribute type for serialization: " + name);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        combine(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        throw ngraph_error("Function type is unsupported for rt info serialization");
+    }
+
+private:
+    template <typename T>
+    void combine(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    uint64_t& m_seed;
+};
+
+uint64_t hash_rt_info(uint64_t seed, const ngraph::Node::RTMap& attributes) {
+    for (const auto& item : attributes) {
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        uint64_t attribute_seed = hash_combine(0, std::string(item.second->get_type_info().name));
+        attribute_seed = hash_combine(attribute_seed, item.second->get_type_info().get_version());
+        RTInfoHasher hasher(attribute_seed);
+        if (item.second->visit_attributes(hasher))
+            seed = hash_combine(seed, attribute_seed);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+    }
+    return seed;
+}
 
+// Walks the function in the order of ngfunction_2_ir and hashes the same information the
+// deterministic IR contains: names which are not auto-generated, types, opsets, ports, attributes,
+// rt info, edges and constant data. The XML document and the weights stream are not created.
+uint64_t hash_function(const ngraph::Function& f) {
     uint64_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    if (!is_name_auto_generated(f))
+        seed = hash_combine(seed, f.get_friendly_name());
+
+    int64_t version = static_cast<int64_t>(ov::pass::Serialize::Version::IR_V11);
+    const auto& f_rt_info = f.get_rt_info();
+    if (f_rt_info.count("version")) {
+        if (auto version_var = std::dynamic_pointer_cast<VariantWrapper<int64_t>>(f_rt_info.at("version")))
+            version = version_var->get();
+    }
+    seed = hash_combine(seed, version);
+
+    const auto layer_ids = create_layer_ids(f);
+    std::unordered_set<std::string> unique_names;
+    std::vector<std::shared_ptr<ov::Node>> sorted_ops;
+    {
+        const auto ordered_ops = f.get_ordered_ops();
+        sorted_ops.reserve(ordered_ops.size());
+        for (const auto& param : f.get_parameters())
+            sorted_ops.emplace_back(param);
+        for (const auto& node : ordered_ops) {
+            if (!ov::op::util::is_parameter(node) && !ov::op::util::is_output(node) && !ov::op::util::is_sink(node))
+                sorted_ops.emplace_back(node);
+        }
+        for (const auto& sink : f.get_sinks())
+            sorted_ops.emplace_back(sink);
+        for (const auto& res : f.get_results())
+            sorted_ops.emplace_back(res);
+    }
 
-    m_hash = seed;
+    for (const auto& n : sorted_ops) {
+        const ngraph::Node* node = n.get();
+        seed = hash_combine(seed, layer_ids.at(n.get()));
+        if (!is_name_auto_generated(*node))
+            seed = hash_combine(seed, get_node_unique_name(unique_names, node));
+        seed = hash_combine(seed, std::string(node->get_type_name()));
+        seed = hash_combine(seed, get_opset_name(node, {}));
+        seed = hash_rt_info(seed, node->get_rt_info());
+
+        for (const auto& i : node->inputs()) {
+            seed = hash_combine(seed, get_precision_name(i.get_element_type()));
+            seed = hash_combine(seed, i.get_partial_shape());
+            seed = hash_rt_info(seed, i.get_rt_info());
+        }
+        if (!ngraph::op::is_output(node)) {
+            for (const auto& o : node->outputs()) {
+                seed = hash_combine(seed, get_precision_name(o.get_element_type()));
+                const auto& tensor_names = o.get_tensor().get_names();
+                std::vector<std::string> sorted_names(tensor_names.begin(), tensor_names.end());
+                std::sort(sorted_names.begin(), sorted_names.end());
+                seed = hash_combine(seed, sorted_names);
+                seed = hash_combine(seed, o.get_partial_shape());
+                seed = hash_rt_info(seed, o.get_rt_info());
+            }
+        }
+
+        AttributeHasher::Attributes attributes;
+        AttributeHasher hasher(node, attributes, hash_function);
+        NGRAPH_CHECK(n->visit_attributes(hasher), "Visitor API is not supported in ", node);
+        // the explicit padding is cleared by the serialization if it is calculated automatically
+        const auto auto_pad =
+            std::find_if(attributes.begin(), attributes.end(), [](const std::pair<std::string, uint64_t>& a) {
+                return a.first == "auto_pad";
+            });
+        const bool pads_ignored = auto_pad != attributes.end() &&
+                                  (auto_pad->second == std::hash<std::string>()("same_lower") ||
+                                   auto_pad->second == std::hash<std::string>()("same_upper") ||
+                                   auto_pad->second == std::hash<std::string>()("valid"));
+        for (const auto& attribute : attributes) {
+            if (pads_ignored && (attribute.first == "pads_begin" || attribute.first == "pads_end"))
+                continue;
+            seed = hash_combine(seed, attribute.first);
+            seed = hash_combine(seed, attribute.second);
+        }
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto& found_rt_info = node->get_rt_info().find(rt_info_name);
+            if (found_rt_info == node->get_rt_info().end())
+                continue;
+            if (auto v = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(found_rt_info->second)) {
+                seed = hash_combine(seed, rt_info_name);
+                seed = hash_combine(seed, v->get());
+            }
+        }
+    }
+
+    for (const auto& e : create_edge_mapping(layer_ids, f)) {
+        seed = hash_combine(seed, std::vector<int>{e.from_layer, e.from_port, e.to_layer, e.to_port});
+    }
+    return seed;
+}
+}  // namespace
+
+bool pass::Hash::run_on_function(std::shared_ptr<ov::Function> f) {
+    // Determinism is important for hash calculation
+    m_hash = hash_function(*f);
     // Return false because we didn't change nGraph Function
     return false;
 }
@@ -9,6 +9,7 @@
 
 #include "ir_frontend/model.hpp"
 #include "ir_frontend/utility.hpp"
+#include "mmap_object.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/variant.hpp"
@@ -198,6 +199,13 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
     }
 
     if (!weights_path.empty()) {
+        // Constants reference the mapped file content through SharedBuffer, so the weights are not copied
+        // and the pages are shared between all the processes which load the same model
+        weights = load_mmap_object(weights_path);
+    }
+
+    // Fallback to reading of the file if it cannot be mapped
+    if (!weights_path.empty() && !weights) {
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
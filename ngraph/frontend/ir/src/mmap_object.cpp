@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_object.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace {
+
+/// \brief AlignedBuffer which references the read only memory mapping of a file.
+/// The mapping is released together with the buffer, so it stays alive while Constants
+/// created via SharedBuffer reference it.
+class MapHolder : public ngraph::runtime::AlignedBuffer {
+public:
+#ifdef _WIN32
+    MapHolder(HANDLE file, HANDLE mapping, char* data, size_t size) : m_file(file), m_mapping(mapping) {
+#else
+    MapHolder(char* data, size_t size) {
+#endif
+        // m_allocated_buffer stays nullptr, so the base class does not try to free the mapped memory
+        m_aligned_buffer = data;
+        m_byte_size = size;
+    }
+
+    ~MapHolder() override {
+#ifdef _WIN32
+        UnmapViewOfFile(m_aligned_buffer);
+        CloseHandle(m_mapping);
+        CloseHandle(m_file);
+#else
+        munmap(m_aligned_buffer, m_byte_size);
+#endif
+        m_aligned_buffer = nullptr;
+        m_byte_size = 0;
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+};
+
+#ifdef _WIN32
+std::shared_ptr<ngraph::runtime::AlignedBuffer> map_file(HANDLE file) {
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    auto data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    return std::make_shared<MapHolder>(file, mapping, data, static_cast<size_t>(file_size.QuadPart));
+}
+#endif
+
+}  // namespace
+
+#ifdef _WIN32
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+    return map_file(
+        CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
+    return map_file(
+        CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+}
+#    endif
+#else
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat sb = {};
+    if (fstat(fd, &sb) == -1 || sb.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    const auto size = static_cast<size_t>(sb.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping holds its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    return std::make_shared<MapHolder>(static_cast<char*>(data), size);
+}
+#endif
+
+}  // namespace ov
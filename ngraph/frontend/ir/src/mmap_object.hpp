@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ov {
+
+/**
+ * @brief Maps the file to the memory in the read only mode and returns a buffer which owns the mapping.
+ * The mapping is shared and backed by the page cache, so the processes which load the same file do not
+ * hold private copies of its content. Pages are loaded on the first access.
+ * @param path Path to the file
+ * @return Buffer with the file content or nullptr if the file cannot be mapped
+ */
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path);
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path);
+#endif
+
+}  // namespace ov
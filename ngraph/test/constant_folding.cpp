@@ -3240,3 +3240,65 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, independent_subgraphs_in_parallel) {
+    // the branches are large enough to be evaluated by several threads
+    const Shape shape{256, 256};
+    const size_t branches_num = 8;
+
+    ResultVector results;
+    for (size_t i = 0; i < branches_num; ++i) {
+        auto data = op::Constant::create(element::f32, shape, {static_cast<float>(i)});
+        auto scale = op::Constant::create(element::f32, Shape{}, {2.0f});
+        auto shift = op::Constant::create(element::f32, Shape{1}, {1.0f});
+        auto multiply = make_shared<opset5::Multiply>(data, scale);
+        auto add = make_shared<opset5::Add>(multiply, shift);
+        add->set_friendly_name("branch_" + std::to_string(i));
+        results.push_back(make_shared<opset5::Result>(add));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    auto constant_folding = pass_manager.register_pass<pass::ConstantFolding>(4);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<opset5::Multiply>(f), 0);
+    EXPECT_EQ(count_ops_of_type<opset5::Add>(f), 0);
+    // the intermediate constants are not kept
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), branches_num);
+
+    for (size_t i = 0; i < branches_num; ++i) {
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        ASSERT_EQ(new_const->get_friendly_name(), "branch_" + std::to_string(i));
+        ASSERT_EQ(new_const->get_shape(), shape);
+        auto values_out = new_const->cast_vector<float>();
+        ASSERT_EQ(values_out, vector<float>(shape_size(shape), 2.0f * i + 1.0f));
+    }
+
+    const auto& statistics = constant_folding->get_fold_statistics();
+    ASSERT_EQ(statistics.at("Multiply-opset1").count, branches_num);
+    ASSERT_EQ(statistics.at("Add-opset1").count, branches_num);
+}
+
+TEST(constant_folding, fake_quantize_on_constant_weights_is_kept) {
+    // the weights are large enough to be evaluated by several threads
+    const Shape shape{64, 64, 3, 3};
+    ResultVector results;
+    for (size_t i = 0; i < 4; ++i) {
+        auto weights = op::Constant::create(element::f32, shape, {0.5f});
+        auto input_low = op::Constant::create(element::f32, Shape{}, {-1.0f});
+        auto input_high = op::Constant::create(element::f32, Shape{}, {1.0f});
+        auto output_low = op::Constant::create(element::f32, Shape{}, {-1.0f});
+        auto output_high = op::Constant::create(element::f32, Shape{}, {1.0f});
+        auto fq = make_shared<opset5::FakeQuantize>(weights, input_low, input_high, output_low, output_high, 255);
+        results.push_back(make_shared<opset5::Result>(fq));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(4);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::FakeQuantize>(f), 4);
+}
@@ -171,6 +171,31 @@ static const char cache_dir_message[] = "Optional. Enables caching of loaded mod
 static const char load_from_file_message[] = "Optional. Loads model from file directly without ReadNetwork."
                                              "All CNNNetwork options (like re-shape) will be ignored";
 
+/// @brief message for the target arrival rate of the open-loop mode
+static const char qps_message[] =
+    "Optional. Target number of inference requests per second. If set, the requests are submitted on a timer "
+    "independently of the completion of the previous ones (open loop), the time an arrived request waits for an "
+    "idle infer request is reported as the queueing delay. Requires the async API. "
+    "Default value is 0 (closed loop: the requests are resubmitted as soon as they complete).";
+
+/// @brief message for the arrival distribution of the open-loop mode
+static const char arrival_message[] =
+    "Optional. Distribution of the intervals between the arrivals in the -qps mode: \"poisson\" "
+    "(exponentially distributed intervals) or \"uniform\" (fixed interval). Default value is \"poisson\".";
+
+/// @brief message for the shape sweep
+static const char shape_sweep_message[] =
+    "Optional. Set of input shapes fed to the inferences in turn, in the -shape format separated by ';'. "
+    "For example, \"input_ids[1,8],mask[1,8];input_ids[1,512],mask[1,512]\". A path to a text file with a "
+    "set per line is accepted as well. The dimensions which differ among the sets are made dynamic. "
+    "The latency is reported per shape set, the time to set the new shape and the first inference after the "
+    "shape change of a request are reported separately from the steady state.";
+
+/// @brief message for the order of the shape sweep
+static const char shape_sweep_order_message[] =
+    "Optional. Order in which the -shape_sweep sets are fed: \"sequential\" (default) or \"random\" "
+    "(uniformly distributed, repeat a set to increase its weight).";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -248,6 +273,18 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Target arrival rate in the open-loop mode, 0 means closed loop
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Distribution of the intervals between the arrivals in the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Set of input shapes fed to the inferences in turn
+DEFINE_string(shape_sweep, "", shape_sweep_message);
+
+/// @brief Order in which the shape sets are fed
+DEFINE_string(shape_sweep_order, "sequential", shape_sweep_order_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -347,9 +384,13 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
+    std::cout << "    -shape_sweep              " << shape_sweep_message << std::endl;
+    std::cout << "    -shape_sweep_order \"<sequential/random>\"  " << shape_sweep_order_message << std::endl;
     std::cout << "    -cache_dir \"<path>\"        " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -qps \"<double>\"           " << qps_message << std::endl;
+    std::cout << "    -arrival \"<poisson/uniform>\"  " << arrival_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <functional>
 #include <inference_engine.hpp>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -16,6 +17,7 @@
 #include <string>
 #include <vector>
 
+#include "latency_histogram.hpp"
 #include "statistics_report.hpp"
 
 typedef std::chrono::high_resolution_clock Time;
@@ -43,6 +45,15 @@ public:
 
     void startAsync() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.StartAsync();
+    }
+
+    /// @brief Starts the request which was scheduled to arrive at the given time, the time spent waiting
+    /// for an idle request is accounted as the queueing delay
+    void startAsync(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -52,6 +63,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -74,16 +86,46 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    /// @brief Marks the shape set of the shape sweep fed to the next inference, the inference is accounted as
+    /// the first one after a shape change if the previous inference of the request had another shape set
+    void setShapeId(size_t shapeId) {
+        _shapeChanged = shapeId != _shapeId;
+        _shapeId = shapeId;
+    }
+
+    size_t getShapeId() const {
+        return _shapeId;
+    }
+
+    bool isShapeChanged() const {
+        return _shapeChanged;
+    }
+
+    double getQueueingDelayInMilliseconds() const {
+        auto delay = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(delay.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
+    size_t _shapeId = std::numeric_limits<size_t>::max();
+    bool _shapeChanged = false;
     QueueCallbackFunction _callbackQueue;
 };
 
 class InferRequestsQueue final {
 public:
+    /// @brief Latencies of the shape set of the shape sweep
+    struct ShapeStatistics {
+        LatencyHistogram steadyState;
+        LatencyHistogram afterShapeChange;
+        LatencyHistogram setShape;
+    };
+
     InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(std::make_shared<InferReqWrap>(
@@ -108,6 +150,21 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _latencyHistogram.reset();
+        _queueingHistogram.reset();
+        _responseHistogram.reset();
+        for (auto& shapeStatistics : _shapeStatistics) {
+            shapeStatistics = ShapeStatistics();
+        }
+    }
+
+    void setShapesCount(size_t count) {
+        _shapeStatistics.resize(count);
+    }
+
+    void addSetShapeTime(size_t shapeId, const double time) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _shapeStatistics.at(shapeId).setShape.add(time);
     }
 
     double getDurationInMilliseconds() {
@@ -117,6 +174,15 @@ public:
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        const auto& request = requests.at(id);
+        const double queueingDelay = request->getQueueingDelayInMilliseconds();
+        _latencyHistogram.add(latency);
+        _queueingHistogram.add(queueingDelay);
+        _responseHistogram.add(queueingDelay + latency);
+        if (request->getShapeId() < _shapeStatistics.size()) {
+            auto& shapeStatistics = _shapeStatistics[request->getShapeId()];
+            (request->isShapeChanged() ? shapeStatistics.afterShapeChange : shapeStatistics.steadyState).add(latency);
+        }
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -133,6 +199,20 @@ public:
         return request;
     }
 
+    /// @brief Waits for an idle request until the deadline, returns nullptr if there is no idle request by then
+    InferReqWrap::Ptr getIdleRequestUntil(const Time::time_point& deadline) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_cv.wait_until(lock, deadline, [this] {
+                return _idleIds.size() > 0;
+            })) {
+            return nullptr;
+        }
+        auto request = requests.at(_idleIds.front());
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
     void waitAll() {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.wait(lock, [this] {
@@ -144,6 +224,25 @@ public:
         return _latencies;
     }
 
+    /// @brief Inference time of the requests
+    const LatencyHistogram& getLatencyHistogram() const {
+        return _latencyHistogram;
+    }
+
+    /// @brief Time between the scheduled arrival of the requests and their start
+    const LatencyHistogram& getQueueingHistogram() const {
+        return _queueingHistogram;
+    }
+
+    /// @brief Time between the scheduled arrival of the requests and their completion
+    const LatencyHistogram& getResponseHistogram() const {
+        return _responseHistogram;
+    }
+
+    const std::vector<ShapeStatistics>& getShapeStatistics() const {
+        return _shapeStatistics;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -153,4 +252,8 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    LatencyHistogram _latencyHistogram;
+    LatencyHistogram _queueingHistogram;
+    LatencyHistogram _responseHistogram;
+    std::vector<ShapeStatistics> _shapeStatistics;
 };
@@ -436,3 +436,51 @@ void fillBlobs(const std::vector<std::string>& inputFiles,
         }
     }
 }
+
+std::vector<std::map<std::string, Blob::Ptr>> createShapeSweepBlobs(
+    const std::vector<InferenceEngine::ICNNNetwork::InputShapes>& shape_sets,
+    const benchmark_app::InputsInfo& app_inputs_info) {
+    std::vector<std::map<std::string, Blob::Ptr>> blobs;
+    for (auto& shape_set : shape_sets) {
+        std::map<std::string, Blob::Ptr> set_blobs;
+        for (auto& item : shape_set) {
+            const auto precision = app_inputs_info.at(item.first).precision;
+            const TensorDesc desc(precision, item.second, TensorDesc::getLayoutByDims(item.second));
+            Blob::Ptr inputBlob;
+            if (precision == InferenceEngine::Precision::FP32) {
+                inputBlob = make_shared_blob<float>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<float, float>(inputBlob);
+            } else if (precision == InferenceEngine::Precision::FP16) {
+                inputBlob = make_shared_blob<short>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<short, short>(inputBlob);
+            } else if (precision == InferenceEngine::Precision::I32) {
+                inputBlob = make_shared_blob<int32_t>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<int32_t, int32_t>(inputBlob);
+            } else if (precision == InferenceEngine::Precision::I64) {
+                inputBlob = make_shared_blob<int64_t>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<int64_t, int64_t>(inputBlob);
+            } else if (precision == InferenceEngine::Precision::U8) {
+                inputBlob = make_shared_blob<uint8_t>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<uint8_t, uint32_t>(inputBlob);
+            } else if (precision == InferenceEngine::Precision::I8) {
+                inputBlob = make_shared_blob<int8_t>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<int8_t, int32_t>(inputBlob);
+            } else if (precision == InferenceEngine::Precision::BOOL) {
+                inputBlob = make_shared_blob<uint8_t>(desc);
+                inputBlob->allocate();
+                fillBlobRandom<uint8_t, uint32_t>(inputBlob, 0, 1);
+            } else {
+                IE_THROW() << "Input precision is not supported for the shape sweep of " << item.first;
+            }
+            set_blobs[item.first] = inputBlob;
+        }
+        blobs.push_back(set_blobs);
+    }
+    return blobs;
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <inference_engine.hpp>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -14,4 +15,9 @@
 void fillBlobs(const std::vector<std::string>& inputFiles,
                const size_t& batchSize,
                benchmark_app::InputsInfo& app_inputs_info,
-               std::vector<InferReqWrap::Ptr> requests);
\ No newline at end of file
+               std::vector<InferReqWrap::Ptr> requests);
+
+/// @brief Creates the input blobs of each shape set of the shape sweep filled with random values
+std::vector<std::map<std::string, InferenceEngine::Blob::Ptr>> createShapeSweepBlobs(
+    const std::vector<InferenceEngine::ICNNNetwork::InputShapes>& shape_sets,
+    const benchmark_app::InputsInfo& app_inputs_info);
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// 128 sub-buckets per power of two keep the relative error of a bucket below 1%
+constexpr size_t subBucketBits = 7;
+constexpr size_t subBucketCount = size_t(1) << subBucketBits;
+constexpr size_t subBucketHalfCount = subBucketCount / 2;
+// values up to 2^40 us (~12 days) are tracked, the larger ones are saturated
+constexpr size_t valueBits = 40;
+constexpr uint64_t maxTrackedValue = (uint64_t(1) << valueBits) - 1;
+constexpr size_t bucketsCount = subBucketCount + (valueBits - subBucketBits) * subBucketHalfCount;
+
+size_t highestBit(uint64_t value) {
+    size_t bit = 0;
+    while (value >>= 1)
+        bit++;
+    return bit;
+}
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() : _counts(bucketsCount, 0) {}
+
+size_t LatencyHistogram::getIndex(uint64_t value) {
+    if (value < subBucketCount)
+        return static_cast<size_t>(value);
+    // the value is shifted to the [subBucketHalfCount, subBucketCount) range, the shift selects the bucket
+    const size_t shift = highestBit(value) - (subBucketBits - 1);
+    const size_t subBucket = static_cast<size_t>(value >> shift) - subBucketHalfCount;
+    return subBucketCount + (shift - 1) * subBucketHalfCount + subBucket;
+}
+
+uint64_t LatencyHistogram::getValue(size_t index) {
+    if (index < subBucketCount)
+        return index;
+    const size_t shift = (index - subBucketCount) / subBucketHalfCount + 1;
+    const uint64_t subBucket = (index - subBucketCount) % subBucketHalfCount + subBucketHalfCount;
+    // the highest value which falls into the sub-bucket
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::add(double latencyMs) {
+    const auto us = static_cast<uint64_t>(std::llround(std::max(latencyMs, 0.0) * 1000.0));
+    const uint64_t value = std::min(us, maxTrackedValue);
+    _counts[getIndex(value)]++;
+    _min = _count == 0 ? value : std::min(_min, value);
+    _max = _count == 0 ? value : std::max(_max, value);
+    _sum += latencyMs;
+    _count++;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(_counts.begin(), _counts.end(), 0);
+    _count = 0;
+    _min = 0;
+    _max = 0;
+    _sum = 0;
+}
+
+double LatencyHistogram::getMin() const {
+    return _min / 1000.0;
+}
+
+double LatencyHistogram::getMax() const {
+    return _max / 1000.0;
+}
+
+double LatencyHistogram::getAverage() const {
+    return _count == 0 ? 0.0 : _sum / _count;
+}
+
+double LatencyHistogram::getPercentile(double percentile) const {
+    if (_count == 0)
+        return 0.0;
+    const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * _count)));
+    uint64_t accumulated = 0;
+    for (size_t index = 0; index < _counts.size(); index++) {
+        accumulated += _counts[index];
+        if (accumulated >= rank)
+            return std::min(std::max(getValue(index), _min), _max) / 1000.0;
+    }
+    return getMax();
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// @brief Histogram of latencies with the HDR-like buckets: each power of two range of values is split into
+/// the same number of linear sub-buckets, so the relative error of the reported percentiles does not depend
+/// on the magnitude of the latency. The memory is bounded by the range of values, not by the number of samples.
+class LatencyHistogram final {
+public:
+    LatencyHistogram();
+
+    /// @brief Records the latency in milliseconds. The values are tracked with the microsecond resolution.
+    void add(double latencyMs);
+
+    void reset();
+
+    size_t getCount() const {
+        return _count;
+    }
+
+    double getMin() const;
+    double getMax() const;
+    double getAverage() const;
+
+    /// @brief Returns the latency in milliseconds which is not exceeded by the given percent of the samples
+    double getPercentile(double percentile) const;
+
+private:
+    static size_t getIndex(uint64_t value);
+    static uint64_t getValue(size_t index);
+
+    std::vector<uint64_t> _counts;
+    size_t _count = 0;
+    uint64_t _min = 0;
+    uint64_t _max = 0;
+    double _sum = 0;
+};
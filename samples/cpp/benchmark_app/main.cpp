@@ -4,15 +4,18 @@
 
 #include <algorithm>
 #include <chrono>
+#include <deque>
 #include <gna/gna_config.hpp>
 #include <gpu/gpu_config.hpp>
 #include <inference_engine.hpp>
 #include <map>
 #include <memory>
+#include <random>
 #include <samples/args_helper.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -60,6 +63,20 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect target QPS. Please set -qps option to a positive value.");
+    }
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-qps) requires the async API.");
+    }
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "uniform") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `poisson` or `uniform` "
+                               "value.");
+    }
+    if (FLAGS_shape_sweep_order != "sequential" && FLAGS_shape_sweep_order != "random") {
+        throw std::logic_error("Incorrect shape sweep order. Please set -shape_sweep_order option to `sequential` or "
+                               "`random` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
                                "either `throughput`(tput) or `latency' value.");
@@ -85,6 +102,10 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
 
         throw std::logic_error(err);
     }
+    if ((isNetworkCompiled || FLAGS_load_from_file) && !FLAGS_shape_sweep.empty()) {
+        throw std::logic_error("Shape sweep requires the network to be reshaped, it can't be used for a compiled "
+                               "network or with -load_from_file option.");
+    }
     return true;
 }
 
@@ -386,6 +407,7 @@ int main(int argc, char* argv[]) {
         Precision precision = Precision::UNSPECIFIED;
         std::string topology_name = "";
         benchmark_app::InputsInfo app_inputs_info;
+        std::vector<InferenceEngine::ICNNNetwork::InputShapes> shapeSweep;
         std::string output_name;
 
         // Takes priority over config from file
@@ -465,6 +487,28 @@ int main(int argc, char* argv[]) {
             // use batch size according to provided layout and shapes
             batchSize = (!FLAGS_layout.empty()) ? getBatchSize(app_inputs_info) : cnnNetwork.getBatchSize();
 
+            if (!FLAGS_shape_sweep.empty()) {
+                // the dimensions which differ among the shape sets are made dynamic, so all the sets are inferred
+                // by the same network and the cost of a shape change is measured by the inference itself
+                shapeSweep = parseShapeSweep(FLAGS_shape_sweep, app_inputs_info);
+                auto partialShapes = getShapeSweepPartialShapes(shapeSweep);
+                std::stringstream shapes_ss;
+                for (auto& item : partialShapes) {
+                    shapes_ss << (shapes_ss.str().empty() ? "" : ", ") << "'" << item.first << "': " << item.second;
+                }
+                slog::info << "Reshaping network for the sweep of " << shapeSweep.size()
+                           << " shape sets: " << shapes_ss.str() << slog::endl;
+                startTime = Time::now();
+                IE_SUPPRESS_DEPRECATED_START
+                cnnNetwork.reshape(partialShapes);
+                IE_SUPPRESS_DEPRECATED_END
+                duration_ms = double_to_string(get_total_ms_time(startTime));
+                slog::info << "Reshape network took " << duration_ms << " ms" << slog::endl;
+                if (statistics)
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {{"reshape network for shape sweep time (ms)", duration_ms}});
+            }
+
             topology_name = cnnNetwork.getName();
             slog::info << (FLAGS_b != 0 ? "Network batch size was changed to: " : "Network batch size: ") << batchSize
                        << slog::endl;
@@ -568,7 +612,7 @@ int main(int argc, char* argv[]) {
 
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && (FLAGS_qps == 0)) {
             niter = ((niter + nireq - 1) / nireq) * nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from " << FLAGS_niter << " to "
@@ -600,6 +644,13 @@ int main(int argc, char* argv[]) {
                     {"number of parallel infer requests", std::to_string(nireq)},
                     {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                 });
+            if (FLAGS_qps > 0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                              {"target QPS", double_to_string(FLAGS_qps)},
+                                              {"arrival distribution", FLAGS_arrival},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -615,7 +666,16 @@ int main(int argc, char* argv[]) {
         next_step();
 
         InferRequestsQueue inferRequestsQueue(exeNetwork, nireq);
-        if (isFlagSetInCommandLine("use_device_mem")) {
+        std::vector<std::map<std::string, Blob::Ptr>> shapeSweepBlobs;
+        if (!shapeSweep.empty()) {
+            if (!inputFiles.empty()) {
+                slog::warn << "Input files are ignored by the shape sweep: "
+                              "all inputs will be filled with random values!"
+                           << slog::endl;
+            }
+            shapeSweepBlobs = createShapeSweepBlobs(shapeSweep, app_inputs_info);
+            inferRequestsQueue.setShapesCount(shapeSweep.size());
+        } else if (isFlagSetInCommandLine("use_device_mem")) {
             if (device_name.find("GPU") == 0)
                 ::gpu::fillRemoteBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests, exeNetwork);
             else if (device_name.find("CPU") == 0)
@@ -626,6 +686,26 @@ int main(int argc, char* argv[]) {
             fillBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests);
         }
 
+        // Feeds the next shape set of the sweep to the request, the blobs are set only when the request changes
+        // the shape, so the steady-state inferences do not include the cost of setting the blobs
+        size_t shapeCounter = 0;
+        std::mt19937 shapeGenerator;
+        std::uniform_int_distribution<size_t> shapeDistribution(0, shapeSweep.empty() ? 0 : shapeSweep.size() - 1);
+        auto setShapes = [&](const InferReqWrap::Ptr& request) {
+            if (shapeSweep.empty())
+                return;
+            const size_t shapeId = FLAGS_shape_sweep_order == "random" ? shapeDistribution(shapeGenerator)
+                                                                       : shapeCounter++ % shapeSweep.size();
+            if (request->getShapeId() != shapeId) {
+                auto setShapeStartTime = Time::now();
+                for (auto& blob : shapeSweepBlobs[shapeId]) {
+                    request->setBlob(blob.first, blob.second);
+                }
+                inferRequestsQueue.addSetShapeTime(shapeId, get_total_ms_time(setShapeStartTime));
+            }
+            request->setShapeId(shapeId);
+        };
+
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
         size_t progressCnt = 0;
@@ -649,6 +729,9 @@ int main(int argc, char* argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (FLAGS_qps > 0) {
+                ss << ", " << FLAGS_arrival << " arrivals at " << double_to_string(FLAGS_qps) << " QPS";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -670,6 +753,7 @@ int main(int argc, char* argv[]) {
         if (!inferRequest) {
             IE_THROW() << "No idle Infer Requests!";
         }
+        setShapes(inferRequest);
         if (FLAGS_api == "sync") {
             inferRequest->infer();
         } else {
@@ -691,14 +775,80 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+        auto updateProgress = [&]() {
+            if (niter > 0) {
+                progressBar.addProgress(1);
+            } else {
+                // calculate how many progress intervals are covered by current
+                // iteration. depends on the current iteration time and time of each
+                // progress interval. Previously covered progress intervals must be
+                // skipped.
+                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                progressBar.addProgress(newProgress);
+                progressCnt += newProgress;
+            }
+        };
+
+        if (FLAGS_qps > 0) {
+            // Open loop: the arrivals are scheduled on a timer independently of the completion of the requests.
+            // An arrival which finds no idle request waits in the queue, the wait is accounted from the scheduled
+            // arrival time, so the delays of the timer and of the busy requests are not hidden from the statistics.
+            std::mt19937 generator;
+            std::exponential_distribution<double> poissonInterval(FLAGS_qps);
+            auto nextInterval = [&]() {
+                const double seconds = FLAGS_arrival == "poisson" ? poissonInterval(generator) : 1.0 / FLAGS_qps;
+                return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+            };
+
+            std::deque<Time::time_point> arrivals;
+            size_t scheduled = 0;
+            auto nextArrival = startTime;
+            auto isScheduling = [&]() {
+                auto scheduledTime = std::chrono::duration_cast<ns>(nextArrival - startTime).count();
+                return (niter != 0LL && scheduled < niter) ||
+                       (duration_nanoseconds != 0LL && (uint64_t)scheduledTime < duration_nanoseconds);
+            };
+
+            while (isScheduling() || !arrivals.empty()) {
+                auto now = Time::now();
+                while (isScheduling() && nextArrival <= now) {
+                    arrivals.push_back(nextArrival);
+                    nextArrival += nextInterval();
+                    scheduled++;
+                }
+                if (arrivals.empty()) {
+                    std::this_thread::sleep_until(nextArrival);
+                    continue;
+                }
+
+                // an idle request is not awaited beyond the next arrival, so the arrivals are queued on time
+                inferRequest = isScheduling() ? inferRequestsQueue.getIdleRequestUntil(nextArrival)
+                                              : inferRequestsQueue.getIdleRequest();
+                if (!inferRequest) {
+                    continue;
+                }
+                // rechecks the exceptions of the previous execution, see the closed loop below
+                inferRequest->wait();
+                setShapes(inferRequest);
+                inferRequest->startAsync(arrivals.front());
+                arrivals.pop_front();
+                iteration++;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                updateProgress();
+            }
+        }
+
+        while (FLAGS_qps == 0 && ((niter != 0LL && iteration < niter) ||
+                                  (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                                  (FLAGS_api == "async" && iteration % nireq != 0))) {
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
             }
 
+            setShapes(inferRequest);
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
             } else {
@@ -714,19 +864,7 @@ int main(int argc, char* argv[]) {
             iteration++;
 
             execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
-            }
+            updateProgress();
         }
 
         // wait the latest inference executions
@@ -743,6 +881,48 @@ int main(int argc, char* argv[]) {
                                           {"total execution time (ms)", double_to_string(totalDuration)},
                                           {"total number of iterations", std::to_string(iteration)},
                                       });
+            auto histogramParameters = [&](const std::string& name, const LatencyHistogram& histogram) {
+                return StatisticsReport::Parameters{
+                    {name + " p50 (ms)", double_to_string(histogram.getPercentile(50))},
+                    {name + " p90 (ms)", double_to_string(histogram.getPercentile(90))},
+                    {name + " p99 (ms)", double_to_string(histogram.getPercentile(99))},
+                    {name + " p99.9 (ms)", double_to_string(histogram.getPercentile(99.9))},
+                    {name + " max (ms)", double_to_string(histogram.getMax())},
+                };
+            };
+            if (device_name.find("MULTI") == std::string::npos) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          histogramParameters("latency", inferRequestsQueue.getLatencyHistogram()));
+            }
+            if (FLAGS_qps > 0) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          histogramParameters("queueing delay",
+                                                              inferRequestsQueue.getQueueingHistogram()));
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          histogramParameters("response time",
+                                                              inferRequestsQueue.getResponseHistogram()));
+            }
+            for (size_t shapeId = 0; shapeId < shapeSweep.size(); shapeId++) {
+                const auto& shapeStatistics = inferRequestsQueue.getShapeStatistics()[shapeId];
+                const std::string name = "shape " + getShapesString(shapeSweep[shapeId]);
+                const size_t count =
+                    shapeStatistics.steadyState.getCount() + shapeStatistics.afterShapeChange.getCount();
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                              {name + " inferences", std::to_string(count)},
+                                              {name + " shape changes",
+                                               std::to_string(shapeStatistics.afterShapeChange.getCount())},
+                                              {name + " set shape avg (ms)",
+                                               double_to_string(shapeStatistics.setShape.getAverage())},
+                                              {name + " first inference after shape change avg (ms)",
+                                               double_to_string(shapeStatistics.afterShapeChange.getAverage())},
+                                              {name + " first inference after shape change max (ms)",
+                                               double_to_string(shapeStatistics.afterShapeChange.getMax())},
+                                          });
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          histogramParameters(name + " steady state latency",
+                                                              shapeStatistics.steadyState));
+            }
             if (device_name.find("MULTI") == std::string::npos) {
                 std::string latency_label;
                 if (FLAGS_latency_percentile == 50) {
@@ -811,6 +991,29 @@ int main(int argc, char* argv[]) {
             }
             std::cout << double_to_string(latency) << " ms" << std::endl;
         }
+        if (FLAGS_qps > 0) {
+            auto printHistogram = [&](const std::string& name, const LatencyHistogram& histogram) {
+                std::cout << name << " (p50/p90/p99/p99.9):    " << double_to_string(histogram.getPercentile(50))
+                          << " / " << double_to_string(histogram.getPercentile(90)) << " / "
+                          << double_to_string(histogram.getPercentile(99)) << " / "
+                          << double_to_string(histogram.getPercentile(99.9)) << " ms" << std::endl;
+            };
+            printHistogram("Queueing delay", inferRequestsQueue.getQueueingHistogram());
+            printHistogram("Response time ", inferRequestsQueue.getResponseHistogram());
+        }
+        for (size_t shapeId = 0; shapeId < shapeSweep.size(); shapeId++) {
+            const auto& shapeStatistics = inferRequestsQueue.getShapeStatistics()[shapeId];
+            std::cout << "Shape " << getShapesString(shapeSweep[shapeId]) << ":" << std::endl;
+            std::cout << "    Steady state latency (p50/p90/p99):    "
+                      << double_to_string(shapeStatistics.steadyState.getPercentile(50)) << " / "
+                      << double_to_string(shapeStatistics.steadyState.getPercentile(90)) << " / "
+                      << double_to_string(shapeStatistics.steadyState.getPercentile(99)) << " ms ("
+                      << shapeStatistics.steadyState.getCount() << " inferences)" << std::endl;
+            std::cout << "    Shape change (set shape / first inference):    "
+                      << double_to_string(shapeStatistics.setShape.getAverage()) << " / "
+                      << double_to_string(shapeStatistics.afterShapeChange.getAverage()) << " ms avg ("
+                      << shapeStatistics.afterShapeChange.getCount() << " changes)" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -4,6 +4,8 @@
 
 // clang-format off
 #include <algorithm>
+#include <cctype>
+#include <fstream>
 #include <map>
 #include <regex>
 #include <samples/common.hpp>
@@ -178,6 +180,68 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
     return ss.str();
 }
 
+std::vector<InferenceEngine::ICNNNetwork::InputShapes> parseShapeSweep(const std::string& sweep_string,
+                                                                       const benchmark_app::InputsInfo& inputs_info) {
+    //  Format: input0[1,8],input1[1,8];input0[1,64],input1[1,64] or a file with a set per line
+    std::vector<std::string> entries;
+    std::ifstream file(sweep_string);
+    if (sweep_string.find('[') == std::string::npos && file.is_open()) {
+        std::string line;
+        while (std::getline(file, line)) {
+            line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
+            if (!line.empty() && line.front() != '#')
+                entries.push_back(line);
+        }
+    } else {
+        for (auto& entry : split(sweep_string, ';')) {
+            if (!entry.empty())
+                entries.push_back(entry);
+        }
+    }
+    if (entries.empty())
+        throw std::logic_error("No shapes are given in the shape sweep: " + sweep_string);
+
+    std::vector<InferenceEngine::ICNNNetwork::InputShapes> shape_sets;
+    for (auto& entry : entries) {
+        auto shape_map = parseInputParameters(entry, inputs_info);
+        InferenceEngine::ICNNNetwork::InputShapes shape_set;
+        for (auto& item : inputs_info) {
+            if (!shape_map.count(item.first)) {
+                shape_set[item.first] = item.second.shape;
+                continue;
+            }
+            for (auto& dim : split(shape_map.at(item.first), ',')) {
+                shape_set[item.first].push_back(std::stoul(dim));
+            }
+        }
+        for (auto& item : shape_map) {
+            if (!inputs_info.count(item.first))
+                throw std::logic_error("Can't find network input '" + item.first + "' of the shape sweep");
+        }
+        shape_sets.push_back(shape_set);
+    }
+    return shape_sets;
+}
+
+std::map<std::string, ngraph::PartialShape> getShapeSweepPartialShapes(
+    const std::vector<InferenceEngine::ICNNNetwork::InputShapes>& shape_sets) {
+    std::map<std::string, ngraph::PartialShape> partial_shapes;
+    for (auto& item : shape_sets.front()) {
+        ngraph::PartialShape partial_shape(item.second);
+        for (auto& shape_set : shape_sets) {
+            const auto& shape = shape_set.at(item.first);
+            if (shape.size() != item.second.size())
+                throw std::logic_error("The ranks of input '" + item.first + "' differ in the shape sweep");
+            for (size_t i = 0; i < shape.size(); i++) {
+                if (shape[i] != item.second[i])
+                    partial_shape[i] = ngraph::Dimension::dynamic();
+            }
+        }
+        partial_shapes[item.first] = partial_shape;
+    }
+    return partial_shapes;
+}
+
 std::map<std::string, std::vector<float>> parseScaleOrMean(const std::string& scale_mean,
                                                            const benchmark_app::InputsInfo& inputs_info) {
     //  Format: data:[255,255,255],info[255,255,255]
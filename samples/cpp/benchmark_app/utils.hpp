@@ -37,6 +37,15 @@ std::vector<std::string> split(const std::string& s, char delim);
 std::map<std::string, std::vector<float>> parseScaleOrMean(const std::string& scale_mean,
                                                            const benchmark_app::InputsInfo& inputs_info);
 
+/// @brief Parses the shape sets of the -shape_sweep option: either the sets in the -shape format separated by ';'
+/// or a path to a text file with one set per line. The inputs which are not mentioned in a set keep their shapes.
+std::vector<InferenceEngine::ICNNNetwork::InputShapes> parseShapeSweep(const std::string& sweep_string,
+                                                                       const benchmark_app::InputsInfo& inputs_info);
+
+/// @brief Returns the shapes of the inputs which cover all the sets: the dimensions which differ are dynamic
+std::map<std::string, ngraph::PartialShape> getShapeSweepPartialShapes(
+    const std::vector<InferenceEngine::ICNNNetwork::InputShapes>& shape_sets);
+
 template <typename T>
 std::map<std::string, std::string> parseInputParameters(const std::string parameter_string,
                                                         const std::map<std::string, T>& input_info) {